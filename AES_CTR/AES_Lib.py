@@ -2,8 +2,18 @@
 from Crypto.Cipher import AES
 from Crypto.Util import Counter
 import numpy as np
+import hashlib
 import os
 
+RATCHET_DS = 0xFF  # = SESSION_RATCHET_DS (vitis_ML_KEM/src/params.h)
+
+def ratchet_key(key_bytes):
+    """
+    Key epoch sau = SHAKE256(key || 0xFF)[:32], giống SESSION_OP_RATCHET của session kernel.
+    Rekey giữa các frame không cần chạy lại ML_KEM.Encaps / Decaps.
+    """
+    return hashlib.shake_256(bytes(key_bytes) + bytes([RATCHET_DS])).digest(32)
+
 class AES_Software:
     def __init__(self, key_bytes):
         """
@@ -17,6 +27,11 @@ class AES_Software:
         # self.nonce = b'\x00' * 8
         self.nonce = os.urandom(8)  # Thay đổi nonce cho mỗi phiên mã hóa trong thực tế/ Random mỗi lần  
  
+    def ratchet(self):
+        """Chuyển sang key epoch kế tiếp (ghi đè key cũ), nonce mới"""
+        self.key = ratchet_key(self.key)
+        self.nonce = os.urandom(8)
+
     def encrypt_image(self, image_array):
         """
         Mã hóa ảnh (numpy array)
@@ -0,0 +1,109 @@
+# Duplex_Lib.py
+# Mô hình tham chiếu của kernel keccak_duplex_crypt (vitis_ML_KEM/src/duplex_cipher.cpp)
+import numpy as np
+import os
+
+RATE = 168          # byte, = rate SHAKE128 (capacity 256 bit)
+DS_KEY = 0x01       # byte domain ở byte cuối state (byte 199), trước mỗi permutation
+DS_CRYPT = 0x02     # block payload, còn block sau
+DS_LAST = 0x03      # block payload cuối (đầy hoặc lẻ)
+DS_TAG = 0x04
+
+_RC = [
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808A, 0x8000000080008000,
+    0x000000000000808B, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+    0x000000000000008A, 0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+    0x000000008000808B, 0x800000000000008B, 0x8000000000008089, 0x8000000000008003,
+    0x8000000000008002, 0x8000000000000080, 0x000000000000800A, 0x800000008000000A,
+    0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
+]
+_ROT = [
+    [0, 36, 3, 41, 18], [1, 44, 10, 45, 2], [62, 6, 43, 15, 61],
+    [28, 55, 25, 21, 56], [27, 20, 39, 8, 14],
+]
+_M64 = (1 << 64) - 1
+
+
+def _rotl(x, n):
+    return ((x << n) | (x >> (64 - n))) & _M64 if n else x
+
+
+def keccak_f1600(a):
+    """Keccak-f[1600] trên list 25 lane (lane x + 5y), giống keccak_f1600 của HLS"""
+    for rc in _RC:
+        c = [a[x] ^ a[x + 5] ^ a[x + 10] ^ a[x + 15] ^ a[x + 20] for x in range(5)]
+        d = [c[(x - 1) % 5] ^ _rotl(c[(x + 1) % 5], 1) for x in range(5)]
+        a = [a[i] ^ d[i % 5] for i in range(25)]
+        b = [0] * 25
+        for x in range(5):
+            for y in range(5):
+                b[y + 5 * ((2 * x + 3 * y) % 5)] = _rotl(a[x + 5 * y], _ROT[x][y])
+        a = [b[i] ^ (~b[(i % 5 + 1) % 5 + 5 * (i // 5)] & b[(i % 5 + 2) % 5 + 5 * (i // 5)]) for i in range(25)]
+        a[0] ^= rc
+    return a
+
+
+class KeccakDuplex_Software:
+    def __init__(self, key_bytes):
+        """
+        Authenticated encryption trên Keccak-f1600 dạng duplex, key = ss của ML-KEM.
+        Mỗi permutation mã hóa RATE byte; tag 16 byte phủ toàn bộ ciphertext và độ dài.
+        Chỉ dùng để kiểm tra / giải mã đối chiếu với kernel (Python thuần, chậm).
+        """
+        if len(key_bytes) != 32:
+            raise ValueError("Duplex yêu cầu khóa 32 bytes (256 bits).")
+        self.key = key_bytes
+        self.nonce = os.urandom(16)  # nonce 128 bit, không được dùng lại với cùng key
+
+    @staticmethod
+    def _xor_bytes(s, off, data):
+        """XOR data vào state (bytes little-endian trong lane) từ byte off"""
+        for i, v in enumerate(data):
+            p = off + i
+            s[p // 8] ^= v << (8 * (p % 8))
+
+    @staticmethod
+    def _get_bytes(s, n):
+        return b"".join(s[i].to_bytes(8, "little") for i in range((n + 7) // 8))[:n]
+
+    def _init(self):
+        s = [0] * 25
+        self._xor_bytes(s, 0, self.key + self.nonce)
+        self._xor_bytes(s, 48, b"\x01")
+        self._xor_bytes(s, RATE - 1, b"\x80")
+        self._xor_bytes(s, 199, bytes([DS_KEY]))
+        return keccak_f1600(s)
+
+    def _run(self, data, decrypt):
+        s = self._init()
+        out = bytearray()
+        n_blocks = (len(data) + RATE - 1) // RATE
+        for b in range(n_blocks):
+            blk = data[b * RATE:(b + 1) * RATE]
+            ks = self._get_bytes(s, len(blk))
+            res = bytes(x ^ y for x, y in zip(blk, ks))
+            out += res
+            # state hấp thụ plaintext
+            self._xor_bytes(s, 0, res if decrypt else blk)
+            last = (b == n_blocks - 1)
+            if last and len(blk) < RATE:
+                self._xor_bytes(s, len(blk), b"\x01")
+            self._xor_bytes(s, 199, bytes([DS_LAST if last else DS_CRYPT]))
+            s = keccak_f1600(s)
+        # tag: độ dài (byte, LE64) + pad, domain TAG
+        self._xor_bytes(s, 0, len(data).to_bytes(8, "little") + b"\x01")
+        self._xor_bytes(s, RATE - 1, b"\x80")
+        self._xor_bytes(s, 199, bytes([DS_TAG]))
+        s = keccak_f1600(s)
+        return bytes(out), self._get_bytes(s, 16)
+
+    def encrypt_image(self, image_array):
+        """Trả về (ciphertext, tag 16 byte)"""
+        return self._run(image_array.tobytes(), decrypt=False)
+
+    def decrypt_to_image(self, encrypted_bytes, tag, shape, dtype):
+        """Giải mã, báo lỗi nếu tag không khớp"""
+        plain, tag_calc = self._run(encrypted_bytes, decrypt=True)
+        if tag_calc != tag:
+            raise ValueError("Tag không khớp: frame bị sửa hoặc sai key / nonce.")
+        return np.frombuffer(plain, dtype=dtype).reshape(shape)
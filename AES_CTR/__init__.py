@@ -2,6 +2,7 @@
 AES-CTR Encryption Module
 """
 
-from .AES_Lib import AES_Software
+from .AES_Lib import AES_Software, ratchet_key
+from .Duplex_Lib import KeccakDuplex_Software
 
-__all__ = ["AES_Software"]
+__all__ = ["AES_Software", "KeccakDuplex_Software", "ratchet_key"]
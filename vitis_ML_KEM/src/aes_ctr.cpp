@@ -0,0 +1,274 @@
+#include "params.h"
+#include "hls_stream.h"
+#include "ap_int.h"
+
+// =========================================================
+// AES-256-CTR: mã hóa frame bằng khóa phiên (vd ss của ML-KEM)
+// =========================================================
+// Cùng định dạng với AES_Software trong AES_CTR/AES_Lib.py:
+//   counter block i = nonce (8 byte) || BE64(ctr0 + i), ct = pt ^ AES_k(block)
+// ctr0 = 0 cho 1 frame trọn vẹn (Counter.new(64, prefix=nonce, initial_value=0));
+// ctr0 != 0 để host chia 1 frame thành nhiều lần gọi.
+//
+// 1 block = 1 beat_t (byte 0 ở bit [7:0]), state AES dạng cột: byte 4c + r.
+// Datapath 14 round được unroll hoàn toàn trong 1 loop PIPELINE II=1
+// -> 1 block 128-bit / chu kỳ, sau latency ~ AES_ROUNDS tầng.
+
+#define AES_KEY_WORDS 8                         // Nk (AES-256)
+#define AES_RK_WORDS  (4 * (AES_ROUNDS + 1))    // 60 word 32-bit
+#define AES_FRAME_BEATS (AES_FRAME_MAX / AES_BLOCK_BYTES)
+
+// =========================================================
+// PHẦN 1: S-BOX VÀ CÁC PHÉP TRÊN BYTE
+// =========================================================
+
+// Bảng partition complete -> mỗi lần gọi (đã inline) là 1 mux hằng số
+// riêng trong LUT, nên 16 * 14 S-box của datapath đọc được cùng chu kỳ.
+static uint8 aes_sbox(uint8 x) {
+    #pragma HLS INLINE
+    static const unsigned char AES_SBOX[256] = {
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16
+    };
+    #pragma HLS ARRAY_PARTITION variable=AES_SBOX type=complete
+    return AES_SBOX[x];
+}
+
+// Nhân 2 trong GF(2^8) mod x^8 + x^4 + x^3 + x + 1
+static uint8 aes_xtime(uint8 x) {
+    #pragma HLS INLINE
+    return (uint8)((x << 1) ^ ((x & 0x80) ? 0x1b : 0x00));
+}
+
+static ap_uint<32> aes_sub_word(ap_uint<32> w) {
+    #pragma HLS INLINE
+    ap_uint<32> r = 0;
+    for(int b=0; b<4; b++) r |= (ap_uint<32>)aes_sbox((uint8)(w >> (8*b))) << (8*b);
+    return r;
+}
+
+// =========================================================
+// PHẦN 2: KEY EXPANSION (FIPS 197 §5.2, Nk = 8)
+// =========================================================
+// w[i] = w[i-8] ^ f(w[i-1]), 1 word / chu kỳ trên cửa sổ trượt 8 word,
+// round key r = w[4r .. 4r+3] (word c ở bit [32c+31:32c]) -> rk_strm.
+void aes_expand_key(uint8 key[32], hls::stream<beat_t>& rk_strm) {
+    #pragma HLS INLINE off
+    ap_uint<32> win[AES_KEY_WORDS];
+    #pragma HLS ARRAY_PARTITION variable=win type=complete
+    Key_Load_Loop: for(int i=0; i<AES_KEY_WORDS; i++) {
+        #pragma HLS PIPELINE II=1
+        ap_uint<32> w = 0;
+        for(int b=0; b<4; b++) w |= (ap_uint<32>)key[4*i + b] << (8*b);
+        win[i] = w;
+    }
+
+    uint8 rcon = 0x01;
+    beat_t rk = 0;
+    Key_Expand_Loop: for(int i=0; i<AES_RK_WORDS; i++) {
+        #pragma HLS PIPELINE II=1
+        ap_uint<32> w;
+        if (i < AES_KEY_WORDS) {
+            w = win[i];
+        } else {
+            ap_uint<32> t = win[AES_KEY_WORDS - 1];
+            if (i % AES_KEY_WORDS == 0) {
+                // RotWord (byte 0 <- byte 1) rồi SubWord, Rcon vào byte 0
+                t = aes_sub_word((t >> 8) | (t << 24)) ^ (ap_uint<32>)rcon;
+                rcon = aes_xtime(rcon);
+            } else if (i % AES_KEY_WORDS == 4) {
+                t = aes_sub_word(t);
+            }
+            w = win[0] ^ t;
+            for(int j=0; j<AES_KEY_WORDS-1; j++) win[j] = win[j+1];
+            win[AES_KEY_WORDS - 1] = w;
+        }
+        rk |= (beat_t)w << (32 * (i % 4));
+        if (i % 4 == 3) {
+            rk_strm.write(rk);
+            rk = 0;
+        }
+    }
+}
+
+// =========================================================
+// PHẦN 3: ROUND DATAPATH
+// =========================================================
+static void aes_unpack(beat_t x, uint8 s[16]) {
+    #pragma HLS INLINE
+    for(int b=0; b<16; b++) s[b] = (uint8)(x >> (8*b));
+}
+
+static beat_t aes_pack(uint8 s[16]) {
+    #pragma HLS INLINE
+    beat_t x = 0;
+    for(int b=0; b<16; b++) x |= (beat_t)s[b] << (8*b);
+    return x;
+}
+
+// SubBytes + ShiftRows (+ MixColumns nếu mix) + AddRoundKey
+static beat_t aes_round(beat_t x, beat_t rk, bool mix) {
+    #pragma HLS INLINE
+    uint8 s[16], t[16];
+    #pragma HLS ARRAY_PARTITION variable=s type=complete
+    #pragma HLS ARRAY_PARTITION variable=t type=complete
+    aes_unpack(x, s);
+    // hàng r dịch trái r cột
+    for(int c=0; c<4; c++)
+        for(int r=0; r<4; r++) t[4*c + r] = aes_sbox(s[4*((c + r) % 4) + r]);
+    if (mix) {
+        for(int c=0; c<4; c++) {
+            uint8 a0 = t[4*c], a1 = t[4*c+1], a2 = t[4*c+2], a3 = t[4*c+3];
+            uint8 all = a0 ^ a1 ^ a2 ^ a3;
+            t[4*c]   = a0 ^ all ^ aes_xtime(a0 ^ a1);
+            t[4*c+1] = a1 ^ all ^ aes_xtime(a1 ^ a2);
+            t[4*c+2] = a2 ^ all ^ aes_xtime(a2 ^ a3);
+            t[4*c+3] = a3 ^ all ^ aes_xtime(a3 ^ a0);
+        }
+    }
+    return aes_pack(t) ^ rk;
+}
+
+// AES-256 1 block: round 0 chỉ AddRoundKey, round 14 bỏ MixColumns
+beat_t aes256_encrypt_block(beat_t in, beat_t rk[AES_ROUNDS + 1]) {
+    #pragma HLS INLINE
+    beat_t x = in ^ rk[0];
+    Round_Loop: for(int r=1; r<=AES_ROUNDS; r++) {
+        #pragma HLS UNROLL
+        x = aes_round(x, rk[r], r != AES_ROUNDS);
+    }
+    return x;
+}
+
+// nonce (byte 0 ở bit [7:0]) || counter big-endian ở byte 8..15
+static beat_t aes_ctr_block(ap_uint<64> nonce, ap_uint<64> ctr) {
+    #pragma HLS INLINE
+    beat_t blk = (beat_t)nonce;
+    for(int b=0; b<8; b++) blk |= (beat_t)(uint8)(ctr >> (8*(7 - b))) << (8*(8 + b));
+    return blk;
+}
+
+// =========================================================
+// PHẦN 4: DATAFLOW read / keystream / xor-write
+// =========================================================
+static void aes_read(beat_t* in, int n_blocks, hls::stream<beat_t>& data_strm) {
+    #pragma HLS INLINE off
+    Read_Frame_Loop: for(int i=0; i<n_blocks; i++) {
+        #pragma HLS PIPELINE II=1
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=AES_FRAME_BEATS
+        data_strm.write(in[i]);
+    }
+}
+
+// Keystream không phụ thuộc dữ liệu -> chạy trước read / write, chỉ bị
+// chặn bởi độ sâu ks_strm.
+static void aes_keystream(
+    hls::stream<beat_t>& rk_strm,
+    ap_uint<64> nonce,
+    ap_uint<64> ctr0,
+    int n_blocks,
+    hls::stream<beat_t>& ks_strm
+) {
+    #pragma HLS INLINE off
+    beat_t rk[AES_ROUNDS + 1];
+    #pragma HLS ARRAY_PARTITION variable=rk type=complete
+    for(int r=0; r<=AES_ROUNDS; r++) {
+        #pragma HLS PIPELINE II=1
+        rk[r] = rk_strm.read();
+    }
+
+    ap_uint<64> ctr = ctr0;
+    Keystream_Loop: for(int i=0; i<n_blocks; i++) {
+        #pragma HLS PIPELINE II=1
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=AES_FRAME_BEATS
+        ks_strm.write(aes256_encrypt_block(aes_ctr_block(nonce, ctr), rk));
+        ctr++;
+    }
+}
+
+// Block cuối lẻ (n_bytes % 16): byte sau n_bytes ghi 0, không lộ keystream
+static void aes_xor_write(
+    hls::stream<beat_t>& data_strm,
+    hls::stream<beat_t>& ks_strm,
+    int n_blocks,
+    int tail,
+    beat_t* out
+) {
+    #pragma HLS INLINE off
+    beat_t tail_mask = 0;
+    for(int b=0; b<AES_BLOCK_BYTES; b++) {
+        #pragma HLS UNROLL
+        if (tail == 0 || b < tail) tail_mask |= (beat_t)0xff << (8*b);
+    }
+
+    Write_Frame_Loop: for(int i=0; i<n_blocks; i++) {
+        #pragma HLS PIPELINE II=1
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=AES_FRAME_BEATS
+        beat_t c = data_strm.read() ^ ks_strm.read();
+        if (i == n_blocks - 1) c &= tail_mask;
+        out[i] = c;
+    }
+}
+
+// Lõi DATAFLOW dùng chung: aes256_ctr (key từ DDR) và session.cpp
+// (key từ slot on-chip, không bao giờ ra DDR).
+void aes256_ctr_core(
+    uint8 key[32],
+    ap_uint<64> nonce,
+    ap_uint<64> ctr0,
+    int n_bytes,
+    beat_t* in,
+    beat_t* out
+) {
+    #pragma HLS INLINE off
+    int n_blocks = (n_bytes + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES;
+    int tail = n_bytes % AES_BLOCK_BYTES;
+
+    hls::stream<beat_t> rk_strm;
+    #pragma HLS STREAM variable=rk_strm depth=15
+    hls::stream<beat_t> data_strm;
+    #pragma HLS STREAM variable=data_strm depth=64
+    hls::stream<beat_t> ks_strm;
+    #pragma HLS STREAM variable=ks_strm depth=64
+
+    #pragma HLS DATAFLOW
+    aes_expand_key(key, rk_strm);
+    aes_read(in, n_blocks, data_strm);
+    aes_keystream(rk_strm, nonce, ctr0, n_blocks, ks_strm);
+    aes_xor_write(data_strm, ks_strm, n_blocks, tail, out);
+}
+
+// Kernel: out = AES-256-CTR(key, nonce, ctr0)(in), n_bytes bất kỳ.
+// Buffer in / out phải được cấp tròn lên bội 16 byte (host dùng XRT bo).
+void aes256_ctr(
+    uint8 key[32],
+    ap_uint<64> nonce,
+    ap_uint<64> ctr0,
+    int n_bytes,
+    beat_t* in,
+    beat_t* out
+) {
+    #pragma HLS INTERFACE m_axi port=key bundle=gmem0 depth=32 max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=in bundle=gmem0 depth=AES_FRAME_BEATS max_read_burst_length=256
+    #pragma HLS INTERFACE m_axi port=out bundle=gmem1 depth=AES_FRAME_BEATS max_write_burst_length=256
+    #pragma HLS INTERFACE s_axilite port=nonce
+    #pragma HLS INTERFACE s_axilite port=ctr0
+    #pragma HLS INTERFACE s_axilite port=n_bytes
+    #pragma HLS INTERFACE s_axilite port=return
+
+    aes256_ctr_core(key, nonce, ctr0, n_bytes, in, out);
+}
@@ -0,0 +1,675 @@
+#ifndef AES_DATA_H
+#define AES_DATA_H
+#include <stdint.h>
+#include "params.h"
+
+// NIST SP 800-38A F.5.5 CTR-AES256.Encrypt: nonce = f0..f7, ctr0 = f8f9fafbfcfdfeff
+#define SP800_CTR0 0xf8f9fafbfcfdfeffULL
+const uint8 SP800_KEY[32] = {
+  96,61,235,16,21,202,113,190,43,115,174,240,133,125,119,129,31,53,44,7,59,97,8,215,45,152,16,163,9,20,223,244,
+};
+
+const uint8 SP800_NONCE[8] = {
+  240,241,242,243,244,245,246,247,
+};
+
+const uint8 SP800_PT[64] = {
+  107,193,190,226,46,64,159,150,233,61,126,17,115,147,23,42,174,45,138,87,30,3,172,156,158,183,111,172,69,175,142,81,
+  48,200,28,70,163,92,228,17,229,251,193,25,26,10,82,239,246,159,36,69,223,79,155,23,173,43,65,123,230,108,55,16,
+};
+
+const uint8 SP800_CT[64] = {
+  96,30,195,19,119,87,137,165,183,167,245,4,187,243,210,40,244,67,227,202,77,98,181,154,202,132,233,144,202,202,245,197,
+  43,9,48,218,162,61,233,76,232,112,23,186,45,132,152,141,223,201,197,141,182,122,173,166,19,194,221,8,69,121,65,166,
+};
+
+// AES_Software.encrypt_image (AES_CTR/AES_Lib.py) trên ảnh 32x32x3 ngẫu nhiên,
+// key / nonce như demo_counter.py
+#define FRAME_BYTES 3072
+const uint8 FRAME_KEY[32] = {
+  48,49,50,51,52,53,54,55,56,57,65,66,67,68,69,70,48,49,50,51,52,53,54,55,56,57,65,66,67,68,69,70,
+};
+
+const uint8 FRAME_NONCE[8] = {
+  18,52,86,120,144,171,205,239,
+};
+
+const uint8 FRAME_PT[3072] = {
+  219,151,141,114,102,201,148,254,7,224,25,254,239,99,203,97,37,87,30,244,223,248,191,211,140,49,179,163,157,92,86,214,
+  249,195,41,196,137,158,206,249,84,82,223,98,253,4,197,19,109,239,109,116,193,210,68,81,25,66,181,124,175,251,103,235,
+  155,252,47,247,173,201,5,173,54,214,184,162,174,210,43,73,152,29,217,3,120,23,185,99,28,102,78,116,70,171,239,58,
+  130,130,122,203,73,247,189,42,237,72,209,122,28,156,71,39,198,199,255,88,222,18,94,249,52,33,48,171,57,112,132,108,
+  99,199,69,56,194,50,42,16,251,142,166,225,161,156,216,125,206,233,209,159,16,223,208,73,167,190,94,14,228,124,44,54,
+  233,117,51,35,220,73,26,53,16,227,171,36,124,176,58,148,186,93,26,29,119,246,65,151,171,68,31,146,201,49,88,227,
+  196,144,91,123,56,3,30,28,42,55,107,82,47,168,13,127,228,162,26,78,167,27,70,74,37,156,96,64,193,194,96,124,
+  63,108,109,230,47,44,210,242,11,135,0,182,244,177,47,237,180,203,12,255,55,246,149,194,10,246,167,220,1,219,50,200,
+  43,132,146,118,169,249,36,71,66,14,17,241,64,216,130,132,163,168,6,29,98,13,249,205,50,45,122,16,114,67,25,196,
+  43,210,158,72,90,128,219,146,4,236,57,160,234,165,246,217,104,153,53,244,142,90,30,218,45,73,111,118,9,157,1,95,
+  36,208,187,123,251,175,4,117,76,176,248,86,124,74,26,77,212,132,85,88,82,207,126,207,221,199,231,78,86,128,104,126,
+  81,240,216,42,70,97,31,144,244,215,128,239,203,7,89,123,170,215,150,103,49,110,250,64,245,61,179,73,165,116,200,251,
+  253,142,218,35,140,153,254,140,69,129,246,118,17,0,66,248,240,24,14,113,100,91,183,57,57,0,12,122,51,56,115,230,
+  115,40,90,63,5,52,163,82,40,4,59,168,81,129,94,84,233,48,227,0,61,152,144,182,62,27,193,167,183,148,224,192,
+  126,55,92,221,252,243,1,248,171,103,17,11,148,109,142,244,194,243,209,193,40,228,90,238,10,80,146,90,6,238,45,163,
+  159,68,243,247,185,166,101,102,202,203,220,242,192,162,232,35,144,50,241,70,87,195,4,99,248,200,43,245,170,26,175,80,
+  188,195,239,165,28,202,116,156,77,175,168,52,24,143,211,142,74,204,95,140,104,116,24,28,88,185,229,70,137,73,240,122,
+  119,16,17,175,46,220,132,214,140,161,224,163,54,61,103,168,80,147,212,40,202,89,116,15,2,193,250,235,222,226,164,21,
+  9,70,227,252,241,145,218,42,12,103,92,120,121,13,64,211,147,224,137,94,27,158,45,253,83,133,19,19,3,118,92,105,
+  95,92,93,160,242,4,38,253,95,70,186,141,33,207,200,218,26,11,99,31,59,85,120,40,113,246,80,76,171,131,42,191,
+  210,206,38,52,2,239,185,154,130,98,10,207,220,14,159,141,250,184,151,229,135,104,61,169,193,23,123,13,250,101,64,251,
+  73,244,141,185,28,223,201,48,193,140,155,203,100,11,205,241,235,10,24,204,17,176,0,87,208,107,242,231,65,214,35,198,
+  54,40,152,150,205,95,158,71,87,150,102,46,161,151,87,63,98,225,213,36,66,70,222,15,135,64,52,159,144,159,122,173,
+  251,229,148,97,103,164,116,93,114,184,169,21,71,104,247,109,158,109,52,126,25,127,124,253,251,51,214,2,64,169,182,80,
+  10,73,181,235,156,207,221,210,75,241,139,144,175,109,118,141,125,223,245,125,219,14,3,32,235,181,224,105,24,69,58,63,
+  93,9,8,6,195,245,130,26,188,58,63,34,242,188,99,61,183,147,160,227,38,143,14,224,213,143,82,169,167,37,27,207,
+  74,228,242,126,76,26,157,147,141,51,48,17,85,144,144,68,253,148,80,84,30,177,150,167,189,141,21,94,190,173,126,165,
+  219,56,105,222,8,44,63,154,241,178,63,170,113,103,75,2,45,26,137,58,238,7,213,75,249,65,114,54,114,71,61,115,
+  66,183,14,139,101,139,71,187,202,104,33,85,79,247,208,143,49,221,144,163,53,75,172,91,198,82,74,161,242,246,160,206,
+  233,237,22,76,155,62,213,117,50,231,254,173,11,15,242,131,217,234,79,46,50,95,224,171,73,196,107,81,180,240,115,66,
+  35,13,47,185,20,160,153,142,152,176,125,24,246,140,145,16,175,46,227,190,22,227,103,62,79,160,127,200,162,22,150,172,
+  209,120,146,150,180,96,193,246,57,38,36,140,128,65,119,94,112,17,70,9,52,89,123,140,80,218,171,222,64,167,0,135,
+  164,72,38,132,102,176,209,90,94,195,135,241,179,232,102,157,142,233,179,19,191,170,187,150,61,217,129,102,251,184,12,49,
+  247,127,57,230,214,218,115,25,76,15,157,135,82,161,143,100,105,16,85,1,109,222,232,81,110,168,204,34,217,166,166,129,
+  212,201,54,216,53,135,13,55,3,204,147,52,76,183,63,255,171,109,93,89,91,177,193,83,223,153,179,59,160,197,74,158,
+  32,76,90,176,44,212,105,104,99,132,6,114,210,156,181,16,96,96,69,241,132,123,140,220,239,155,169,43,60,247,80,99,
+  206,115,155,126,224,27,1,90,61,230,65,142,184,156,171,5,190,179,137,176,230,74,78,142,237,9,107,22,121,239,90,245,
+  205,94,185,15,32,143,71,241,247,235,179,1,136,202,88,51,217,28,111,211,84,144,146,172,217,103,238,116,43,47,68,207,
+  87,224,37,24,67,86,139,137,93,188,252,115,129,20,140,175,33,148,131,175,46,141,161,25,88,123,209,131,247,213,202,77,
+  100,26,195,205,104,109,35,177,213,113,18,35,229,112,56,121,252,81,88,139,29,26,224,180,166,157,14,242,133,86,100,114,
+  68,74,91,70,19,138,119,80,121,222,75,110,249,44,231,167,10,96,108,102,28,99,154,47,21,220,220,116,219,201,199,14,
+  139,29,224,48,70,174,129,84,30,22,201,163,111,170,175,247,194,51,187,90,66,110,108,144,249,85,171,224,70,9,174,238,
+  70,100,213,241,177,69,58,70,109,45,205,72,101,100,248,115,187,97,115,55,15,196,34,56,157,125,64,237,87,156,79,196,
+  239,150,10,126,115,31,95,70,87,199,140,61,207,102,115,8,146,189,228,95,163,171,95,179,92,245,34,112,77,125,223,97,
+  159,204,244,247,144,0,0,55,250,169,230,236,111,6,133,105,13,162,244,92,167,232,41,115,159,85,19,162,195,186,236,46,
+  71,15,37,118,62,185,40,202,43,186,230,30,14,250,79,149,104,165,200,73,55,70,1,137,61,216,42,72,132,246,226,137,
+  49,241,205,117,45,151,104,194,16,172,30,158,131,127,77,33,60,32,70,80,233,104,12,177,134,106,69,90,189,99,2,255,
+  119,149,211,167,236,76,88,158,107,207,28,186,159,191,220,244,197,88,108,183,146,167,238,68,253,252,106,119,64,133,124,29,
+  38,182,31,228,98,56,224,22,199,12,187,42,46,34,115,155,199,137,220,101,238,93,176,85,196,21,228,248,47,115,120,67,
+  227,176,104,48,248,15,13,216,173,224,195,125,82,207,7,28,54,204,81,13,170,12,128,34,180,12,194,142,228,155,19,4,
+  26,254,128,242,32,131,188,108,176,174,68,17,16,2,184,81,79,34,43,231,4,234,37,179,78,248,98,179,208,162,23,8,
+  163,248,8,28,225,20,165,210,253,242,135,142,84,121,39,255,51,108,253,33,151,214,163,154,142,175,201,253,239,217,87,146,
+  215,235,23,67,33,139,36,231,1,133,34,231,133,69,116,17,170,251,143,242,238,7,136,182,111,173,177,193,17,43,81,235,
+  165,103,215,170,62,252,45,32,165,67,252,78,64,186,93,200,243,177,128,72,245,136,128,89,142,126,5,203,74,177,59,42,
+  75,7,152,61,153,201,90,17,206,135,185,214,131,91,96,250,190,109,62,195,31,116,97,212,89,241,84,92,179,89,216,189,
+  145,113,207,95,156,221,109,154,153,25,50,69,179,31,140,72,132,108,65,26,194,135,26,120,228,114,7,177,119,91,196,36,
+  65,35,86,218,83,245,119,11,174,20,78,68,11,251,233,185,24,137,133,34,24,230,184,121,110,11,58,5,184,14,197,234,
+  143,71,94,13,24,1,134,48,77,117,123,168,18,37,11,134,104,60,93,217,169,94,36,173,142,217,36,242,229,110,4,94,
+  241,171,89,171,180,243,208,104,212,192,71,114,89,9,107,255,226,115,37,7,84,6,202,45,225,166,54,218,132,97,33,68,
+  66,159,228,193,24,107,83,165,120,233,115,203,191,51,39,192,25,95,188,208,38,135,134,169,38,183,141,224,135,85,216,120,
+  194,204,215,97,45,195,224,34,234,182,127,211,110,220,246,1,200,100,69,32,118,94,6,14,255,30,208,156,123,79,75,245,
+  43,61,53,25,182,143,221,10,205,108,26,70,148,199,187,55,169,136,248,39,236,61,232,92,18,250,183,78,102,223,243,75,
+  208,23,103,238,97,77,173,16,134,94,247,102,197,21,136,227,142,21,224,123,15,75,91,125,3,67,211,99,65,151,6,240,
+  75,141,65,52,30,107,98,118,51,34,142,200,85,128,207,120,24,206,81,221,243,95,209,198,224,19,91,60,200,86,137,26,
+  32,110,234,95,140,242,238,177,187,138,225,65,30,29,222,110,243,221,31,104,83,240,191,55,38,12,33,53,249,162,97,158,
+  235,95,207,157,50,43,85,123,29,135,84,49,178,140,212,89,6,15,90,143,148,31,122,230,35,12,12,234,33,38,223,166,
+  105,131,6,218,196,72,54,131,197,148,132,50,217,132,5,244,231,150,37,15,9,233,148,170,58,18,90,142,113,12,155,3,
+  101,148,19,223,228,37,162,205,73,255,198,204,29,180,0,190,9,199,235,23,11,214,234,162,37,195,127,199,177,77,98,140,
+  144,182,85,31,219,199,118,123,237,227,1,23,93,35,227,130,136,2,14,124,134,220,227,237,36,115,146,46,162,89,254,78,
+  204,73,66,13,217,147,24,148,132,240,113,154,92,251,127,10,67,206,75,145,47,85,252,142,210,59,50,11,97,63,232,35,
+  242,7,87,72,230,135,152,29,124,79,51,57,149,138,231,52,193,220,227,37,85,105,100,116,78,30,169,130,241,151,245,212,
+  75,142,19,11,122,84,50,20,160,146,172,98,31,178,243,10,168,68,225,140,69,15,182,1,51,40,41,255,41,186,0,38,
+  128,30,13,86,132,20,225,122,222,207,232,156,24,92,249,204,105,56,127,68,71,39,253,253,48,40,232,62,214,106,75,146,
+  198,79,147,75,95,156,148,176,137,78,74,167,230,155,88,68,228,230,220,106,27,12,173,102,44,33,58,102,10,100,60,66,
+  132,117,81,105,36,246,33,141,102,157,108,154,191,7,17,191,71,185,65,139,242,92,115,29,89,207,35,145,38,8,152,137,
+  160,219,244,123,248,57,34,48,131,244,0,231,114,60,106,182,110,80,54,107,3,138,8,100,169,57,59,255,167,63,193,92,
+  32,4,214,41,201,116,163,115,51,168,200,98,88,56,49,107,16,196,172,228,45,237,175,102,22,84,11,65,79,39,41,211,
+  164,42,155,99,126,187,194,109,133,118,42,128,200,195,198,174,216,34,65,184,140,145,61,45,46,134,92,99,69,20,36,220,
+  105,212,195,0,199,222,191,208,23,100,236,33,114,147,146,22,63,103,82,163,145,198,147,234,125,16,223,120,22,43,140,71,
+  112,146,160,248,72,169,51,39,128,155,143,7,98,230,84,63,125,145,135,182,109,127,77,213,184,85,69,129,65,165,64,184,
+  161,61,36,119,119,214,175,205,240,174,204,79,153,183,9,169,179,120,2,126,111,114,157,164,127,37,99,28,165,241,51,177,
+  228,97,169,3,52,223,141,192,42,17,183,244,160,90,85,1,31,81,160,110,246,120,70,241,149,215,45,155,40,196,124,47,
+  225,243,167,35,31,79,146,226,164,132,5,48,164,178,177,73,153,226,253,131,141,228,190,128,187,144,8,130,20,112,74,73,
+  175,0,99,132,225,248,117,27,42,62,207,155,115,17,189,253,143,44,38,216,43,205,246,50,130,19,214,115,154,217,49,45,
+  215,0,182,43,252,196,27,151,49,22,102,47,255,93,235,64,231,158,106,210,59,171,233,67,239,227,149,22,105,20,80,60,
+  113,197,164,114,176,78,40,111,136,160,134,46,145,134,133,35,42,173,252,51,175,41,186,94,185,221,186,144,23,16,178,230,
+  48,147,226,33,167,48,180,146,174,8,91,46,222,156,206,121,213,91,235,71,216,185,212,102,124,29,235,196,180,28,141,244,
+  13,180,61,17,134,212,63,181,94,87,9,105,8,196,184,149,226,178,210,24,113,132,19,174,126,39,157,120,29,87,78,213,
+  57,0,212,222,254,98,136,199,67,59,114,7,28,39,87,247,202,142,76,210,89,188,85,162,136,234,138,246,126,185,245,209,
+  8,233,250,191,14,72,228,62,4,243,68,232,182,133,111,100,189,176,204,86,42,249,129,215,151,172,225,227,128,168,138,60,
+  180,13,237,185,24,83,104,97,86,94,166,21,248,72,91,39,91,223,8,173,124,220,57,51,228,252,244,218,230,7,246,23,
+  188,98,228,81,75,62,215,254,207,48,199,5,118,172,111,170,159,26,255,25,222,163,225,250,31,194,137,216,212,88,62,76,
+  76,211,163,27,18,23,41,136,215,126,142,157,52,160,52,208,200,143,74,47,197,215,151,58,189,49,9,55,252,175,213,202,
+  69,191,64,160,90,235,129,161,211,245,21,14,241,46,134,124,78,194,184,181,210,17,32,51,227,130,147,21,140,167,128,105,
+  63,119,219,146,215,156,27,199,4,145,158,168,0,185,4,235,237,149,73,105,114,64,236,40,140,206,169,237,244,202,64,64,
+  227,233,152,43,59,173,51,230,32,202,106,39,5,210,123,252,44,205,23,208,52,128,186,230,129,100,84,97,16,133,129,242,
+};
+
+const uint8 FRAME_CT[3072] = {
+  179,133,177,128,244,55,146,80,160,162,7,217,184,132,238,178,66,231,5,150,74,64,211,17,197,185,16,60,18,43,22,195,
+  178,78,126,233,35,245,178,31,161,30,142,235,214,43,107,147,224,184,175,189,14,188,113,104,210,144,60,19,12,247,237,49,
+  19,40,48,141,209,117,5,113,145,237,135,210,155,213,4,91,163,122,252,211,51,250,142,55,85,209,163,14,135,204,131,110,
+  204,40,150,103,254,210,217,56,40,152,234,126,30,69,202,96,68,177,245,54,29,78,43,95,249,138,152,88,169,44,199,245,
+  44,145,92,216,60,140,28,40,202,19,43,60,244,47,71,252,32,47,59,62,33,229,168,20,20,235,233,15,36,140,59,253,
+  169,254,234,10,100,67,228,50,89,150,116,8,57,67,120,197,103,57,224,125,50,157,83,142,104,229,227,11,21,33,28,80,
+  133,106,27,214,75,241,61,106,173,43,8,129,98,166,28,243,218,14,102,129,171,174,54,221,29,123,18,196,131,195,239,73,
+  11,24,123,13,226,136,9,31,181,178,147,42,189,221,246,122,49,79,224,219,245,148,245,77,149,170,95,7,64,44,134,85,
+  12,109,178,242,75,230,139,88,216,0,193,31,42,14,102,242,104,233,233,73,196,145,149,129,112,103,201,21,36,99,252,127,
+  232,120,110,189,20,110,72,237,32,24,28,41,0,4,98,110,230,186,228,230,127,192,217,38,219,121,90,16,58,42,185,202,
+  25,230,52,8,0,222,43,150,190,246,116,205,212,164,89,173,225,94,0,61,252,48,174,77,243,111,237,193,21,21,16,97,
+  181,222,81,67,68,177,117,188,154,252,126,201,3,201,152,25,155,162,171,167,129,238,104,93,243,116,234,167,190,184,226,115,
+  92,221,8,209,235,19,193,34,3,244,30,141,21,33,110,174,19,22,0,19,175,227,210,132,61,212,112,6,65,65,24,6,
+  22,88,88,68,234,155,97,124,6,176,139,235,244,3,239,128,236,151,73,1,225,39,200,131,163,154,133,226,206,193,61,128,
+  198,244,59,54,58,227,33,229,138,188,223,63,238,215,23,254,82,215,3,28,87,80,119,226,120,223,128,129,118,117,168,199,
+  102,102,233,214,62,225,233,224,233,188,216,121,182,148,100,54,32,80,78,142,247,187,13,3,198,100,127,130,163,106,70,119,
+  252,156,199,103,67,237,142,89,143,208,12,196,22,185,122,177,211,33,228,144,226,55,74,238,206,59,179,14,65,134,248,185,
+  148,247,177,106,137,54,12,122,57,62,215,162,20,240,232,48,78,35,190,2,113,117,10,0,244,33,18,130,237,77,213,183,
+  178,66,206,24,9,106,228,214,141,240,39,254,111,106,203,138,203,65,211,144,38,126,243,161,195,240,130,182,159,173,230,75,
+  98,231,234,134,154,47,224,100,93,203,90,163,65,253,156,58,182,94,199,102,40,17,231,111,162,81,62,189,59,107,231,95,
+  110,56,124,58,47,162,187,125,105,193,104,236,11,94,169,148,208,45,161,212,188,154,179,34,44,50,81,138,87,42,219,48,
+  27,118,18,152,136,117,112,197,204,77,52,116,7,85,46,37,80,45,205,128,187,23,100,244,42,185,245,79,53,138,213,9,
+  44,172,208,245,251,94,125,129,88,217,69,250,124,189,184,67,152,104,245,92,218,159,44,203,78,49,253,241,153,108,244,229,
+  202,30,89,111,113,228,174,145,242,172,156,3,148,242,171,201,131,22,192,207,103,223,196,13,78,122,119,236,92,81,86,57,
+  46,147,146,35,255,180,229,205,188,122,167,252,56,55,174,134,120,208,30,137,83,112,101,67,189,233,226,80,188,59,130,203,
+  44,252,226,25,104,139,1,16,79,49,202,120,242,11,127,96,21,248,48,46,134,59,196,184,13,30,60,213,157,102,55,248,
+  45,104,128,76,48,108,220,238,68,216,92,165,230,206,25,61,244,244,193,147,2,166,11,76,2,147,13,52,76,228,58,246,
+  63,164,128,15,203,218,252,32,122,105,133,48,142,134,16,189,76,5,94,43,69,236,155,99,246,44,26,45,128,35,163,184,
+  37,59,130,69,142,139,190,110,10,249,208,237,90,242,50,145,222,169,104,55,147,201,91,66,134,164,14,56,83,217,217,97,
+  186,105,219,19,199,229,201,29,251,2,241,167,61,164,27,187,155,181,110,172,132,204,240,36,28,168,145,120,23,163,79,152,
+  178,77,232,108,214,138,176,85,104,195,212,21,134,130,161,121,110,98,5,67,95,47,147,4,132,197,143,91,170,118,28,172,
+  237,12,255,136,174,173,85,105,77,63,44,142,71,107,247,66,144,222,127,17,224,15,139,108,125,165,171,182,116,189,35,145,
+  119,231,222,99,185,168,140,239,193,120,177,175,89,95,207,194,101,179,42,202,75,69,252,163,132,206,140,9,13,216,156,224,
+  191,75,105,79,91,209,137,24,34,181,236,200,77,114,220,128,45,210,213,99,213,61,160,81,170,176,115,180,245,89,96,25,
+  157,53,174,79,214,227,23,203,175,211,177,46,27,146,136,9,87,82,7,174,48,179,202,113,32,106,206,75,51,34,154,118,
+  230,199,100,31,110,55,16,111,54,138,199,212,58,159,134,148,155,24,17,109,162,5,64,57,240,135,108,85,154,195,166,9,
+  220,7,71,119,105,236,196,108,41,63,67,227,104,47,97,97,71,107,50,7,161,220,126,101,9,181,176,157,31,169,194,20,
+  16,189,104,198,211,6,108,230,159,40,230,215,31,57,43,151,193,118,6,225,238,107,91,225,194,63,147,124,100,213,177,57,
+  137,183,193,81,138,197,202,214,234,47,172,138,147,64,12,7,32,239,237,121,12,175,90,122,238,9,66,59,246,51,91,218,
+  137,32,168,35,156,203,219,11,116,88,187,245,164,153,149,118,151,88,252,74,73,55,193,34,91,132,198,56,39,243,16,175,
+  69,229,106,121,72,98,187,19,20,51,23,196,187,238,184,106,56,68,213,100,121,21,109,177,21,218,135,60,99,234,151,179,
+  1,206,165,202,135,75,3,218,196,129,45,181,126,144,12,88,188,175,17,143,222,97,237,243,68,125,60,58,129,86,211,123,
+  206,190,180,80,250,93,165,114,175,193,23,34,20,46,191,0,252,207,111,159,247,190,100,87,174,140,108,12,254,47,112,137,
+  195,32,15,5,97,98,98,110,253,124,130,215,204,11,149,134,198,155,211,135,26,99,130,80,113,186,202,249,203,96,21,12,
+  1,164,10,10,226,192,118,184,155,144,237,126,70,181,119,76,54,224,122,68,229,80,67,219,17,0,113,158,78,131,70,64,
+  116,0,109,141,175,1,188,105,6,55,215,157,228,116,244,211,149,129,168,68,69,166,29,250,111,77,69,217,223,50,158,85,
+  50,92,47,211,3,181,43,168,140,117,179,66,146,89,66,215,186,94,228,177,192,103,93,254,173,33,167,211,19,137,246,110,
+  19,234,199,39,99,243,119,189,190,84,189,80,60,81,57,226,74,93,5,224,138,115,141,70,53,79,155,10,23,212,222,206,
+  130,201,233,207,111,115,218,12,106,235,60,187,152,3,96,200,112,130,203,128,206,141,156,218,52,149,107,6,59,16,139,108,
+  114,235,123,60,87,252,23,189,86,15,47,140,183,38,126,46,192,80,99,185,253,243,141,234,71,156,224,119,57,158,72,46,
+  210,249,142,31,194,201,197,245,40,17,223,50,114,28,242,14,229,79,26,91,69,239,88,96,23,84,72,90,137,103,133,12,
+  12,196,4,156,181,239,87,123,66,205,78,236,157,76,112,67,154,22,190,172,130,72,75,89,48,124,230,140,8,248,160,198,
+  115,172,97,46,43,182,235,65,220,83,153,65,211,174,171,181,234,73,13,246,26,2,249,157,29,182,50,221,80,168,140,41,
+  232,212,224,157,193,223,217,140,105,21,76,38,68,243,37,236,231,234,109,28,253,78,226,32,6,229,13,173,113,128,10,189,
+  24,107,254,22,141,223,24,215,229,178,73,13,94,251,182,241,159,255,9,43,29,140,149,52,5,94,127,117,85,17,160,49,
+  227,6,139,206,7,232,21,147,168,174,95,41,180,229,109,35,178,15,87,238,47,163,224,202,56,221,71,239,73,201,236,72,
+  17,47,173,222,30,184,141,150,170,206,12,168,82,141,12,115,233,169,54,65,161,16,17,226,81,149,176,173,69,2,30,66,
+  111,9,136,96,221,165,175,55,221,110,250,39,122,213,204,124,53,205,91,6,50,136,50,228,111,132,96,136,7,166,231,81,
+  72,233,63,35,169,155,154,190,244,236,131,2,168,171,112,115,105,239,193,217,68,102,59,186,6,237,231,155,47,83,219,100,
+  5,105,6,100,151,216,194,198,92,161,131,120,116,178,20,204,50,158,103,229,36,0,161,209,189,152,109,86,93,121,240,194,
+  12,36,127,127,3,169,13,254,133,75,187,143,12,145,34,85,204,185,72,76,68,230,45,67,182,84,13,97,94,235,77,254,
+  30,192,247,20,42,201,194,146,1,79,201,178,211,99,68,178,36,192,61,154,88,130,98,3,132,208,215,197,90,54,223,212,
+  133,4,167,11,193,253,29,111,238,115,235,2,51,168,2,42,159,255,163,24,71,70,230,3,98,216,255,125,64,70,254,110,
+  135,192,58,105,68,164,49,155,205,241,255,28,161,30,66,9,196,143,192,117,121,151,183,235,10,128,173,243,62,139,110,130,
+  84,13,105,68,212,240,201,21,187,230,165,22,51,35,143,212,151,163,248,129,214,12,44,23,196,41,236,13,103,61,206,4,
+  219,173,67,93,200,0,147,88,226,103,174,57,59,128,110,190,101,188,48,223,146,147,207,142,42,119,9,103,225,6,242,154,
+  149,240,138,75,190,27,152,48,164,55,6,110,38,212,173,26,63,76,72,146,247,32,150,16,68,50,230,20,214,185,9,226,
+  189,9,194,58,155,109,179,234,170,10,24,226,214,128,143,247,145,69,241,233,168,66,27,179,66,89,111,40,210,21,207,101,
+  217,175,15,80,34,146,226,85,109,27,64,120,180,28,16,231,96,74,252,144,115,98,131,14,234,121,118,66,47,215,110,110,
+  248,119,187,228,61,128,207,15,250,116,182,249,67,37,115,113,121,16,189,162,116,55,28,174,73,206,118,70,22,235,139,162,
+  116,248,208,14,241,27,142,178,25,208,176,102,198,60,247,13,133,80,233,221,35,143,196,150,90,72,94,240,123,202,8,242,
+  13,185,149,129,119,230,16,253,78,9,184,29,23,93,81,71,236,41,179,139,242,21,152,129,249,249,208,136,123,11,209,176,
+  153,31,31,130,124,55,108,120,102,152,216,20,108,101,120,181,189,70,181,227,135,232,233,188,118,132,176,190,246,114,99,253,
+  130,220,147,78,227,167,5,134,124,121,94,188,27,34,81,162,167,82,117,186,24,173,228,5,145,254,200,146,217,129,160,131,
+  175,123,65,57,197,66,117,221,184,6,115,253,168,137,216,27,98,224,222,245,38,150,189,207,117,37,44,109,195,178,190,224,
+  98,235,21,251,210,21,6,114,158,209,238,0,184,216,66,232,209,68,185,211,20,5,210,98,62,241,227,33,55,28,18,146,
+  224,131,149,57,14,84,191,42,149,120,77,172,100,83,47,225,194,153,62,211,170,24,22,223,129,237,184,98,34,11,117,112,
+  161,90,40,207,101,182,234,95,73,178,207,81,3,58,46,175,136,86,186,171,120,236,19,209,59,39,107,79,26,164,198,166,
+  124,187,77,86,88,159,77,170,38,112,29,51,168,82,174,74,224,218,148,167,79,89,247,101,92,47,173,181,200,178,97,43,
+  118,164,146,128,166,32,216,185,30,46,100,80,155,235,101,98,63,85,68,219,238,254,26,99,167,96,194,65,110,246,130,39,
+  254,67,107,178,27,11,228,111,255,69,235,218,22,131,16,73,173,26,109,253,129,72,207,146,243,28,32,47,29,104,74,109,
+  83,172,163,179,221,37,9,14,41,96,45,237,187,93,124,222,118,216,203,202,80,79,58,78,54,178,69,119,59,146,212,200,
+  244,189,17,153,93,21,17,53,141,246,103,72,203,83,38,175,197,225,226,80,209,190,41,172,21,157,155,96,55,224,37,195,
+  255,76,115,64,250,180,204,200,31,166,106,219,171,198,237,161,110,136,145,193,137,27,44,146,30,133,84,14,42,76,176,118,
+  227,34,40,159,48,126,123,1,29,72,219,41,207,204,177,215,108,135,117,21,148,169,195,235,182,181,221,17,127,183,1,74,
+  250,156,185,21,134,122,109,55,209,240,119,82,149,5,101,154,186,54,109,190,128,218,244,5,91,150,71,44,83,143,242,232,
+  156,11,216,93,72,195,16,12,136,151,232,214,44,3,20,192,250,41,3,147,207,176,151,55,157,77,123,54,106,17,215,145,
+  157,150,164,98,49,85,109,245,240,208,57,217,81,55,43,168,36,82,118,62,12,238,153,192,96,156,118,167,162,203,233,173,
+  253,187,201,146,184,72,169,174,173,34,248,152,14,155,21,126,94,10,61,204,29,206,117,212,55,10,249,189,112,187,70,110,
+  212,57,252,173,133,200,42,217,188,232,45,51,243,217,120,46,7,131,132,28,97,254,176,212,56,23,90,169,52,111,125,72,
+  132,107,27,187,186,110,205,150,184,71,222,205,202,6,124,134,249,203,214,114,234,240,176,78,180,61,116,48,251,70,93,45,
+  33,206,178,24,45,200,21,108,26,180,32,0,63,68,57,250,64,18,99,83,37,145,70,41,81,149,15,149,77,242,135,240,
+  191,84,246,243,144,229,66,213,106,27,24,221,119,141,95,187,98,180,18,200,201,252,1,20,224,58,177,195,13,174,79,228,
+  2,69,203,174,18,111,48,223,205,5,60,163,138,151,153,232,20,227,182,42,130,168,53,151,32,26,162,126,37,84,208,189,
+  67,89,80,61,78,124,48,114,59,161,86,89,78,7,144,53,69,80,64,87,228,196,168,143,83,173,136,66,188,25,216,157,
+  107,213,12,77,123,218,106,28,206,99,221,144,32,115,137,238,241,254,201,62,110,71,202,69,209,151,162,202,254,187,81,70,
+};
+
+// Độ dài lẻ (1000 byte, block cuối 8 byte), cũng qua encrypt_image
+#define ODD_BYTES 1000
+const uint8 ODD_KEY[32] = {
+  1,43,36,178,53,199,152,62,89,228,14,55,132,181,152,50,243,11,47,202,167,42,71,158,172,107,17,152,17,134,122,21,
+};
+
+const uint8 ODD_NONCE[8] = {
+  82,113,185,101,58,185,53,4,
+};
+
+const uint8 ODD_PT[1000] = {
+  0,218,21,61,241,190,211,216,201,247,40,29,22,121,57,52,233,118,146,8,203,206,18,91,190,40,179,58,38,173,47,231,
+  133,122,69,36,60,122,62,219,126,73,241,188,245,3,75,203,191,24,67,63,221,229,169,71,52,168,213,78,220,157,30,131,
+  242,69,239,211,92,162,62,38,34,145,141,150,59,161,255,175,23,52,91,27,167,5,140,160,200,158,13,121,231,67,234,103,
+  9,26,168,133,172,136,220,219,91,173,235,44,188,196,67,182,183,220,187,173,108,90,44,230,16,107,137,39,240,170,7,166,
+  169,125,26,168,242,197,167,158,172,200,13,90,35,233,5,57,232,120,145,254,141,225,188,164,117,176,55,94,0,150,186,105,
+  119,18,27,158,11,154,202,15,18,245,228,106,221,48,160,31,80,18,109,22,18,175,54,165,36,137,164,53,81,42,186,70,
+  120,67,59,23,200,182,161,209,60,42,55,184,62,76,17,67,132,201,86,126,181,123,61,73,116,148,40,142,12,115,81,113,
+  42,209,45,222,190,125,20,120,139,190,114,96,236,208,123,180,143,65,172,136,168,129,184,221,98,230,31,36,204,193,136,205,
+  58,195,98,123,72,73,55,33,108,152,9,45,197,26,83,177,162,2,103,91,91,87,48,175,152,241,23,182,130,57,74,225,
+  229,186,107,96,192,217,237,104,88,126,188,246,84,102,38,7,210,76,252,31,22,107,202,93,85,125,154,128,17,177,141,10,
+  54,189,110,87,223,22,246,225,109,146,230,137,90,70,172,206,120,14,242,236,252,86,126,115,78,123,107,253,62,194,87,189,
+  129,7,2,114,249,22,158,254,120,250,19,84,5,231,218,58,8,163,253,8,209,51,169,222,165,178,199,60,96,171,249,81,
+  40,177,17,38,28,188,135,117,120,235,119,54,121,25,226,226,33,213,184,131,161,100,102,95,94,105,72,61,252,179,116,248,
+  22,162,103,108,189,78,140,159,254,67,241,112,230,12,252,6,115,113,158,81,186,202,40,107,159,222,102,65,107,145,187,192,
+  160,7,65,248,119,72,103,88,94,73,234,46,113,253,36,106,236,132,93,21,120,188,159,101,195,61,29,71,196,192,149,148,
+  90,131,79,60,55,30,35,199,171,131,82,71,31,126,93,163,65,74,124,201,195,204,71,210,52,54,48,196,83,217,220,97,
+  106,182,252,230,101,218,232,63,234,52,162,101,54,62,123,251,185,215,107,133,62,216,177,139,161,142,32,0,138,113,43,243,
+  22,203,51,218,239,62,40,183,162,35,87,24,192,6,59,93,1,196,181,200,141,220,173,96,46,32,196,219,34,119,51,29,
+  16,99,50,62,183,111,99,16,233,90,2,178,115,171,177,197,11,169,131,190,214,199,77,235,78,92,223,187,41,20,251,41,
+  168,203,150,232,26,96,62,59,31,103,27,182,136,127,182,47,206,178,4,46,102,21,82,68,205,205,155,68,197,31,57,234,
+  114,60,96,211,240,185,10,148,168,33,97,39,0,207,196,90,5,16,83,54,40,37,243,179,251,113,186,161,139,145,173,67,
+  212,163,119,58,7,101,187,167,188,66,135,29,47,216,114,197,147,61,56,125,52,185,111,196,49,111,131,198,67,254,14,138,
+  105,204,7,208,80,241,138,158,131,96,103,15,18,77,134,31,234,243,206,147,63,72,162,234,95,23,228,203,114,233,197,228,
+  129,171,195,123,53,128,250,212,145,119,36,250,149,111,5,182,18,4,165,183,212,50,116,251,91,226,4,135,162,27,148,192,
+  73,96,110,43,230,76,136,145,97,1,63,87,201,200,183,148,76,202,113,159,221,207,221,117,242,216,122,74,177,77,123,192,
+  61,141,209,178,193,255,238,253,191,61,218,15,253,125,200,232,201,90,60,66,69,155,118,59,38,208,153,24,141,96,183,47,
+  97,84,246,79,197,198,14,217,1,167,52,148,79,250,22,236,7,200,228,137,71,173,77,202,88,21,14,67,194,119,229,223,
+  151,119,47,246,175,236,115,92,85,2,238,125,9,149,218,190,199,0,113,122,104,108,157,72,119,122,160,14,129,139,142,43,
+  78,48,168,147,136,249,174,197,3,109,174,157,168,105,119,253,2,253,136,34,108,156,106,150,41,72,51,164,198,80,156,205,
+  17,58,165,10,103,99,73,121,254,95,80,166,222,136,7,112,221,190,120,172,148,208,84,55,126,90,7,59,217,21,189,147,
+  115,183,124,165,6,112,109,206,119,130,104,191,77,71,147,33,240,141,6,111,66,170,105,82,93,88,127,75,43,144,234,128,
+  235,44,198,13,14,14,230,36,
+};
+
+const uint8 ODD_CT[1000] = {
+  137,211,85,103,186,227,181,31,92,141,33,211,122,175,89,175,182,197,128,153,110,153,155,37,176,166,125,106,82,2,231,155,
+  61,108,151,176,154,84,157,252,115,103,118,85,171,104,107,237,174,243,80,37,202,204,49,131,167,220,143,88,207,59,221,247,
+  104,173,81,117,10,83,76,156,97,110,123,40,251,138,14,235,157,204,87,5,37,213,34,108,217,70,107,202,250,132,121,215,
+  94,131,11,131,32,48,76,105,98,75,241,212,58,117,102,77,145,166,141,67,92,60,103,10,153,62,184,84,112,172,244,79,
+  46,0,164,143,77,132,148,7,144,212,210,88,234,76,125,67,159,109,96,131,45,138,186,74,61,34,211,120,155,80,125,5,
+  227,209,111,192,171,77,192,189,174,5,86,113,42,250,79,214,20,69,107,83,26,39,208,29,87,242,59,112,114,81,54,42,
+  165,148,97,134,70,54,126,117,106,129,241,84,178,220,239,138,119,183,234,36,11,46,185,227,112,113,42,25,199,193,216,9,
+  82,38,200,42,145,52,106,198,87,20,21,50,147,207,59,215,198,63,172,143,141,50,48,185,189,230,49,146,98,178,126,122,
+  58,202,79,238,34,105,201,30,157,155,2,133,3,230,205,5,195,235,22,116,162,246,94,130,253,109,184,253,66,42,127,28,
+  234,24,77,122,40,114,254,249,36,164,111,160,192,33,101,95,76,6,192,231,164,102,184,235,245,80,148,6,156,196,22,74,
+  197,96,76,33,77,246,25,86,70,133,50,31,3,72,77,203,24,13,15,19,157,253,65,13,117,35,146,203,12,158,6,86,
+  208,125,222,186,41,236,103,191,232,56,97,207,211,167,188,190,217,91,7,80,22,19,140,204,162,78,212,89,91,201,187,113,
+  105,68,205,218,220,125,90,148,174,255,235,105,12,122,227,10,234,5,19,210,148,215,254,24,40,244,126,239,212,149,132,91,
+  187,222,220,198,228,182,123,235,228,44,221,39,86,151,83,11,9,108,173,109,186,125,152,234,253,251,224,64,27,182,192,252,
+  165,4,23,73,233,161,48,125,225,165,225,112,56,194,215,106,46,94,106,126,238,97,117,101,216,39,15,242,37,215,48,233,
+  216,32,106,78,7,211,8,194,164,244,233,8,33,90,113,70,235,224,58,149,36,19,24,160,49,108,125,56,40,149,129,241,
+  248,53,166,223,167,18,171,233,157,152,85,106,129,67,14,21,241,61,89,149,187,10,132,33,144,192,65,121,133,53,115,165,
+  79,24,249,237,182,110,63,49,147,143,140,102,93,84,169,7,81,114,228,249,125,183,231,126,250,176,40,240,47,198,114,0,
+  109,113,66,112,220,182,125,87,114,104,111,127,180,24,181,138,167,81,215,229,176,72,66,129,235,232,155,27,38,177,72,165,
+  176,163,13,70,252,84,101,134,227,206,93,99,51,140,230,37,231,143,199,198,211,240,82,101,47,159,216,113,246,79,126,92,
+  90,212,157,67,4,109,155,2,232,162,84,176,188,106,194,81,104,62,175,177,89,70,172,64,139,13,248,223,13,123,29,24,
+  199,205,91,22,176,198,144,41,112,177,33,15,164,208,7,114,158,91,106,181,72,157,94,155,223,244,240,32,203,204,4,50,
+  198,135,29,160,126,223,39,117,155,15,150,87,173,97,173,39,167,185,71,63,44,7,246,148,8,176,9,51,143,13,152,16,
+  194,129,197,111,117,158,44,178,185,179,190,197,108,54,163,81,23,249,237,95,149,119,190,178,28,197,51,76,237,155,237,59,
+  245,44,215,220,112,36,100,94,62,122,208,102,233,38,161,188,89,231,92,151,122,91,53,168,44,85,196,187,155,90,1,71,
+  244,103,155,3,40,100,143,243,42,103,106,61,181,130,137,49,69,194,238,39,241,48,115,144,128,39,43,44,165,213,17,228,
+  150,30,95,52,104,143,176,194,8,201,188,255,240,175,155,29,131,116,124,196,238,135,65,33,35,204,142,191,168,122,193,78,
+  84,121,63,9,82,78,94,66,231,57,40,122,28,25,237,14,201,255,33,105,45,158,143,67,91,89,20,102,37,221,175,236,
+  24,66,151,161,117,7,46,253,216,182,57,189,180,245,171,225,119,100,241,47,128,253,128,146,185,67,67,40,178,49,72,97,
+  81,113,74,38,177,13,35,123,193,125,24,98,109,109,154,66,87,111,135,54,230,66,108,169,133,40,7,144,228,121,97,18,
+  93,222,157,138,125,160,122,102,154,249,31,41,139,252,6,94,31,70,231,114,46,89,3,47,29,81,65,1,197,149,198,244,
+  139,28,229,46,247,204,240,84,
+};
+
+// GCM spec Test Case 16 (AES-256, IV 96 bit, AAD 20 byte, pt 60 byte)
+const uint8 GCM16_KEY[32] = {
+  254,255,233,146,134,101,115,28,109,106,143,148,103,48,131,8,254,255,233,146,134,101,115,28,109,106,143,148,103,48,131,8,
+};
+
+const uint8 GCM16_IV[12] = {
+  202,254,186,190,250,206,219,173,222,202,248,136,
+};
+
+const uint8 GCM16_AAD[20] = {
+  254,237,250,206,222,173,190,239,254,237,250,206,222,173,190,239,171,173,218,210,
+};
+
+const uint8 GCM16_PT[60] = {
+  217,49,50,37,248,132,6,229,165,89,9,197,175,245,38,154,134,167,169,83,21,52,247,218,46,76,48,61,138,49,138,114,
+  28,60,12,149,149,104,9,83,47,207,14,36,73,166,181,37,177,106,237,245,170,13,230,87,186,99,123,57,
+};
+
+const uint8 GCM16_CT[60] = {
+  82,45,193,240,153,86,125,7,244,127,55,163,42,132,66,125,100,58,140,220,191,229,192,201,117,152,162,189,37,85,209,170,
+  140,176,142,72,89,13,187,61,167,176,139,16,86,130,136,56,197,246,30,99,147,186,122,10,188,201,246,98,
+};
+
+const uint8 GCM16_TAG[16] = {
+  118,252,110,206,15,78,23,104,205,223,136,83,187,45,85,27,
+};
+
+// Frame 32x32x3 (FRAME_PT / FRAME_KEY), AAD = header frame 8 byte, pycryptodome AES.MODE_GCM
+const uint8 GCM_FRAME_IV[12] = {
+  16,17,18,19,20,21,22,23,24,25,26,27,
+};
+
+const uint8 GCM_FRAME_AAD[8] = {
+  0,0,0,7,0,32,0,32,
+};
+
+const uint8 GCM_FRAME_CT[3072] = {
+  25,8,60,78,220,128,46,47,40,192,62,225,161,59,118,45,232,102,252,220,200,47,6,121,29,204,89,119,152,86,187,155,
+  195,227,38,95,54,146,154,35,180,117,105,158,145,44,142,55,63,64,220,163,21,23,60,164,184,235,167,124,31,8,90,128,
+  4,129,168,147,51,254,74,199,98,188,109,36,252,64,0,78,152,33,232,3,231,28,54,98,123,122,11,131,220,43,230,15,
+  73,43,184,147,207,139,139,194,154,55,217,116,138,146,185,186,117,13,105,103,249,237,233,35,17,169,76,128,177,74,81,71,
+  56,138,209,130,160,158,21,241,133,126,52,168,253,123,154,136,138,178,52,166,208,100,216,10,47,183,53,207,184,204,212,5,
+  192,155,4,163,88,101,30,1,134,168,194,249,201,15,27,73,203,125,245,21,78,174,12,134,127,18,212,142,184,52,60,215,
+  195,106,28,121,102,92,91,244,83,115,18,227,227,33,250,250,93,171,83,116,185,110,135,29,193,140,82,29,34,49,46,39,
+  54,221,142,250,106,168,9,134,188,170,72,248,25,246,71,137,52,242,20,55,45,232,33,55,74,50,139,196,129,146,171,154,
+  64,156,198,162,130,131,217,159,108,93,172,20,190,8,69,37,225,177,254,119,38,88,253,41,223,243,136,46,179,127,35,24,
+  7,249,181,15,230,212,229,196,58,228,61,47,88,85,178,8,26,134,247,211,28,194,79,0,71,184,37,240,56,77,110,43,
+  183,132,145,255,100,201,198,246,235,95,9,108,234,35,242,237,175,206,59,235,127,203,2,3,43,154,2,198,85,180,69,19,
+  18,214,61,74,182,47,123,73,5,217,125,205,239,178,72,182,108,150,220,186,106,135,195,50,2,245,89,99,102,137,197,80,
+  125,0,254,216,127,231,253,41,106,161,118,231,59,147,195,123,109,208,42,25,149,202,181,92,3,171,201,103,113,68,233,140,
+  188,88,254,101,190,216,192,55,114,78,91,54,235,247,117,113,232,146,87,194,195,112,66,140,75,41,48,134,245,206,226,197,
+  98,171,127,127,148,173,138,7,75,116,205,22,161,230,192,122,221,83,69,129,38,10,246,181,231,98,186,170,169,137,221,202,
+  176,38,207,75,96,16,244,144,43,156,224,55,28,183,23,206,62,179,51,219,163,9,29,205,244,88,171,200,83,156,180,140,
+  73,126,65,93,224,55,145,38,233,19,27,226,145,165,131,193,65,8,193,216,77,159,52,234,13,94,32,197,96,108,103,142,
+  165,247,138,101,73,91,212,49,54,157,158,157,23,210,185,51,31,238,120,66,99,85,232,43,39,228,45,251,1,189,168,123,
+  151,0,93,200,122,91,9,35,46,91,37,162,50,230,89,204,149,12,29,142,42,22,172,134,244,0,103,9,157,180,247,110,
+  138,40,181,174,142,29,36,61,74,201,129,146,240,207,144,251,131,88,187,141,94,104,183,28,37,111,196,138,63,134,248,84,
+  8,123,172,4,47,66,134,104,61,85,168,55,121,73,122,31,53,195,147,55,82,92,176,6,14,1,81,255,12,136,98,25,
+  220,181,115,240,197,247,231,107,71,235,255,155,21,134,123,242,170,153,113,197,148,111,38,235,194,205,254,141,16,227,194,186,
+  45,191,119,224,90,15,51,145,219,138,69,34,243,249,160,98,221,9,214,141,70,13,41,144,193,97,33,235,214,115,93,92,
+  116,200,76,143,166,158,176,194,186,95,218,81,72,111,184,87,122,67,224,149,27,112,228,144,40,205,92,218,135,176,160,53,
+  33,172,81,22,88,235,52,24,110,27,100,17,11,240,119,146,179,113,142,28,192,233,185,22,135,19,135,154,72,39,58,214,
+  177,171,218,151,186,78,83,83,134,86,13,163,166,1,130,40,2,118,194,123,234,211,50,204,218,136,231,14,94,254,191,103,
+  10,40,162,230,113,248,141,163,72,210,161,61,48,224,82,244,192,255,163,138,140,104,174,96,171,240,63,36,81,147,173,131,
+  76,86,200,37,189,218,80,19,238,126,41,61,16,57,171,19,93,172,121,234,72,129,70,140,109,235,211,157,79,225,146,202,
+  31,78,239,21,66,103,131,112,39,243,63,66,176,247,213,86,95,189,150,26,194,198,18,12,178,18,220,29,162,167,193,133,
+  217,5,119,39,10,19,60,245,5,227,6,109,246,170,231,91,213,214,31,211,144,240,113,205,4,143,254,6,121,23,237,230,
+  81,25,7,190,190,45,7,172,26,242,180,254,131,79,84,70,193,232,241,248,62,43,188,37,209,190,185,183,48,94,72,245,
+  34,18,233,27,11,177,151,111,83,37,182,202,110,61,7,70,170,148,148,174,106,20,223,255,162,244,184,214,208,233,60,63,
+  87,18,252,30,67,35,239,188,112,6,54,142,197,63,205,250,192,12,22,154,110,38,69,72,50,7,136,52,198,84,24,26,
+  61,211,195,74,123,185,83,17,10,252,144,199,195,5,65,149,108,189,29,150,46,171,96,206,32,246,47,199,96,14,253,154,
+  251,101,2,53,171,99,73,116,171,195,21,93,237,127,188,2,160,142,23,4,237,208,48,173,192,178,84,142,24,33,78,0,
+  120,239,89,35,185,30,222,196,155,15,84,72,200,204,202,153,17,92,55,109,116,80,161,248,42,15,113,211,242,187,56,43,
+  228,144,144,109,146,245,91,224,119,37,2,172,84,176,214,25,199,239,190,107,154,164,213,83,73,182,18,134,145,51,126,12,
+  114,35,245,173,176,36,199,78,56,14,42,21,97,126,123,152,149,76,229,67,29,2,226,253,235,180,90,43,112,152,192,60,
+  79,19,218,12,178,27,183,160,135,254,7,137,205,111,106,246,20,118,201,97,14,57,204,92,108,60,98,130,39,83,64,31,
+  136,93,204,193,164,25,3,177,65,185,60,130,13,213,44,89,207,244,156,140,107,131,103,34,198,116,86,123,190,215,4,255,
+  54,79,61,187,71,76,251,191,216,249,74,119,116,118,140,132,229,29,150,213,4,177,182,8,251,1,203,11,254,86,156,0,
+  234,158,63,3,187,254,239,100,166,80,194,205,70,140,17,35,228,16,225,160,105,213,237,160,231,103,16,205,253,86,107,6,
+  62,79,223,248,158,193,213,162,234,50,19,18,160,117,99,88,31,117,140,19,202,16,22,146,127,85,96,14,47,119,94,123,
+  65,134,136,236,103,65,10,151,67,148,233,227,37,83,228,215,253,19,7,173,58,109,60,186,110,76,113,16,210,207,112,95,
+  246,117,240,88,100,80,84,89,241,107,138,210,183,27,47,30,21,146,52,50,170,13,153,227,34,134,75,191,73,17,218,65,
+  11,68,12,124,141,198,131,199,212,215,241,88,207,131,141,23,136,65,124,30,12,161,246,113,129,29,222,88,230,96,142,93,
+  84,183,86,161,193,107,70,91,178,120,90,54,30,74,241,245,96,4,184,255,8,120,137,252,197,124,70,199,48,131,46,14,
+  3,154,238,162,38,169,189,224,183,138,116,150,192,114,211,74,145,234,208,138,68,143,132,30,14,164,20,201,165,90,8,249,
+  1,221,127,242,164,13,59,247,2,165,31,170,157,210,145,143,37,55,136,227,143,142,219,203,5,110,76,17,25,12,69,110,
+  252,225,168,15,102,155,105,145,242,234,94,70,201,225,143,110,73,116,27,59,38,105,179,233,21,16,133,227,119,104,153,131,
+  38,218,75,54,223,130,192,102,103,70,163,106,63,252,205,112,104,56,3,220,133,174,249,137,89,124,84,141,45,75,171,119,
+  255,122,66,4,104,160,71,194,109,17,212,145,159,75,58,93,63,168,35,57,15,242,73,79,251,138,243,181,166,238,231,34,
+  234,130,171,119,209,50,4,133,222,102,4,50,81,108,160,255,199,69,11,209,215,238,47,39,88,60,23,190,226,54,224,231,
+  45,141,135,89,222,144,196,106,168,160,213,212,63,220,25,227,252,184,249,203,221,178,244,178,132,116,62,232,99,126,224,249,
+  111,130,232,30,116,46,65,96,180,23,196,170,192,160,244,128,153,102,117,0,21,176,12,202,51,199,167,100,38,210,169,26,
+  110,184,25,137,76,98,8,184,29,157,24,73,88,22,144,58,20,216,171,213,73,178,249,37,223,221,124,27,26,21,73,186,
+  120,89,80,60,103,164,154,150,250,71,133,202,234,138,72,102,134,218,142,70,20,216,7,87,189,127,236,4,144,22,191,91,
+  122,139,184,80,124,68,197,215,194,41,121,161,156,225,179,26,118,24,183,40,206,57,228,194,59,220,83,143,75,241,176,122,
+  44,222,175,201,81,97,102,182,143,171,29,97,138,205,27,33,130,187,249,13,182,60,112,172,137,134,163,39,156,240,229,36,
+  135,161,176,212,6,186,246,153,247,93,86,33,145,118,209,147,232,54,24,226,137,127,249,186,116,41,32,126,227,244,159,203,
+  11,223,110,151,248,116,70,241,177,120,92,16,80,22,70,60,183,187,202,67,77,253,212,236,51,75,206,83,42,98,64,141,
+  170,115,11,152,241,74,186,57,86,202,183,104,191,191,138,88,237,239,181,37,254,161,155,17,202,199,196,233,115,204,96,173,
+  94,35,146,143,72,34,78,144,173,192,221,236,164,76,252,34,161,53,236,38,158,128,167,182,3,125,195,165,85,85,28,95,
+  222,59,248,215,84,36,208,12,152,29,30,107,226,231,59,7,157,75,87,249,233,51,1,240,46,39,168,143,190,251,147,95,
+  84,55,114,170,249,151,73,247,7,160,129,184,136,16,131,99,198,227,109,79,76,54,218,223,186,69,70,217,32,109,212,20,
+  200,75,148,107,41,124,3,240,122,24,172,185,77,169,196,3,182,113,140,198,237,76,60,195,163,172,237,41,87,203,89,222,
+  131,147,73,64,45,252,125,116,4,251,93,56,214,158,192,39,51,234,144,125,139,77,34,146,220,18,119,255,102,158,236,114,
+  76,103,89,155,75,216,234,232,71,111,107,171,61,9,43,85,185,92,83,191,135,46,38,65,67,54,197,111,43,209,39,163,
+  0,152,115,83,98,13,98,91,38,190,88,96,31,63,56,197,131,184,31,89,68,138,26,89,79,247,158,207,33,220,50,18,
+  156,227,92,14,149,133,112,180,129,74,194,45,112,15,17,100,9,116,216,124,76,16,153,121,13,65,45,29,252,147,221,121,
+  167,239,184,248,159,64,91,107,144,109,107,193,30,174,131,167,98,93,216,73,187,182,200,15,97,27,6,188,198,215,37,54,
+  183,100,194,203,57,220,248,188,23,248,139,54,86,14,120,48,135,111,248,84,100,61,206,128,71,231,142,218,51,14,139,206,
+  125,217,64,213,22,49,118,146,69,21,181,71,188,255,169,227,226,181,242,52,52,90,4,152,75,152,196,204,80,216,54,148,
+  75,123,78,222,36,132,162,120,59,123,98,252,71,234,76,4,231,13,128,82,34,101,216,24,149,24,231,11,96,75,39,80,
+  222,180,113,144,45,224,115,127,40,23,39,221,187,181,117,108,234,91,83,39,25,237,83,151,34,146,70,27,41,193,37,86,
+  17,25,192,185,164,201,139,146,186,234,193,224,157,178,252,187,107,178,246,25,6,71,204,141,186,121,46,207,132,174,227,21,
+  88,99,255,99,84,145,59,224,179,160,130,194,248,125,40,110,26,94,47,221,240,85,229,230,168,111,15,72,60,63,4,52,
+  114,173,194,239,144,251,4,80,18,156,99,89,213,100,153,181,185,38,70,227,108,25,62,142,102,216,142,247,191,97,131,213,
+  182,176,197,124,224,29,191,125,129,146,254,171,118,251,35,58,99,9,49,45,127,6,75,221,30,115,27,67,32,164,32,28,
+  197,122,107,159,109,71,210,227,225,62,88,243,24,35,102,41,110,27,89,187,54,142,124,21,227,229,231,106,62,74,169,102,
+  217,180,57,99,154,101,118,148,246,140,29,22,113,117,36,42,63,167,213,93,138,43,153,8,45,107,88,128,128,37,85,170,
+  243,198,232,76,0,40,165,239,61,133,243,255,86,11,35,45,223,63,191,26,159,166,86,182,130,192,223,192,111,40,87,37,
+  148,222,10,126,110,200,246,187,63,149,227,4,231,124,93,84,162,251,208,94,124,120,216,107,39,174,209,160,83,149,126,52,
+  26,154,178,216,82,90,142,216,106,152,80,107,192,237,2,135,178,27,216,8,238,25,24,173,176,78,248,209,3,145,227,40,
+  234,172,225,143,223,47,146,2,107,159,31,207,63,194,244,74,131,51,125,219,59,169,251,113,21,78,41,83,181,90,46,177,
+  85,185,31,36,9,172,56,95,182,85,156,237,92,96,203,239,20,231,248,242,204,211,244,91,166,244,233,154,242,171,72,67,
+  110,8,251,45,154,74,253,158,101,17,163,14,222,234,212,40,79,108,191,73,6,133,60,91,20,145,143,149,95,156,115,240,
+  81,176,120,10,14,206,213,56,209,78,136,236,247,171,194,6,102,215,229,156,120,76,113,97,125,218,13,79,58,201,93,216,
+  75,177,94,83,27,98,125,189,22,126,116,156,209,229,44,223,26,61,248,117,175,175,14,202,151,235,254,111,208,156,87,207,
+  18,22,118,180,33,183,37,190,95,43,132,11,234,80,144,97,102,30,74,198,25,177,181,12,173,124,89,121,179,126,194,112,
+  127,201,106,209,253,152,65,118,56,168,1,146,187,39,132,220,80,82,198,165,41,45,171,165,227,72,30,161,82,12,30,31,
+  47,192,164,58,253,125,27,189,75,205,63,166,209,178,219,17,254,229,138,227,175,95,240,161,10,150,141,46,101,197,58,39,
+  127,107,180,208,150,120,81,222,244,179,207,197,189,213,192,156,178,151,131,114,69,110,159,208,182,184,44,112,237,101,102,199,
+  173,244,210,133,130,253,63,146,28,160,111,93,53,241,79,7,182,245,128,131,234,22,66,255,183,190,10,55,107,52,43,49,
+  238,10,108,89,147,83,143,101,43,129,31,223,98,95,163,226,241,154,206,125,133,119,100,185,2,116,13,2,4,179,207,228,
+  39,200,0,177,59,251,146,176,249,201,173,83,125,81,226,238,225,10,235,171,177,222,146,57,4,16,242,170,69,95,67,177,
+};
+
+const uint8 GCM_FRAME_TAG[16] = {
+  55,237,36,89,250,69,41,77,214,151,143,204,125,172,175,3,
+};
+
+// ODD_PT / ODD_KEY, không có AAD
+const uint8 GCM_ODD_IV[12] = {
+  170,76,83,47,198,67,78,147,194,232,86,118,
+};
+
+const uint8 GCM_ODD_CT[1000] = {
+  182,141,35,46,156,12,240,18,171,134,127,209,32,254,230,211,188,66,228,173,186,78,43,17,163,40,232,35,244,231,111,31,
+  222,155,3,100,13,134,135,153,15,119,169,43,218,190,232,56,140,147,42,112,131,136,148,119,142,22,167,24,117,122,202,180,
+  62,161,94,53,1,148,16,237,208,148,214,198,205,134,176,12,120,130,159,132,44,214,210,4,30,101,80,243,224,254,208,57,
+  121,51,122,47,89,188,168,213,232,3,238,21,161,141,160,136,243,76,200,72,0,4,30,135,89,22,109,74,195,15,234,38,
+  147,179,166,113,166,120,159,72,118,134,249,133,245,88,207,110,184,22,216,169,0,97,195,246,90,106,93,32,148,69,149,161,
+  90,78,83,26,84,197,168,243,184,100,62,127,121,45,121,90,26,132,69,170,154,173,129,225,179,109,150,193,201,97,107,17,
+  60,152,224,79,189,118,201,81,89,183,58,78,0,129,86,244,154,208,103,112,8,38,157,138,254,241,111,0,74,116,51,82,
+  37,38,181,83,122,247,61,152,154,54,152,109,69,63,148,248,21,239,108,137,3,56,244,39,2,114,133,16,62,250,54,12,
+  155,153,209,72,71,140,122,244,230,85,80,249,230,216,194,244,114,158,124,52,24,248,105,128,113,176,49,150,26,148,53,171,
+  72,85,185,68,186,133,49,94,14,159,23,10,160,187,239,146,31,11,154,204,231,109,73,28,225,232,95,97,12,111,225,244,
+  164,204,16,40,254,88,127,178,128,147,248,21,115,50,158,122,223,19,145,141,39,28,150,74,192,92,212,21,61,41,116,22,
+  107,234,88,155,129,213,44,145,235,142,99,81,52,248,65,84,224,223,95,139,237,192,237,127,171,149,46,67,155,38,219,75,
+  113,110,228,251,166,113,74,14,197,131,130,70,187,138,145,160,250,29,182,34,23,252,81,186,252,188,39,200,178,15,140,212,
+  217,14,64,1,162,108,88,238,143,122,39,182,87,10,15,116,149,169,251,73,96,18,94,177,54,35,234,225,170,185,188,18,
+  227,217,148,146,188,158,242,172,34,224,227,126,214,126,244,71,175,76,233,191,209,211,49,241,145,112,121,65,145,213,42,227,
+  202,12,143,34,127,153,44,184,204,79,20,33,63,208,82,153,62,27,101,168,200,147,76,12,96,200,127,20,64,123,91,119,
+  232,254,211,109,42,119,33,170,19,137,114,250,14,3,236,2,182,108,9,138,43,217,247,160,249,151,172,171,169,245,38,176,
+  234,133,198,179,74,121,6,242,144,54,82,17,176,31,245,23,178,251,49,22,226,210,245,64,181,147,103,177,170,183,29,210,
+  236,120,16,246,121,39,25,1,93,136,250,11,178,7,119,212,129,194,79,228,254,49,236,198,76,88,57,203,91,181,234,208,
+  204,53,122,34,27,206,148,127,163,151,164,72,226,10,99,132,47,137,38,206,176,43,157,70,219,108,214,206,207,1,51,26,
+  236,97,196,88,157,95,51,16,249,67,52,5,176,15,5,48,130,191,213,36,107,197,68,25,234,6,49,39,103,237,235,207,
+  247,62,166,65,202,185,134,191,25,2,128,67,3,145,138,174,60,42,109,193,72,198,15,208,166,253,210,75,8,221,87,253,
+  177,144,148,63,20,47,81,111,54,121,141,95,167,74,104,132,250,194,50,67,42,138,122,40,1,158,45,33,118,91,215,124,
+  242,224,113,7,200,158,234,254,106,134,81,7,253,246,245,168,151,207,156,189,34,57,48,178,19,212,215,143,79,26,202,58,
+  235,130,113,21,178,145,223,20,191,145,154,15,153,83,75,112,250,255,80,32,172,205,109,117,108,73,83,177,98,154,30,202,
+  68,94,176,165,154,249,97,29,66,59,131,184,49,36,103,17,196,145,22,140,224,88,200,99,38,109,21,48,46,155,28,122,
+  237,230,90,64,26,55,177,197,127,241,224,177,81,61,30,187,55,14,15,176,85,174,78,3,217,49,35,249,125,175,227,94,
+  204,210,238,109,143,248,122,198,150,150,120,92,226,2,173,13,76,216,191,79,223,34,158,205,102,101,83,108,232,209,87,180,
+  180,144,194,237,116,88,167,188,41,114,81,36,9,123,162,194,88,180,5,175,122,224,255,148,42,211,88,16,186,162,221,86,
+  65,254,153,210,179,215,126,83,200,82,67,114,51,45,118,24,158,102,212,42,117,204,145,250,145,70,46,84,153,119,243,143,
+  121,140,224,84,157,249,157,181,66,108,132,242,147,221,1,128,255,208,127,50,83,83,74,204,76,94,139,175,227,154,103,201,
+  214,78,8,226,59,186,208,7,
+};
+
+const uint8 GCM_ODD_TAG[16] = {
+  175,180,179,227,223,89,192,182,242,114,53,85,104,147,113,106,
+};
+
+// Keccak duplex (AES_CTR/Duplex_Lib.py): FRAME_PT / FRAME_KEY, nonce 16 byte
+const uint8 DX_FRAME_NONCE[16] = {
+  32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,
+};
+
+const uint8 DX_FRAME_CT[3072] = {
+  0,77,204,35,250,109,242,190,20,25,159,149,192,29,132,4,152,142,25,77,127,15,232,86,19,1,2,108,23,175,238,136,
+  109,67,125,16,49,61,255,173,243,227,140,78,195,5,100,250,217,36,181,181,130,29,150,202,96,107,124,16,224,3,115,82,
+  71,98,26,252,224,214,140,137,58,148,140,172,187,15,64,63,239,220,238,251,192,132,10,50,165,83,164,203,183,91,250,199,
+  106,144,88,232,191,31,138,99,195,126,168,146,231,136,158,191,95,47,90,241,210,207,161,165,51,150,228,71,145,63,163,149,
+  109,250,236,160,84,219,119,171,147,250,51,195,193,180,195,148,187,121,22,227,30,26,196,8,153,202,210,76,0,131,57,35,
+  62,213,93,150,35,44,2,73,109,190,15,89,229,218,141,94,252,117,29,135,91,66,121,34,208,246,214,6,69,2,99,7,
+  175,46,11,125,2,255,206,26,12,57,183,10,120,4,157,160,81,140,133,13,61,104,216,127,193,84,164,73,72,171,166,53,
+  229,134,135,236,182,27,92,36,218,104,80,100,244,18,185,157,64,106,88,74,31,236,146,208,96,133,50,178,68,187,57,183,
+  152,133,224,165,167,41,197,83,61,99,169,101,130,77,147,61,229,152,244,252,1,164,242,186,108,39,231,22,94,110,242,201,
+  41,62,105,137,86,64,120,207,155,185,219,94,80,5,32,221,170,48,102,243,192,22,89,199,133,37,168,135,22,179,184,214,
+  255,133,233,185,113,145,10,80,191,8,234,23,43,134,66,80,98,236,61,68,175,210,52,63,42,92,100,251,183,87,254,154,
+  22,133,133,64,82,171,68,56,225,92,232,85,251,37,91,242,120,116,38,101,86,123,225,139,158,219,208,32,34,187,220,130,
+  231,115,211,33,172,21,157,152,134,37,173,239,88,244,27,226,138,177,176,187,129,26,149,57,180,165,0,91,88,48,211,14,
+  227,61,93,111,139,174,213,25,175,100,79,1,186,51,80,216,93,203,239,167,52,142,101,100,80,250,248,245,4,190,123,131,
+  189,212,32,137,146,191,128,242,78,130,46,53,87,52,153,145,27,150,244,177,3,85,171,171,209,185,249,221,234,98,139,226,
+  136,39,121,249,21,131,6,108,239,221,168,147,175,238,15,14,175,15,140,81,200,109,40,16,186,126,254,74,27,227,123,85,
+  28,79,170,228,103,69,166,104,14,155,239,176,148,234,78,131,24,159,213,159,88,3,143,188,21,138,101,208,31,24,233,47,
+  136,222,190,8,159,180,191,112,4,44,75,38,166,107,8,156,70,255,134,124,166,208,145,17,70,10,157,183,15,145,161,120,
+  178,101,30,205,137,79,34,209,140,98,51,113,217,154,121,52,153,199,38,113,194,89,221,221,18,238,232,122,249,199,11,237,
+  237,194,102,147,224,93,202,165,52,33,191,222,173,227,185,78,195,224,215,163,30,188,175,213,80,180,140,184,181,5,154,52,
+  31,7,153,2,233,148,130,138,17,120,240,16,91,130,123,117,136,96,146,39,7,49,27,138,140,13,158,177,197,225,29,31,
+  41,192,134,9,240,89,255,107,162,45,152,140,110,227,187,68,123,156,157,137,7,250,100,34,86,120,44,213,215,2,136,146,
+  126,188,30,128,177,212,180,243,136,16,27,220,99,80,106,1,189,26,38,106,12,196,163,238,112,159,102,129,7,108,17,253,
+  132,89,221,71,61,194,52,162,37,62,15,79,3,183,220,49,147,158,36,245,86,25,174,250,120,233,199,21,41,85,220,183,
+  80,143,227,188,115,35,168,123,9,252,23,201,119,215,38,82,207,82,241,19,191,52,60,127,197,139,201,28,242,200,82,103,
+  66,170,22,103,145,185,43,143,74,126,189,59,148,53,63,139,168,107,10,147,187,125,55,30,180,209,84,64,237,7,54,241,
+  124,240,252,95,156,238,2,22,127,83,134,130,252,226,47,2,234,245,188,139,245,86,211,126,246,145,92,185,248,88,50,78,
+  202,241,19,60,172,252,119,149,198,59,255,39,152,240,138,155,199,219,163,186,76,131,59,41,172,31,30,141,16,42,42,59,
+  237,218,59,186,17,201,104,165,222,239,186,192,69,149,25,196,18,235,10,239,192,33,165,83,109,185,14,100,215,167,224,46,
+  82,115,139,132,196,203,105,47,189,113,96,92,192,60,44,84,62,200,13,48,248,102,77,87,14,155,135,216,138,208,244,7,
+  38,166,117,150,113,235,55,20,98,128,76,126,123,212,135,141,163,176,103,65,60,254,177,183,219,89,169,173,228,56,139,109,
+  77,71,216,57,140,146,221,73,154,87,21,172,68,193,226,236,131,48,118,53,20,61,30,225,174,84,42,184,31,198,163,176,
+  86,211,194,242,143,17,255,225,97,54,177,97,8,227,192,221,105,182,239,14,219,248,30,120,66,198,176,53,198,223,129,143,
+  202,47,240,82,103,241,255,215,129,99,228,163,47,36,206,170,104,231,81,156,181,103,221,141,177,130,111,38,112,182,49,69,
+  190,47,86,95,60,137,224,115,14,57,135,108,124,243,45,150,26,19,217,46,23,32,5,17,234,30,223,3,13,114,22,229,
+  12,125,253,124,161,224,11,28,227,142,90,75,53,219,176,85,196,69,110,210,198,239,252,89,93,82,104,135,229,216,101,244,
+  146,23,26,182,183,67,24,32,66,4,125,185,141,146,20,130,76,11,112,48,109,179,247,131,29,56,210,10,84,70,188,218,
+  130,83,215,111,143,65,65,96,215,73,104,90,132,39,90,155,229,120,92,78,169,254,189,222,85,146,245,15,36,95,97,225,
+  220,254,14,181,181,101,165,139,225,83,39,226,68,184,131,220,95,162,116,123,170,156,9,242,215,33,165,121,78,10,128,63,
+  10,83,60,183,186,208,78,27,253,43,43,151,77,64,1,250,92,231,229,18,107,197,215,126,137,41,174,175,134,35,11,128,
+  35,128,97,178,198,108,61,119,243,67,38,17,131,179,225,129,206,113,214,179,80,106,66,86,54,250,185,153,0,119,126,217,
+  149,54,157,147,228,90,154,212,77,110,197,92,233,135,46,52,86,62,24,51,203,203,17,54,246,232,94,21,215,12,15,201,
+  253,19,159,137,164,178,37,171,109,155,159,166,7,189,187,251,228,92,43,51,212,234,103,11,237,179,140,200,78,56,82,230,
+  173,20,172,228,62,121,203,217,81,233,251,80,124,225,107,59,73,212,115,109,148,49,187,72,118,51,58,207,214,80,14,127,
+  147,90,93,35,13,184,47,5,188,82,11,217,142,241,243,26,182,240,218,210,91,36,251,78,132,67,194,210,253,127,167,40,
+  9,107,66,175,72,5,128,229,162,176,51,82,172,109,159,153,249,234,194,21,63,208,86,160,79,117,22,16,65,106,13,198,
+  198,99,37,162,15,35,183,129,241,216,114,49,220,52,96,163,164,140,175,127,242,130,42,146,147,132,79,127,147,10,6,34,
+  101,26,117,28,52,21,88,75,126,147,37,167,64,183,230,242,134,97,32,122,162,248,110,251,93,158,244,15,150,205,240,122,
+  124,244,58,2,152,104,13,49,71,188,198,83,207,80,218,159,152,122,255,14,24,13,252,33,19,20,173,10,152,41,245,140,
+  171,165,193,208,59,194,80,135,75,8,217,36,115,250,208,229,115,99,152,88,241,112,207,177,250,200,104,169,229,108,147,67,
+  169,6,145,150,122,47,44,162,249,131,184,30,232,33,202,20,111,211,209,140,87,239,190,102,3,241,11,138,45,129,208,14,
+  199,36,12,237,7,109,218,120,98,233,110,126,72,54,97,60,110,32,84,44,209,6,165,135,131,37,167,5,28,120,205,58,
+  211,55,163,157,102,209,103,148,144,227,186,247,217,175,254,231,132,190,105,197,212,35,92,230,153,78,34,159,173,74,81,81,
+  59,24,92,65,64,60,145,67,53,151,14,54,28,32,153,79,84,16,173,80,220,171,38,193,245,212,24,68,105,50,231,205,
+  181,59,1,128,214,56,70,85,105,111,156,238,31,149,78,106,234,151,32,86,128,164,168,237,212,181,134,188,216,131,232,50,
+  115,246,204,173,232,158,30,141,142,192,200,120,178,156,188,238,154,89,74,231,65,220,201,47,187,206,226,195,24,195,225,254,
+  236,250,146,27,135,127,38,223,147,79,87,87,172,92,199,101,67,161,177,111,164,130,121,179,40,105,62,122,18,110,155,92,
+  213,3,148,228,123,150,156,216,186,142,134,114,249,28,13,213,224,207,200,102,55,24,158,77,220,254,137,76,137,172,243,128,
+  74,52,90,75,135,119,81,164,84,165,243,208,219,131,81,81,65,154,134,206,133,194,138,165,216,147,21,77,124,149,85,123,
+  128,230,74,145,175,117,119,240,170,16,71,191,124,79,244,57,18,26,9,33,168,86,73,235,90,73,15,190,63,53,157,18,
+  59,202,252,114,3,169,102,242,90,22,234,68,60,238,191,241,91,244,68,141,34,207,192,121,111,142,107,24,125,14,5,153,
+  233,160,6,131,8,20,17,240,186,248,41,10,1,59,53,51,163,158,38,65,255,35,60,200,54,133,27,155,97,161,192,57,
+  208,34,156,50,44,236,13,114,208,168,217,244,16,65,141,98,26,173,247,151,208,232,9,63,101,128,246,225,233,99,15,224,
+  149,244,229,153,111,107,255,155,125,98,51,41,151,13,159,110,243,151,251,91,78,164,12,162,134,19,235,109,253,26,15,227,
+  174,192,195,242,126,148,239,251,24,148,25,105,144,107,207,111,219,212,145,156,209,183,191,244,235,142,99,97,189,162,171,193,
+  162,72,10,251,0,54,46,31,109,129,214,206,198,100,177,190,153,120,17,77,87,253,171,20,105,160,17,203,227,205,61,24,
+  8,183,220,87,16,244,18,230,109,191,166,14,12,118,62,23,41,106,198,38,42,200,49,214,133,245,208,77,8,174,139,173,
+  176,141,194,126,172,151,9,11,127,32,7,74,185,122,76,2,69,62,159,88,51,147,51,148,84,28,246,68,110,227,92,43,
+  181,231,155,127,166,133,20,136,212,199,32,43,73,190,145,171,99,253,225,39,229,37,238,255,126,164,123,96,145,220,106,226,
+  165,44,27,189,179,211,156,225,183,135,188,39,234,215,19,151,232,8,234,34,130,227,253,5,147,228,103,253,134,159,93,137,
+  2,46,5,61,138,214,207,23,22,247,53,177,185,103,191,132,177,153,30,238,183,119,221,184,215,83,237,214,222,174,234,157,
+  49,74,148,113,103,171,69,41,247,101,44,34,202,180,3,144,146,254,18,103,227,67,252,132,14,209,250,113,152,101,34,246,
+  42,52,169,48,180,18,95,208,245,40,145,167,207,169,57,182,116,89,160,35,96,190,69,126,177,180,149,249,230,167,84,159,
+  173,248,236,224,90,151,146,49,233,5,220,1,103,249,212,85,108,107,84,7,79,27,64,83,174,36,49,165,196,202,148,234,
+  107,245,230,51,48,114,51,173,84,0,4,217,99,125,56,82,69,58,162,90,233,222,140,50,229,230,74,132,22,110,78,239,
+  50,186,91,136,50,102,72,84,145,78,243,160,120,86,216,217,239,203,189,131,99,156,197,173,37,18,209,88,113,120,72,197,
+  138,231,60,214,214,152,139,185,137,213,25,140,241,168,253,220,174,228,231,2,2,214,185,177,188,245,67,149,217,182,240,58,
+  174,234,152,223,122,106,162,86,26,122,54,186,139,237,83,72,185,216,200,181,108,227,216,175,206,5,223,166,221,12,161,253,
+  5,163,132,131,162,108,244,188,200,172,82,74,26,49,156,83,220,123,38,27,24,85,205,122,130,73,218,99,118,230,160,78,
+  148,41,125,222,97,6,18,143,166,64,180,123,209,182,31,63,107,134,205,28,234,71,48,236,245,92,22,25,125,104,120,106,
+  178,161,71,158,255,85,35,118,214,52,175,224,170,53,207,101,54,75,94,88,129,100,103,168,68,3,165,20,232,192,187,17,
+  194,25,131,35,101,6,226,46,83,178,13,67,178,138,228,21,32,162,151,2,89,89,251,164,101,107,41,136,133,190,242,38,
+  157,164,133,198,59,11,212,206,71,25,107,29,215,217,231,135,220,13,213,199,175,191,179,216,35,14,83,53,114,193,141,102,
+  42,236,42,243,36,172,224,234,55,233,33,29,125,110,209,141,43,252,128,207,255,203,209,21,94,155,50,195,70,62,59,241,
+  238,65,168,56,70,69,15,92,181,108,3,197,248,119,234,70,214,111,122,158,237,174,67,193,212,181,165,51,251,67,188,209,
+  9,159,126,251,37,161,103,244,181,153,248,247,45,64,6,253,99,195,53,130,255,239,254,16,168,152,24,229,91,164,130,137,
+  230,202,42,185,233,46,5,226,70,102,53,43,79,175,225,142,72,101,116,86,251,195,187,47,147,125,93,101,140,121,110,103,
+  63,198,118,189,63,95,36,72,66,119,33,147,53,155,12,186,236,78,31,46,140,68,242,142,81,233,84,176,59,155,168,71,
+  199,8,248,64,167,41,222,153,16,251,106,186,64,241,187,175,45,134,157,2,244,126,176,118,124,5,143,129,253,218,2,26,
+  83,247,167,22,186,74,31,62,27,207,22,121,175,1,41,103,41,8,24,201,70,187,122,173,36,40,158,175,28,83,235,168,
+  36,171,194,168,82,210,208,63,247,231,226,3,79,88,185,145,70,67,193,2,39,172,43,215,88,237,173,203,198,183,252,116,
+  203,195,188,139,56,71,231,71,253,110,93,86,28,113,245,229,250,19,137,150,109,3,169,53,15,55,76,172,65,156,36,25,
+  112,173,244,253,0,251,150,47,164,11,165,136,19,163,252,52,204,172,61,66,62,6,130,67,124,214,44,197,136,23,124,150,
+  138,233,42,11,64,219,18,64,138,181,69,116,25,209,30,11,237,67,132,199,223,116,162,125,5,158,11,215,31,48,107,150,
+  121,135,198,9,245,211,99,33,47,126,83,69,205,210,212,203,140,77,56,229,148,25,95,228,77,55,32,60,50,156,96,35,
+  211,247,172,137,91,78,187,32,54,71,44,76,22,197,233,112,47,87,216,159,180,220,234,64,27,3,77,219,33,43,225,60,
+};
+
+const uint8 DX_FRAME_TAG[16] = {
+  239,165,34,186,127,204,72,115,48,47,44,228,103,15,172,27,
+};
+
+// ODD_PT / ODD_KEY (block cuối 160 byte)
+const uint8 DX_ODD_NONCE[16] = {
+  25,44,201,128,5,5,186,72,131,207,180,15,200,31,111,184,
+};
+
+const uint8 DX_ODD_CT[1000] = {
+  173,118,158,5,179,29,213,67,162,153,106,54,196,119,221,96,32,234,240,117,116,153,175,111,125,136,167,169,68,45,244,197,
+  44,222,41,114,203,5,32,160,35,48,125,27,55,97,59,216,93,30,64,44,211,27,206,187,237,9,18,141,82,20,139,17,
+  199,119,229,142,32,227,194,224,93,254,60,89,114,143,72,96,119,59,174,82,117,206,201,66,21,123,211,224,78,154,231,70,
+  11,178,22,215,236,213,180,36,162,230,45,196,9,61,9,53,75,15,98,115,49,77,55,190,68,223,229,168,179,254,19,236,
+  169,146,99,23,70,228,12,204,60,105,225,26,52,193,149,160,129,70,110,76,82,81,109,232,12,59,56,176,193,43,185,166,
+  63,79,15,125,7,200,109,116,189,61,70,98,221,205,89,88,111,21,206,203,17,170,60,235,69,97,160,124,94,40,163,176,
+  243,201,255,7,196,103,132,248,211,146,166,70,211,12,99,26,243,55,19,116,95,174,249,87,162,49,216,67,210,138,79,171,
+  139,167,102,24,90,179,254,60,199,65,97,152,141,251,182,141,34,0,247,113,185,64,194,78,63,58,176,10,186,90,149,136,
+  110,61,252,149,50,18,229,127,107,75,80,29,133,29,105,149,39,4,164,76,75,55,230,149,223,90,215,51,21,74,197,158,
+  25,248,160,197,232,61,156,116,157,132,237,231,195,1,199,193,221,40,152,70,26,118,100,56,140,101,119,133,55,42,92,191,
+  45,175,191,99,163,82,235,67,193,203,206,55,57,219,131,72,95,20,67,28,154,210,245,4,85,5,47,54,121,73,173,197,
+  61,164,93,198,153,200,177,1,30,159,185,136,71,243,120,93,73,190,180,178,116,169,78,44,9,38,186,5,183,222,209,164,
+  130,55,70,143,88,88,244,111,205,114,222,56,147,182,186,121,211,35,151,105,38,57,69,74,156,202,166,2,70,223,105,7,
+  36,94,120,194,198,92,224,105,149,226,192,202,121,229,167,159,67,206,227,133,196,219,165,86,81,16,117,73,117,17,110,126,
+  69,109,223,118,163,130,42,4,105,12,70,165,233,152,51,3,255,190,35,110,241,124,93,38,137,2,65,9,152,102,224,162,
+  75,218,18,127,134,102,168,21,251,215,15,134,15,84,142,245,6,213,82,227,149,12,35,108,191,23,202,230,183,14,251,59,
+  214,167,151,183,13,208,28,63,132,165,21,219,101,125,39,70,195,89,179,54,86,212,152,0,52,55,154,70,48,168,88,129,
+  78,220,165,156,254,104,117,143,10,225,214,254,127,171,154,136,171,52,60,237,154,217,240,220,78,225,24,91,213,235,21,181,
+  47,70,243,53,42,104,107,227,186,57,251,81,213,34,24,238,151,206,194,31,129,173,63,62,130,164,190,156,25,22,235,93,
+  101,121,203,73,66,185,37,194,20,35,111,86,162,115,160,207,236,219,228,122,202,60,165,101,200,114,177,186,21,255,185,33,
+  61,81,195,172,39,197,119,123,200,2,162,46,138,116,192,68,178,232,194,218,100,123,237,145,92,3,235,92,142,142,226,1,
+  135,86,19,151,181,207,207,251,5,143,155,136,132,237,250,227,139,39,196,253,31,81,235,107,77,57,120,146,54,127,162,44,
+  112,168,190,174,163,174,68,245,252,143,222,34,13,123,229,76,182,199,96,112,20,76,135,179,143,101,62,187,196,238,102,41,
+  251,198,136,62,229,153,19,71,249,77,160,43,236,26,228,176,1,223,47,41,249,235,70,105,110,157,190,26,73,108,97,89,
+  97,47,121,110,81,126,252,140,50,51,102,253,24,71,209,125,90,25,17,9,1,107,140,83,0,157,186,204,87,38,242,104,
+  92,64,107,216,136,30,27,103,169,58,82,53,112,71,59,114,94,58,181,0,158,228,235,219,223,138,222,150,39,34,18,47,
+  139,40,105,178,97,43,219,171,43,221,197,220,34,64,13,196,210,153,31,82,0,96,243,53,234,75,39,198,79,52,200,169,
+  239,208,61,151,212,127,101,50,203,239,106,57,7,231,241,34,220,204,231,62,195,123,214,31,49,151,98,209,178,200,235,186,
+  1,135,185,91,240,125,251,116,10,136,254,148,168,185,164,228,20,200,114,5,115,134,252,220,56,86,122,115,203,172,70,130,
+  66,136,129,224,90,250,219,80,123,251,95,36,101,56,232,178,140,149,72,230,247,92,36,204,172,34,75,35,68,60,30,57,
+  55,27,209,219,123,231,155,137,240,4,20,187,64,218,180,186,250,30,92,211,144,162,42,128,77,116,139,40,29,62,127,30,
+  167,160,217,123,178,1,59,19,
+};
+
+const uint8 DX_ODD_TAG[16] = {
+  141,73,254,168,144,209,255,121,9,249,217,64,121,81,82,59,
+};
+
+// 336 byte đầu của ODD_PT: đúng 2 block đầy, không có pad trong block
+#define DX_FULL_BYTES 336
+const uint8 DX_FULL_CT[336] = {
+  173,118,158,5,179,29,213,67,162,153,106,54,196,119,221,96,32,234,240,117,116,153,175,111,125,136,167,169,68,45,244,197,
+  44,222,41,114,203,5,32,160,35,48,125,27,55,97,59,216,93,30,64,44,211,27,206,187,237,9,18,141,82,20,139,17,
+  199,119,229,142,32,227,194,224,93,254,60,89,114,143,72,96,119,59,174,82,117,206,201,66,21,123,211,224,78,154,231,70,
+  11,178,22,215,236,213,180,36,162,230,45,196,9,61,9,53,75,15,98,115,49,77,55,190,68,223,229,168,179,254,19,236,
+  169,146,99,23,70,228,12,204,60,105,225,26,52,193,149,160,129,70,110,76,82,81,109,232,12,59,56,176,193,43,185,166,
+  63,79,15,125,7,200,109,116,189,61,70,98,221,205,89,88,111,21,206,203,17,170,60,235,69,97,160,124,94,40,163,176,
+  243,201,255,7,196,103,132,248,211,146,166,70,211,12,99,26,243,55,19,116,95,174,249,87,162,49,216,67,210,138,79,171,
+  139,167,102,24,90,179,254,60,199,65,97,152,141,251,182,141,34,0,247,113,185,64,194,78,63,58,176,10,186,90,149,136,
+  110,61,252,149,50,18,229,127,107,75,80,29,133,29,105,149,39,4,164,76,75,55,230,149,223,90,215,51,21,74,197,158,
+  25,248,160,197,232,61,156,116,157,132,237,231,195,1,199,193,221,40,152,70,26,118,100,56,140,101,119,133,55,42,92,191,
+  45,175,191,99,163,82,235,67,193,203,206,55,57,219,131,72,
+};
+
+const uint8 DX_FULL_TAG[16] = {
+  104,189,147,7,75,73,184,62,31,121,160,204,7,110,216,73,
+};
+
+// Frame rỗng: chỉ có tag
+const uint8 DX_EMPTY_TAG[16] = {
+  157,253,185,75,64,76,120,42,191,13,25,48,149,156,236,237,
+};
+
+#endif
@@ -0,0 +1,304 @@
+#include "params.h"
+#include "hls_stream.h"
+#include "ap_int.h"
+
+// --- EXTERN DECLARATIONS ---
+extern void aes_expand_key(uint8 key[32], hls::stream<beat_t>& rk_strm);
+extern beat_t aes256_encrypt_block(beat_t in, beat_t rk[AES_ROUNDS + 1]);
+
+#define AES_FRAME_BEATS (AES_FRAME_MAX / AES_BLOCK_BYTES)
+#define GCM_AAD_MAX_BEATS 16 // header frame, không phải payload
+
+// =========================================================
+// AES-256-GCM (NIST SP 800-38D), IV 96 bit
+// =========================================================
+//   J0 = IV || 0^31 || 1, block i của payload dùng IV || BE32(2 + i)
+//   tag = E_K(J0) ^ GHASH_H(AAD || pad || C || pad || len(AAD) || len(C))
+// Datapath AES của aes_ctr.cpp (1 block / chu kỳ) chạy thêm 2 block đầu:
+// H = E_K(0^128) cho GHASH và E_K(J0) cho tag.
+//
+// GHASH gộp HW_GHASH_WAYS block / lần: X' = sum_p (S_p ^ [p = 0] X) * H^(r-p),
+// r = số block của nhóm (nhóm cuối có thể < W). W tích Karatsuba
+// (3 clmul 64x64) được XOR khi chưa reduce, rồi reduce 1 lần mod
+// x^128 + x^7 + x^2 + x + 1.
+//
+// Đa thức GF(2^128): bit i = hệ số x^i. GCM đặt x^0 ở bit 7 của byte 0,
+// beat_t đặt byte k ở bit [8k+7:8k] -> chỉ cần đảo bit trong từng byte.
+
+typedef ap_uint<128> gf128_t;
+
+// =========================================================
+// PHẦN 1: GF(2^128)
+// =========================================================
+static gf128_t gcm_to_poly(beat_t b) {
+    #pragma HLS INLINE
+    gf128_t r = 0;
+    for(int k=0; k<16; k++) {
+        uint8 v = (uint8)(b >> (8*k));
+        uint8 rev = 0;
+        for(int j=0; j<8; j++) rev |= (uint8)(((v >> j) & 1) << (7 - j));
+        r |= (gf128_t)rev << (8*k);
+    }
+    return r;
+}
+
+// Nhân không nhớ 64 x 64 -> 128
+static gf128_t clmul64(ap_uint<64> a, ap_uint<64> b) {
+    #pragma HLS INLINE
+    gf128_t r = 0;
+    for(int i=0; i<64; i++) {
+        if ((b >> i) & 1) r ^= (gf128_t)a << i;
+    }
+    return r;
+}
+
+// Karatsuba: a * b = hi * x^128 + lo, chưa reduce
+static void gf128_mul_wide(gf128_t a, gf128_t b, gf128_t& hi, gf128_t& lo) {
+    #pragma HLS INLINE
+    ap_uint<64> a0 = (ap_uint<64>)a, a1 = (ap_uint<64>)(a >> 64);
+    ap_uint<64> b0 = (ap_uint<64>)b, b1 = (ap_uint<64>)(b >> 64);
+    gf128_t p_lo = clmul64(a0, b0);
+    gf128_t p_hi = clmul64(a1, b1);
+    gf128_t p_mid = clmul64(a0 ^ a1, b0 ^ b1) ^ p_lo ^ p_hi;
+    lo = p_lo ^ (p_mid << 64);
+    hi = p_hi ^ (p_mid >> 64);
+}
+
+// hi * x^128 + lo mod x^128 + x^7 + x^2 + x + 1 (x^128 = x^7 + x^2 + x + 1)
+static gf128_t gf128_reduce(gf128_t hi, gf128_t lo) {
+    #pragma HLS INLINE
+    gf128_t t = hi ^ (hi << 1) ^ (hi << 2) ^ (hi << 7);
+    // bit tràn khỏi x^127 của 3 phép dịch, < 2^7 -> fold lần 2 không tràn nữa
+    gf128_t ov = (hi >> 127) ^ (hi >> 126) ^ (hi >> 121);
+    return lo ^ t ^ ov ^ (ov << 1) ^ (ov << 2) ^ (ov << 7);
+}
+
+static gf128_t gf128_mul(gf128_t a, gf128_t b) {
+    #pragma HLS INLINE
+    gf128_t hi, lo;
+    gf128_mul_wide(a, b, hi, lo);
+    return gf128_reduce(hi, lo);
+}
+
+// =========================================================
+// PHẦN 2: DATAFLOW PROCESSES
+// =========================================================
+
+// t = 0: 0^128 -> H, t = 1: J0 -> E_K(J0), t >= 2: keystream block t - 2
+static void gcm_keystream(
+    hls::stream<beat_t>& rk_strm,
+    ap_uint<96> iv,
+    int n_blocks,
+    hls::stream<beat_t>& h_strm,
+    hls::stream<beat_t>& ej0_strm,
+    hls::stream<beat_t>& ks_strm
+) {
+    #pragma HLS INLINE off
+    beat_t rk[AES_ROUNDS + 1];
+    #pragma HLS ARRAY_PARTITION variable=rk type=complete
+    for(int r=0; r<=AES_ROUNDS; r++) {
+        #pragma HLS PIPELINE II=1
+        rk[r] = rk_strm.read();
+    }
+
+    Gcm_Keystream_Loop: for(int t=0; t<n_blocks + 2; t++) {
+        #pragma HLS PIPELINE II=1
+        #pragma HLS LOOP_TRIPCOUNT min=2 max=AES_FRAME_BEATS
+        // IV (byte 0 ở bit [7:0]) || BE32(t) ở byte 12..15
+        beat_t blk = 0;
+        if (t != 0) {
+            blk = (beat_t)iv;
+            for(int b=0; b<4; b++) blk |= (beat_t)(uint8)(t >> (8*(3 - b))) << (8*(12 + b));
+        }
+        beat_t e = aes256_encrypt_block(blk, rk);
+        if (t == 0) h_strm.write(e);
+        else if (t == 1) ej0_strm.write(e);
+        else ks_strm.write(e);
+    }
+}
+
+static void gcm_read(beat_t* in, int n_blocks, hls::stream<beat_t>& data_strm) {
+    #pragma HLS INLINE off
+    Gcm_Read_Loop: for(int i=0; i<n_blocks; i++) {
+        #pragma HLS PIPELINE II=1
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=AES_FRAME_BEATS
+        data_strm.write(in[i]);
+    }
+}
+
+// Byte 0 .. n-1 của beat, còn lại 0 (n = 0: nguyên beat)
+static beat_t gcm_tail_mask(int n) {
+    #pragma HLS INLINE
+    beat_t mask = 0;
+    for(int b=0; b<AES_BLOCK_BYTES; b++) {
+        if (n == 0 || b < n) mask |= (beat_t)0xff << (8*b);
+    }
+    return mask;
+}
+
+// out = in ^ ks; GHASH luôn trên ciphertext: out khi mã hóa, in khi giải mã.
+// Block cuối lẻ được xóa phần đệm = zero pad của GHASH.
+static void gcm_xor_write(
+    hls::stream<beat_t>& data_strm,
+    hls::stream<beat_t>& ks_strm,
+    int n_blocks,
+    int tail,
+    int decrypt,
+    beat_t* out,
+    hls::stream<beat_t>& ct_strm
+) {
+    #pragma HLS INLINE off
+    beat_t tail_mask = gcm_tail_mask(tail);
+    Gcm_Write_Loop: for(int i=0; i<n_blocks; i++) {
+        #pragma HLS PIPELINE II=1
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=AES_FRAME_BEATS
+        beat_t mask = (i == n_blocks - 1) ? tail_mask : gcm_tail_mask(0);
+        beat_t d = data_strm.read() & mask;
+        beat_t c = (d ^ ks_strm.read()) & mask;
+        out[i] = c;
+        ct_strm.write(decrypt ? d : c);
+    }
+}
+
+// Chuỗi block vào GHASH: AAD (pad 0), C, rồi len(AAD) || len(C) (bit, BE64)
+static void gcm_ghash_feed(
+    beat_t* aad,
+    int aad_bytes,
+    hls::stream<beat_t>& ct_strm,
+    int n_blocks,
+    int n_bytes,
+    hls::stream<beat_t>& gh_strm
+) {
+    #pragma HLS INLINE off
+    int aad_blocks = (aad_bytes + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES;
+    beat_t aad_mask = gcm_tail_mask(aad_bytes % AES_BLOCK_BYTES);
+    Feed_Aad_Loop: for(int i=0; i<aad_blocks; i++) {
+        #pragma HLS PIPELINE II=1
+        #pragma HLS LOOP_TRIPCOUNT min=0 max=GCM_AAD_MAX_BEATS
+        beat_t a = aad[i];
+        gh_strm.write((i == aad_blocks - 1) ? (beat_t)(a & aad_mask) : a);
+    }
+    Feed_Ct_Loop: for(int i=0; i<n_blocks; i++) {
+        #pragma HLS PIPELINE II=1
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=AES_FRAME_BEATS
+        gh_strm.write(ct_strm.read());
+    }
+
+    ap_uint<64> len_a = (ap_uint<64>)aad_bytes << 3;
+    ap_uint<64> len_c = (ap_uint<64>)n_bytes << 3;
+    beat_t len_blk = 0;
+    for(int b=0; b<8; b++) {
+        #pragma HLS UNROLL
+        len_blk |= (beat_t)(uint8)(len_a >> (8*(7 - b))) << (8*b);
+        len_blk |= (beat_t)(uint8)(len_c >> (8*(7 - b))) << (8*(8 + b));
+    }
+    gh_strm.write(len_blk);
+}
+
+// n_total block -> S = GHASH_H(...), HW_GHASH_WAYS block / lần lặp
+static void gcm_ghash(
+    hls::stream<beat_t>& h_strm,
+    hls::stream<beat_t>& gh_strm,
+    int n_total,
+    hls::stream<beat_t>& s_strm
+) {
+    #pragma HLS INLINE off
+    // hpow[k] = H^k, k = 1 .. W (hpow[0] không dùng)
+    gf128_t hpow[HW_GHASH_WAYS + 1];
+    #pragma HLS ARRAY_PARTITION variable=hpow type=complete
+    gf128_t h = gcm_to_poly(h_strm.read());
+    hpow[0] = 0;
+    hpow[1] = h;
+    H_Pow_Loop: for(int k=2; k<=HW_GHASH_WAYS; k++) {
+        hpow[k] = gf128_mul(hpow[k - 1], h);
+    }
+
+    gf128_t x = 0;
+    int remaining = n_total;
+    int n_groups = (n_total + HW_GHASH_WAYS - 1) / HW_GHASH_WAYS;
+    Ghash_Loop: for(int g=0; g<n_groups; g++) {
+        DO_PRAGMA(HLS PIPELINE II=HW_GHASH_WAYS)
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=AES_FRAME_BEATS/HW_GHASH_WAYS
+        int r = (remaining < HW_GHASH_WAYS) ? remaining : HW_GHASH_WAYS;
+        gf128_t acc_hi = 0, acc_lo = 0;
+        for(int p=0; p<HW_GHASH_WAYS; p++) {
+            #pragma HLS UNROLL
+            if (p < r) {
+                gf128_t s = gcm_to_poly(gh_strm.read());
+                if (p == 0) s ^= x;
+                gf128_t hi, lo;
+                gf128_mul_wide(s, hpow[r - p], hi, lo);
+                acc_hi ^= hi;
+                acc_lo ^= lo;
+            }
+        }
+        x = gf128_reduce(acc_hi, acc_lo);
+        remaining -= HW_GHASH_WAYS;
+    }
+    s_strm.write(gcm_to_poly(x)); // đảo bit từng byte là phép tự nghịch đảo
+}
+
+static void gcm_tag(hls::stream<beat_t>& s_strm, hls::stream<beat_t>& ej0_strm, beat_t* tag_out) {
+    #pragma HLS INLINE off
+    tag_out[0] = s_strm.read() ^ ej0_strm.read();
+}
+
+// =========================================================
+// PHẦN 3: KERNEL
+// =========================================================
+// decrypt = 0: out = ciphertext, decrypt = 1: out = plaintext; tag_out luôn là
+// tag tính trên ciphertext, host so với tag nhận được (giải mã) hoặc gửi kèm.
+// aad / in / out / tag_out cấp tròn lên bội 16 byte như aes256_ctr.
+void aes256_gcm(
+    uint8 key[32],
+    ap_uint<96> iv,
+    int decrypt,
+    int aad_bytes,
+    beat_t* aad,
+    int n_bytes,
+    beat_t* in,
+    beat_t* out,
+    beat_t* tag_out
+) {
+    #pragma HLS INTERFACE m_axi port=key bundle=gmem0 depth=32 max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=aad bundle=gmem0 depth=GCM_AAD_MAX_BEATS
+    #pragma HLS INTERFACE m_axi port=in bundle=gmem0 depth=AES_FRAME_BEATS max_read_burst_length=256
+    #pragma HLS INTERFACE m_axi port=out bundle=gmem1 depth=AES_FRAME_BEATS max_write_burst_length=256
+    #pragma HLS INTERFACE m_axi port=tag_out bundle=gmem1 depth=1
+    #pragma HLS INTERFACE s_axilite port=iv
+    #pragma HLS INTERFACE s_axilite port=decrypt
+    #pragma HLS INTERFACE s_axilite port=aad_bytes
+    #pragma HLS INTERFACE s_axilite port=n_bytes
+    #pragma HLS INTERFACE s_axilite port=return
+
+    int n_blocks = (n_bytes + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES;
+    int tail = n_bytes % AES_BLOCK_BYTES;
+    int n_total = (aad_bytes + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES + n_blocks + 1;
+
+    hls::stream<beat_t> rk_strm;
+    #pragma HLS STREAM variable=rk_strm depth=15
+    hls::stream<beat_t> h_strm;
+    #pragma HLS STREAM variable=h_strm depth=1
+    hls::stream<beat_t> ej0_strm;
+    #pragma HLS STREAM variable=ej0_strm depth=1
+    hls::stream<beat_t> data_strm;
+    #pragma HLS STREAM variable=data_strm depth=64
+    hls::stream<beat_t> ks_strm;
+    #pragma HLS STREAM variable=ks_strm depth=64
+    // feed đọc hết AAD trước khi nhận C
+    hls::stream<beat_t> ct_strm;
+    #pragma HLS STREAM variable=ct_strm depth=64
+    hls::stream<beat_t> gh_strm;
+    #pragma HLS STREAM variable=gh_strm depth=64
+    hls::stream<beat_t> s_strm;
+    #pragma HLS STREAM variable=s_strm depth=1
+
+    #pragma HLS DATAFLOW
+    aes_expand_key(key, rk_strm);
+    gcm_keystream(rk_strm, iv, n_blocks, h_strm, ej0_strm, ks_strm);
+    gcm_read(in, n_blocks, data_strm);
+    gcm_xor_write(data_strm, ks_strm, n_blocks, tail, decrypt, out, ct_strm);
+    gcm_ghash_feed(aad, aad_bytes, ct_strm, n_blocks, n_bytes, gh_strm);
+    gcm_ghash(h_strm, gh_strm, n_total, s_strm);
+    gcm_tag(s_strm, ej0_strm, tag_out);
+}
@@ -4,13 +4,16 @@
 // =========================================================
 // CBD Core (Eta = 2) - Optimized for Factor=2
 // =========================================================
-void cbd_eta2(ap_uint<64> input_buf[16], int16 coeffs[256]) {
-    #pragma HLS INLINE off
+// W = ap_uint<64> (cbd_top / m_axi) hoặc uint64_t (đọc thẳng output PRF
+// trong sample_poly_cbd, không copy sang mảng ap_uint trung gian)
+template <typename W>
+static void cbd_eta2_core(W input_buf[16], int16 coeffs[256]) {
+    #pragma HLS INLINE
     
     // Loop qua 16 words 64-bit
     for(int i=0; i<16; i++) {
         
-        ap_uint<64> word = input_buf[i];
+        ap_uint<64> word = (ap_uint<64>)input_buf[i];
 
         // Loop qua 8 bytes trong word
         // XÓA UNROLL, thay bằng PIPELINE ở đây
@@ -38,6 +41,11 @@ void cbd_eta2(ap_uint<64> input_buf[16], int16 coeffs[256]) {
     }
 }
 
+void cbd_eta2(ap_uint<64> input_buf[16], int16 coeffs[256]) {
+    #pragma HLS INLINE off
+    cbd_eta2_core(input_buf, coeffs);
+}
+
 // Wrapper Top-level
 void cbd_top(
     ap_uint<64> input_buf[16], 
@@ -48,7 +56,68 @@ void cbd_top(
     #pragma HLS INTERFACE s_axilite port=return
     
     // Cấu hình mảng quan trọng nhất để đồng bộ với phần còn lại của hệ thống
-    #pragma HLS ARRAY_PARTITION variable=coeffs cyclic factor=2
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=coeffs cyclic factor=HW_POLY_PART)
 
     cbd_eta2(input_buf, coeffs);
-}
\ No newline at end of file
+}
+
+// =========================================================
+// CBD Core (Eta = 3) - ML-KEM-512 (eta1), 3 byte -> 4 hệ số
+// =========================================================
+template <typename W>
+static void cbd_eta3_core(W input_buf[24], int16 coeffs[256]) {
+    #pragma HLS INLINE
+
+    for(int i=0; i<KYBER_N/4; i++) {
+        // 4 hệ số / vòng trên mảng factor=2 -> II=2
+        #pragma HLS PIPELINE II=2
+
+        // 3 byte liên tiếp (có thể vắt qua 2 word 64-bit)
+        ap_uint<24> bits = 0;
+        for(int b=0; b<3; b++) {
+            int p = 3 * i + b;
+            ap_uint<64> word = (ap_uint<64>)input_buf[p >> 3];
+            bits |= (ap_uint<24>)((word >> (8 * (p & 7))) & 0xFF) << (8 * b);
+        }
+
+        for(int j=0; j<4; j++) {
+            ap_uint<6> c = (bits >> (6 * j)) & 0x3F;
+            ap_uint<2> a = ((c >> 0) & 1) + ((c >> 1) & 1) + ((c >> 2) & 1);
+            ap_uint<2> b = ((c >> 3) & 1) + ((c >> 4) & 1) + ((c >> 5) & 1);
+            coeffs[4 * i + j] = (int16)a - (int16)b;
+        }
+    }
+}
+
+void cbd_eta3(ap_uint<64> input_buf[24], int16 coeffs[256]) {
+    #pragma HLS INLINE off
+    cbd_eta3_core(input_buf, coeffs);
+}
+
+// =========================================================
+// SamplePolyCBD_eta(PRF_eta(seed, nonce))
+// =========================================================
+// ETA = eta1 (s, e, r) hoặc eta2 (e1, e2) của bộ tham số đang build.
+// Nhánh ETA được chọn lúc compile, mỗi instance chỉ chứa 1 lõi CBD.
+template <int WORDS> void shake256_prf_n(uint8 input[33], uint64_t output_64[WORDS]);
+
+template <int ETA>
+void sample_poly_cbd(uint8 seed[32], uint8 nonce, int16 coeffs[KYBER_N]) {
+    #pragma HLS INLINE
+    uint8 prf_in[33];
+    #pragma HLS ARRAY_PARTITION variable=prf_in complete
+    for(int k=0; k<32; k++) prf_in[k] = seed[k];
+    prf_in[32] = nonce;
+
+    uint64_t prf_out[8 * ETA];
+    #pragma HLS ARRAY_PARTITION variable=prf_out complete
+    shake256_prf_n<8 * ETA>(prf_in, prf_out);
+
+    // CBD đọc thẳng các word PRF và ghi thẳng vào coeffs của caller
+    // (vd s_hat[i], r_hat[i]): không mảng trung gian, không vòng copy
+    if (ETA == 2) cbd_eta2_core(prf_out, coeffs);
+    else          cbd_eta3_core(prf_out, coeffs);
+}
+
+template void sample_poly_cbd<2>(uint8 seed[32], uint8 nonce, int16 coeffs[KYBER_N]);
+template void sample_poly_cbd<3>(uint8 seed[32], uint8 nonce, int16 coeffs[KYBER_N]);
@@ -1,25 +1,20 @@
 #include "params.h"
+#include "poly_ops.h"
 #include "hls_stream.h"
 #include "ap_int.h"
-#include <cstring>
 
 // --- EXTERN DECLARATIONS ---
 extern void keccak_f1600(uint64_t state[25]); 
 extern void ntt(int16 poly[256]);
 extern void inv_ntt(int16 poly[256]);
-extern void poly_pointwise(int16 a[256], int16 b[256], int16 r[256]);
-extern void cbd_eta2(ap_uint<64> input_buf[16], int16 coeffs[256]);
+extern void inv_ntt_layers(int16 poly[256]);
+extern int16 inv_ntt_scale(int16 x);
+extern void poly_basemul_acc(int16 acc[256], int16 a[KYBER_K][256], int16 b[KYBER_K][256]);
+template <int ETA> void sample_poly_cbd(uint8 seed[32], uint8 nonce, int16 coeffs[KYBER_N]);
 extern void xof_absorb_squeeze(ap_uint<64> input_B[5], hls::stream<uint8>& out_stream);
 extern void parse_ntt(hls::stream<uint8>& in_bytes, int16 a_hat[KYBER_N]);
 
-extern void poly_frombytes(uint8 input[384], int16 coeffs[KYBER_N]);
 extern void poly_frommsg(uint8 msg[32], int16 coeffs[KYBER_N]);
-extern void poly_decompress_u(uint8 input[320], int16 coeffs[KYBER_N]);
-extern void poly_decompress_v(uint8 input[128], int16 coeffs[KYBER_N]);
-extern void poly_compress_u(int16 coeffs[KYBER_N], uint8 output[320]);
-extern void poly_compress_v(int16 coeffs[KYBER_N], uint8 output[128]);
-
-extern void shake256_prf(uint8 input[33], uint64_t output_64[16]);
 
 // Local static helpers
 static void sha3_512_64bytes_decaps(uint8 input[64], uint8 output[64]) {
@@ -42,307 +37,912 @@ static void sha3_512_64bytes_decaps(uint8 input[64], uint8 output[64]) {
     }
 }
 
-#define SK_SIZE 2400
-#define CT_SIZE 1088
+#define SK_SIZE KYBER_SK_BYTES
+#define CT_SIZE KYBER_CT_BYTES
 #define SS_SIZE 32
 
-void ml_kem_decaps(
+#define SK_BEATS (SK_SIZE / AXI_BEAT_BYTES) // 150 (768)
+#define CT_BEATS (CT_SIZE / AXI_BEAT_BYTES) // 68 (768)
+#define CT_U_BYTES (KYBER_K * KYBER_POLYCOMP_U)
+
+#define DECAPS_BATCH_MAX 64
+// depth m_axi của kernel resident: đủ DECAPS_BATCH_MAX ct (co-sim)
+#define CT_BATCH_BYTES (CT_SIZE * DECAPS_BATCH_MAX)
+#define SS_BATCH_BYTES (SS_SIZE * DECAPS_BATCH_MAX)
+
+extern void matvec_At_t(int16 A_T[KYBER_K][KYBER_K][KYBER_N], int16 t_hat[KYBER_K][KYBER_N],
+                        int16 r_hat[KYBER_K][KYBER_N], int16 u[KYBER_K][KYBER_N], int16 v[KYBER_N]);
+extern void gen_matrix(hls::stream<ap_uint<64> >& rho_strm, int16 A[KYBER_K][KYBER_K][KYBER_N], int transposed);
+
+extern void perf_clear(perf_t pf[PERF_SLOTS]);
+extern void perf_merge(perf_t pf[PERF_SLOTS], perf_t acc[PERF_SLOTS]);
+
+// =========================================================
+// LOAD DK: rho, z, s_hat, t_hat, H(ek)
+// =========================================================
+// rho và z được đọc và đẩy ra trước: rho cho gen_matrix, z cho J(z || c),
+// nên cả expand A^T lẫn nhánh ct bắt đầu ngay từ đầu kernel, không chờ
+// decode xong dk. Sau đó dk được đọc 1 lần theo beat 128-bit, phần s / t
+// chia sang 2 process decode riêng chạy song song với nhánh ct; ek nhúng
+// (t || rho) và hash lưu trong dk đi sang decaps_check_dk.
+#define VEC_BEATS (KYBER_POLYVECBYTES / AXI_BEAT_BYTES) // 72 (768)
+#define EK_BEATS  (KYBER_PK_BYTES / AXI_BEAT_BYTES)     // 74 (768), t || rho
+
+static void decaps_read_dk(
     uint8 sk_in[SK_SIZE],
-    uint8 ct_in[CT_SIZE],
-    uint8 ss_out[SS_SIZE]
+    hls::stream<ap_uint<64> >& rho_strm,
+    hls::stream<ap_uint<64> >& z_strm,
+    hls::stream<beat_t>& s_strm,
+    hls::stream<beat_t>& t_strm,
+    hls::stream<beat_t>& ek_strm,
+    hls::stream<ap_uint<64> >& h_strm,
+    uint8 h_pk[32],
+    perf_t pf[PERF_SLOTS]
 ) {
-    #pragma HLS INTERFACE m_axi port=sk_in bundle=gmem0 depth=2400 max_widen_bitwidth=128
-    #pragma HLS INTERFACE m_axi port=ct_in bundle=gmem1 depth=1088 max_widen_bitwidth=128
-    #pragma HLS INTERFACE m_axi port=ss_out bundle=gmem2 depth=32 max_widen_bitwidth=128
-    #pragma HLS INTERFACE s_axilite port=return
+    #pragma HLS INLINE off
+    perf_clear(pf);
+    perf_t t = PERF_NOW(0);
 
-    // Resources: Limit 3 for parallelism
-    #pragma HLS ALLOCATION function instances=keccak_f1600 limit=3
-    #pragma HLS ALLOCATION function instances=ntt limit=3
-    #pragma HLS ALLOCATION function instances=inv_ntt limit=3
-    #pragma HLS ALLOCATION function instances=poly_pointwise limit=3
+    Rho_First_Loop: for(int w=0; w<4; w++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        uint64_t val = 0;
+        for(int b=0; b<8; b++) val |= ((uint64_t)sk_in[KYBER_SK_RHO_OFF + w*8 + b] << (b*8));
+        rho_strm.write(val);
+    }
 
-    // Buffers Factor=2
-    int16 s_hat[KYBER_K][KYBER_N];
-    #pragma HLS ARRAY_PARTITION variable=s_hat dim=1 type=complete
-    #pragma HLS ARRAY_PARTITION variable=s_hat dim=2 cyclic factor=2
+    Z_First_Loop: for(int w=0; w<4; w++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        uint64_t val = 0;
+        for(int b=0; b<8; b++) val |= ((uint64_t)sk_in[KYBER_SK_Z_OFF + w*8 + b] << (b*8));
+        z_strm.write(val);
+    }
 
-    int16 u_poly[KYBER_K][KYBER_N];
-    #pragma HLS ARRAY_PARTITION variable=u_poly dim=1 type=complete
-    #pragma HLS ARRAY_PARTITION variable=u_poly dim=2 cyclic factor=2
+    // s_hat || t_hat || rho || H(ek): z đã đọc ở trên
+    Read_DK_Loop: for(int i=0; i<KYBER_SK_Z_OFF / AXI_BEAT_BYTES; i++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        beat_t beat = 0;
+        for(int b=0; b<AXI_BEAT_BYTES; b++) beat |= (beat_t)sk_in[i*AXI_BEAT_BYTES + b] << (b*8);
 
-    int16 v_poly[KYBER_N]; 
-    #pragma HLS ARRAY_PARTITION variable=v_poly cyclic factor=2
+        if (i < VEC_BEATS) s_strm.write(beat);
+        else if (i < 2 * VEC_BEATS) t_strm.write(beat);
+        if (i >= VEC_BEATS && i < VEC_BEATS + EK_BEATS) ek_strm.write(beat);
 
-    uint8 sk_local[SK_SIZE];
-    #pragma HLS ARRAY_RESHAPE variable=sk_local cyclic factor=16
-    uint8 ct_local[CT_SIZE];
-    #pragma HLS ARRAY_RESHAPE variable=ct_local cyclic factor=16
+        if (i >= KYBER_SK_H_OFF / AXI_BEAT_BYTES) {
+            h_strm.write((ap_uint<64>)beat.range(63, 0));
+            h_strm.write((ap_uint<64>)beat.range(127, 64));
+        }
+        for(int b=0; b<AXI_BEAT_BYTES; b++) {
+            int p = i*AXI_BEAT_BYTES + b;
+            if (p >= KYBER_SK_H_OFF) h_pk[p - KYBER_SK_H_OFF] = (uint8)beat.range(8*b + 7, 8*b);
+        }
+    }
+    PERF_MARK(pf, PERF_LOAD, t);
+}
 
-    memcpy(sk_local, sk_in, SK_SIZE);
-    memcpy(ct_local, ct_in, CT_SIZE);
+// ByteDecode_12 của 1 vector K đa thức, mỗi 3 byte -> 2 hệ số
+static void decaps_decode_vec(
+    hls::stream<beat_t>& in_strm,
+    int16 poly[KYBER_K][KYBER_N]
+) {
+    #pragma HLS INLINE off
+    ap_uint<24> acc = 0;
+    int nb = 0;
+    int cidx = 0;
+    Decode_Vec_Loop: for(int i=0; i<VEC_BEATS; i++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        beat_t beat = in_strm.read();
+        for(int b=0; b<AXI_BEAT_BYTES; b++) {
+            acc |= (ap_uint<24>)beat.range(8*b + 7, 8*b) << (8*nb);
+            nb++;
+            if (nb == 3) {
+                poly[cidx >> 8][cidx & 255] = (int16)(acc & 0xFFF);
+                poly[cidx >> 8][(cidx & 255) + 1] = (int16)(acc >> 12);
+                cidx += 2;
+                acc = 0;
+                nb = 0;
+            }
+        }
+    }
+}
 
-    // --- DECODE ---
-    Unpack_SK_Loop: for(int i=0; i<KYBER_K; i++) {
+// Hash check (FIPS 203): SHA3-256(dk[384k : 768k+32]) == dk[768k+32 : 768k+64].
+// Absorb ek nhúng trong lúc read_dk stream qua, chạy song song với decaps
+// (ngắn hơn nhiều nhánh ct) nên không thêm latency cho dk hợp lệ.
+static void decaps_check_dk(
+    hls::stream<beat_t>& ek_strm,
+    hls::stream<ap_uint<64> >& h_strm,
+    int& status
+) {
+    #pragma HLS INLINE off
+    uint64_t state[25];
+    #pragma HLS ARRAY_PARTITION variable=state type=complete
+    for(int i=0; i<25; i++) {
         #pragma HLS UNROLL
-        poly_frombytes(&sk_local[i*384], s_hat[i]);
+        state[i] = 0;
     }
-    Unpack_CT_Loop: for(int i=0; i<KYBER_K; i++) {
-        #pragma HLS UNROLL
-        poly_decompress_u(&ct_local[i*320], u_poly[i]);
+
+    int pos = 0;
+    Absorb_EK_Loop: for(int i=0; i<EK_BEATS; i++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        beat_t beat = ek_strm.read();
+        for(int h=0; h<2; h++) {
+            state[pos] ^= (uint64_t)beat.range(64*h + 63, 64*h);
+            pos++;
+            if (pos == 17) {
+                keccak_f1600(state);
+                PERF_TICK(PERF_ITERS_KECCAK);
+                pos = 0;
+            }
+        }
     }
-    poly_decompress_v(&ct_local[KYBER_K*320], v_poly);
 
-    // --- DECRYPT ---
-    int16 u_hat[KYBER_K][KYBER_N];
-    #pragma HLS ARRAY_PARTITION variable=u_hat dim=1 type=complete
-    #pragma HLS ARRAY_PARTITION variable=u_hat dim=2 cyclic factor=2
+    state[pos] ^= 0x06;
+    state[16] ^= (1ULL << 63);
+    keccak_f1600(state);
+    PERF_TICK(PERF_ITERS_KECCAK);
 
-    NTT_U_Loop: for(int i=0; i<KYBER_K; i++) {
+    uint64_t diff = 0;
+    for(int i=0; i<4; i++) {
+        #pragma HLS PIPELINE II=1
+        diff |= state[i] ^ (uint64_t)h_strm.read();
+    }
+    status = (diff != 0) ? KEY_STATUS_BAD_DK : KEY_STATUS_OK;
+}
+
+// Bọc gen_matrix để chốt perf
+static void decaps_xof(
+    hls::stream<ap_uint<64> >& rho_strm,
+    int16 A_T[KYBER_K][KYBER_K][KYBER_N],
+    perf_t pf[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
+    perf_clear(pf);
+    perf_t t = PERF_NOW(0);
+    gen_matrix(rho_strm, A_T, 1);
+    PERF_TICK(PERF_ITERS_GEN_MATRIX);
+    PERF_MARK(pf, PERF_XOF, t);
+}
+
+// z của dk thường trú -> z_strm (thay cho decaps_read_dk ở resident mode)
+static void decaps_feed_z(uint8 z[32], hls::stream<ap_uint<64> >& z_strm) {
+    #pragma HLS INLINE off
+    for(int w=0; w<4; w++) {
+        #pragma HLS PIPELINE II=1
+        uint64_t val = 0;
+        for(int b=0; b<8; b++) val |= ((uint64_t)z[w*8 + b] << (b*8));
+        z_strm.write(val);
+    }
+}
+
+// z_strm -> z của dk thường trú (KEY_OP_LOAD)
+static void decaps_drain_z(hls::stream<ap_uint<64> >& z_strm, uint8 z[32]) {
+    #pragma HLS INLINE off
+    for(int w=0; w<4; w++) {
+        #pragma HLS PIPELINE II=1
+        uint64_t val = z_strm.read();
+        for(int b=0; b<8; b++) z[w*8 + b] = (uint8)(val >> (b*8));
+    }
+}
+
+// KEY_OP_LOAD: cùng các process load của decaps_core, ghi vào state thường trú
+static void decaps_load_resident(
+    uint8 sk_in[SK_SIZE],
+    int16 s_hat[KYBER_K][KYBER_N],
+    int16 t_hat[KYBER_K][KYBER_N],
+    int16 A_T[KYBER_K][KYBER_K][KYBER_N],
+    uint8 h_pk[32],
+    uint8 z[32],
+    int& status
+) {
+    #pragma HLS INLINE off
+    hls::stream<ap_uint<64> > rho_strm, z_strm, h_strm;
+    #pragma HLS STREAM variable=rho_strm depth=4
+    #pragma HLS STREAM variable=z_strm depth=4
+    #pragma HLS STREAM variable=h_strm depth=4
+    hls::stream<beat_t> s_strm, t_strm, ek_strm;
+    #pragma HLS STREAM variable=s_strm depth=4
+    #pragma HLS STREAM variable=t_strm depth=4
+    DO_PRAGMA(HLS STREAM variable=ek_strm depth=EK_BEATS)
+
+    perf_t pf_dk[PERF_SLOTS], pf_xof[PERF_SLOTS];
+
+    #pragma HLS DATAFLOW
+    decaps_read_dk(sk_in, rho_strm, z_strm, s_strm, t_strm, ek_strm, h_strm, h_pk, pf_dk);
+    decaps_check_dk(ek_strm, h_strm, status);
+    decaps_drain_z(z_strm, z);
+    decaps_decode_vec(s_strm, s_hat);
+    decaps_decode_vec(t_strm, t_hat);
+    decaps_xof(rho_strm, A_T, pf_xof);
+}
+
+// =========================================================
+// INGEST CT + J(z || c)
+// =========================================================
+// Đọc ct theo beat 128-bit: mỗi beat được decompress thẳng ra u / v, giữ
+// bản sao cho 2 bước compare (phần u và phần v tách riêng để mỗi buffer
+// chỉ có 1 consumer) và đẩy sang decaps_hash_j.
+static void decaps_read_ct(
+    uint8 ct_in[CT_SIZE],
+    hls::stream<beat_t>& j_strm,
+    int16 u_poly[KYBER_K][KYBER_N],
+    int16 v_poly[KYBER_N],
+    uint8 ct_u[CT_U_BYTES],
+    uint8 ct_v[KYBER_POLYCOMP_V],
+    perf_t pf[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
+    perf_clear(pf);
+    perf_t t = PERF_NOW(0);
+
+    // 8 hệ số d-bit = d byte: gom d byte rồi tách ra 8 hệ số
+    ap_uint<8*KYBER_DU> acc_u = 0;
+    ap_uint<8*KYBER_DV> acc_v = 0;
+    int nb = 0;
+    int cidx = 0;
+    Read_CT_Loop: for(int i=0; i<CT_BEATS; i++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        beat_t beat = 0;
+        for(int b=0; b<AXI_BEAT_BYTES; b++) beat |= (beat_t)ct_in[i*AXI_BEAT_BYTES + b] << (b*8);
+        j_strm.write(beat);
+
+        // Decompress: byte 0..CT_U_BYTES-1 -> u (d=du), phần còn lại -> v (d=dv)
+        for(int b=0; b<AXI_BEAT_BYTES; b++) {
+            int p = i*AXI_BEAT_BYTES + b;
+            uint8 byte = (uint8)beat.range(8*b + 7, 8*b);
+            if (p < CT_U_BYTES) {
+                ct_u[p] = byte;
+                acc_u |= (ap_uint<8*KYBER_DU>)byte << (8*nb);
+                nb++;
+                if (nb == KYBER_DU) {
+                    for(int k=0; k<8; k++) {
+                        ap_uint<32> val = (ap_uint<32>)acc_u.range(KYBER_DU*k + KYBER_DU - 1, KYBER_DU*k) * KYBER_Q;
+                        u_poly[cidx >> 8][(cidx & 255) + k] = (int16)((val + (1 << (KYBER_DU - 1))) >> KYBER_DU);
+                    }
+                    cidx += 8;
+                    acc_u = 0;
+                    nb = 0;
+                }
+            } else {
+                ct_v[p - CT_U_BYTES] = byte;
+                acc_v |= (ap_uint<8*KYBER_DV>)byte << (8*nb);
+                nb++;
+                if (nb == KYBER_DV) {
+                    for(int k=0; k<8; k++) {
+                        ap_uint<32> val = (ap_uint<32>)acc_v.range(KYBER_DV*k + KYBER_DV - 1, KYBER_DV*k) * KYBER_Q;
+                        v_poly[(cidx & 255) + k] = (int16)((val + (1 << (KYBER_DV - 1))) >> KYBER_DV);
+                    }
+                    cidx += 8;
+                    acc_v = 0;
+                    nb = 0;
+                }
+            }
+        }
+    }
+    PERF_MARK(pf, PERF_LOAD, t);
+}
+
+// K_bar = J(z || c) = SHAKE256(z || c, 32) (FIPS 203, implicit rejection)
+// z đến từ z_strm ngay đầu kernel nên absorb chạy song song với decompress,
+// khoá từ chối sẵn sàng trước khi decrypt xong.
+static void decaps_hash_j(
+    hls::stream<ap_uint<64> >& z_strm,
+    hls::stream<beat_t>& j_strm,
+    uint8 K_bar[32],
+    perf_t pf[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
+    perf_clear(pf);
+    perf_t t = PERF_NOW(0);
+
+    uint64_t state[25];
+    #pragma HLS ARRAY_PARTITION variable=state type=complete
+    for(int i=0; i<25; i++) {
         #pragma HLS UNROLL
-        for(int k=0; k<256; k++) {
-            #pragma HLS PIPELINE II=1
-            u_hat[i][k] = u_poly[i][k];
+        state[i] = 0;
+    }
+
+    // z chiếm 4 lane đầu của block 1 (rate = 17 lanes)
+    for(int i=0; i<4; i++) {
+        #pragma HLS PIPELINE II=1
+        state[i] = z_strm.read();
+    }
+
+    int pos = 4;
+    Absorb_CT_Loop: for(int i=0; i<CT_BEATS; i++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        beat_t beat = j_strm.read();
+        for(int h=0; h<2; h++) {
+            state[pos] ^= (uint64_t)beat.range(64*h + 63, 64*h);
+            pos++;
+            if (pos == 17) {
+                keccak_f1600(state);
+                PERF_TICK(PERF_ITERS_KECCAK);
+                pos = 0;
+            }
         }
-        ntt(u_hat[i]); 
     }
 
-    int16 res_acc[KYBER_N];
-    #pragma HLS ARRAY_PARTITION variable=res_acc cyclic factor=2
-    
-    int16 prod_matrix[KYBER_K][KYBER_N];
-    #pragma HLS ARRAY_PARTITION variable=prod_matrix dim=1 complete
-    #pragma HLS ARRAY_PARTITION variable=prod_matrix dim=2 cyclic factor=2
-    
-    Pointwise_Loop: for(int i=0; i<KYBER_K; i++) {
+    // 768: 32 + 1088 = 1120 bytes = 8 block đầy + 4 lane -> pad ở lane 4
+    state[pos] ^= 0x1F;
+    state[16] ^= (1ULL << 63);
+    keccak_f1600(state);
+    PERF_TICK(PERF_ITERS_KECCAK);
+
+    for(int i=0; i<4; i++) {
         #pragma HLS UNROLL
-        poly_pointwise(s_hat[i], u_hat[i], prod_matrix[i]);
+        uint64_t w = state[i];
+        for(int j=0; j<8; j++) K_bar[i*8+j] = (uint8)(w >> (j*8));
     }
+    PERF_MARK(pf, PERF_HASH, t);
+}
+
+// =========================================================
+// DECRYPT: m' = Decode(v - invNTT(s^T * NTT(u))), (K', r') = G(m' || H(ek))
+// =========================================================
+static void decaps_decrypt(
+    int16 u_poly[KYBER_K][KYBER_N],
+    int16 v_poly[KYBER_N],
+    int16 s_hat[KYBER_K][KYBER_N],
+    uint8 h_pk[32],
+    uint8 m_prime[32],
+    uint8 Kr_prime[64],
+    perf_t pf[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
+
+    // Resources: Limit 3 for parallelism
+    DO_PRAGMA(HLS ALLOCATION function instances=keccak_f1600 limit=HW_KEM_KECCAK)
+    DO_PRAGMA(HLS ALLOCATION function instances=ntt limit=HW_KEM_NTT)
+    DO_PRAGMA(HLS ALLOCATION function instances=inv_ntt limit=HW_KEM_NTT)
 
-    Sum_Loop: for(int k=0; k<256; k++) {
-        #pragma HLS PIPELINE II=2 
-        ap_int<16> sum = 0;
-        for(int i=0; i<KYBER_K; i++) sum += prod_matrix[i][k];
-        while(sum >= KYBER_Q) sum -= KYBER_Q;
-        if(sum < 0) sum += KYBER_Q; 
-        res_acc[k] = (int16)sum;
+    perf_clear(pf);
+    perf_t t = PERF_NOW(0);
+
+    // --- DECRYPT ---
+    // NTT(u) in-place trên buffer decompress (decrypt là consumer duy nhất của
+    // u_poly), không copy sang u_hat
+    NTT_U_Loop: for(int i=0; i<KYBER_K; i++) {
+        #pragma HLS UNROLL
+        ntt(u_poly[i]);
+        PERF_TICK(PERF_ITERS_NTT);
     }
+
+    int16 res_acc[KYBER_N];
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=res_acc cyclic factor=HW_POLY_PART)
+
+    // s^T o u: K basemul + cộng dồn trong 1 pipeline
+    poly_basemul_acc(res_acc, s_hat, u_poly);
+    PERF_TICK(PERF_ITERS_BASEMUL);
+    PERF_MARK(pf, PERF_MATRIX, t);
     inv_ntt(res_acc);
+    PERF_TICK(PERF_ITERS_INVNTT);
+    PERF_MARK(pf, PERF_INVNTT, t);
 
-    uint8 m_prime[32];
-    #pragma HLS ARRAY_PARTITION variable=m_prime complete 
     Recover_Msg_Loop: for(int i=0; i<32; i++) {
         uint8 byte = 0;
         for(int j=0; j<8; j++) {
             #pragma HLS PIPELINE II=1
-            int idx = (int)(i*8+j); 
+            PERF_TICK(1);
+            int idx = (int)(i*8+j);
             int16 val = res_acc[idx] - v_poly[idx];
             if (val < 0) val += KYBER_Q;
-            if (val > (int16)((KYBER_Q+2)/4) && val < (int16)(3*KYBER_Q/4)) 
+            if (val > (int16)((KYBER_Q+2)/4) && val < (int16)(3*KYBER_Q/4))
                 byte |= (uint8)(1 << j);
         }
         m_prime[i] = byte;
     }
+    PERF_MARK(pf, PERF_COMPRESS, t);
 
     // --- RE-ENCRYPT ---
     uint8 g_in[64];
-    #pragma HLS ARRAY_PARTITION variable=g_in complete 
+    #pragma HLS ARRAY_PARTITION variable=g_in complete
     for(int i=0; i<32; i++) g_in[i] = m_prime[i];
-    for(int i=0; i<32; i++) g_in[32+i] = sk_local[2336+i]; 
-    
-    uint8 Kr_prime[64];
-    #pragma HLS ARRAY_PARTITION variable=Kr_prime complete
-    sha3_512_64bytes_decaps(g_in, Kr_prime); 
-    
+    for(int i=0; i<32; i++) g_in[32+i] = h_pk[i];
+
+    sha3_512_64bytes_decaps(g_in, Kr_prime);
+    PERF_TICK(PERF_ITERS_KECCAK);
+    PERF_MARK(pf, PERF_HASH, t);
+}
+
+// =========================================================
+// RE-ENCRYPT: NOISE -> MATRIX -> (COMPARE U || COMPARE V) -> SELECT
+// =========================================================
+// Noise của re-encrypt: r (eta1, nonce 0..K-1, NTT), e1 (eta2, nonce K..2K-1),
+// e2 (nonce 2K). e2 + m được cộng sẵn ở đây (ve) trong lúc matvec còn chạy.
+// K' (nửa đầu của G) được chuyển tiếp cho select: Kr_prime chỉ có 1 consumer.
+static void decaps_noise(
+    uint8 m_prime[32],
+    uint8 Kr_prime[64],
+    int16 r_hat[KYBER_K][KYBER_N],
+    int16 e1[KYBER_K][KYBER_N],
+    int16 ve[KYBER_N],
+    uint8 K_prime[32],
+    perf_t pf[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
+
+    DO_PRAGMA(HLS ALLOCATION function instances=ntt limit=HW_KEM_NTT)
+
+    perf_clear(pf);
+    perf_t t = PERF_NOW(0);
+
     uint8 seed_r_prime[32];
     #pragma HLS ARRAY_PARTITION variable=seed_r_prime complete
-    for(int i=0; i<32; i++) seed_r_prime[i] = Kr_prime[32+i];
+    for(int i=0; i<32; i++) {
+        #pragma HLS UNROLL
+        K_prime[i] = Kr_prime[i];
+        seed_r_prime[i] = Kr_prime[32+i];
+    }
 
-    uint8* pk_ptr = &sk_local[1152];
-    uint8 rho[32];
-    #pragma HLS ARRAY_PARTITION variable=rho complete
-    int16 t_hat[KYBER_K][KYBER_N];
-    #pragma HLS ARRAY_PARTITION variable=t_hat dim=1 type=complete
-    #pragma HLS ARRAY_PARTITION variable=t_hat dim=2 cyclic factor=2
-    
-    for(int i=0; i<KYBER_K; i++) {
+    int16 e2[KYBER_N];
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=e2 cyclic factor=HW_POLY_PART)
+    int16 m_poly_new[KYBER_N];
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=m_poly_new cyclic factor=HW_POLY_PART)
+
+    Gen_Noise_Loop: for(int i=0; i<KYBER_K; i++) {
+        #pragma HLS UNROLL
+        sample_poly_cbd<KYBER_ETA1>(seed_r_prime, (uint8)i, r_hat[i]);
+        ntt(r_hat[i]);
+        sample_poly_cbd<KYBER_ETA2>(seed_r_prime, (uint8)(KYBER_K + i), e1[i]);
+        PERF_TICK(PERF_ITERS_CBD(KYBER_ETA1) + PERF_ITERS_NTT + PERF_ITERS_CBD(KYBER_ETA2));
+    }
+    sample_poly_cbd<KYBER_ETA2>(seed_r_prime, (uint8)(2 * KYBER_K), e2);
+    poly_frommsg(m_prime, m_poly_new);
+    poly_add<HW_POLY_PART>(e2, m_poly_new, ve);
+    PERF_TICK(PERF_ITERS_CBD(KYBER_ETA2) + PERF_ITERS_MSG + KYBER_N / HW_POLY_PART);
+    PERF_MARK(pf, PERF_NOISE, t);
+}
+
+// u = A^T o r, v = t^T o r (miền NTT), 1 lượt qua matvec engine
+static void decaps_matrix(
+    int16 A_T[KYBER_K][KYBER_K][KYBER_N],
+    int16 t_hat[KYBER_K][KYBER_N],
+    int16 r_hat[KYBER_K][KYBER_N],
+    int16 u_prime[KYBER_K][KYBER_N],
+    int16 v_acc[KYBER_N],
+    perf_t pf[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
+    perf_clear(pf);
+    perf_t t = PERF_NOW(0);
+    matvec_At_t(A_T, t_hat, r_hat, u_prime, v_acc);
+    PERF_TICK(PERF_ITERS_MATVEC_AT_T);
+    PERF_MARK(pf, PERF_MATRIX, t);
+}
+
+// Field d-bit thứ k (d <= 11) của vùng bắt đầu tại byte base trong ct:
+// bit offset (k*d) & 7 + d <= 18 -> tối đa 3 byte
+template <int SIZE>
+static ap_uint<16> ct_field(uint8 ct[SIZE], int base, int k, int d) {
+    #pragma HLS INLINE
+    int bit = k * d;
+    int idx = base + (bit >> 3);
+    ap_uint<24> w = (ap_uint<24>)ct[idx];
+    if (idx + 1 < SIZE) w |= (ap_uint<24>)ct[idx + 1] << 8;
+    if (idx + 2 < SIZE) w |= (ap_uint<24>)ct[idx + 2] << 16;
+    return (ap_uint<16>)((w >> (bit & 7)) & ((1 << d) - 1));
+}
+
+// 1 đa thức của ct' so với ct: acc vừa qua inv_ntt_layers, mỗi hệ số
+// (x F^-1) + add -> reduce -> Compress_D -> XOR với field tương ứng của ct.
+// Trả về OR của mọi sai khác.
+template <int D, int SIZE>
+static ap_uint<D> decaps_cmp_poly(
+    int16 acc[KYBER_N],
+    int16 add[KYBER_N],
+    uint8 ct[SIZE],
+    int byte_base
+) {
+    #pragma HLS INLINE off
+    ap_uint<D> d = 0;
+    Cmp_Loop: for(int k=0; k<KYBER_N; k++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        int16 val = poly_reduce_wide((poly_wide_t)inv_ntt_scale(acc[k]) + add[k]);
+
+        ap_uint<32> tc = (ap_uint<32>)val * (1 << D) + 1664;
+        ap_uint<D> c_new = (ap_uint<D>)((tc / KYBER_Q) & ((1 << D) - 1));
+        ap_uint<D> c_old = (ap_uint<D>)ct_field<SIZE>(ct, byte_base, k, D);
+        d |= (c_new ^ c_old);
+    }
+    return d;
+}
+
+// u': mỗi hàng được so ngay khi inv_ntt của nó xong, chạy song song với
+// decaps_cmp_v (khác process, khác buffer ct)
+static void decaps_cmp_u(
+    int16 u_prime[KYBER_K][KYBER_N],
+    int16 e1[KYBER_K][KYBER_N],
+    uint8 ct_u[CT_U_BYTES],
+    hls::stream<ap_uint<KYBER_DU> >& diff_strm,
+    perf_t pf[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
+
+    DO_PRAGMA(HLS ALLOCATION function instances=inv_ntt_layers limit=HW_KEM_NTT)
+
+    perf_clear(pf);
+    perf_t t = PERF_NOW(0);
+
+    ap_uint<KYBER_DU> diff = 0;
+    Compare_U_Loop: for(int i=0; i<KYBER_K; i++) {
         #pragma HLS UNROLL
-        poly_frombytes(&pk_ptr[i*384], t_hat[i]);
+        inv_ntt_layers(u_prime[i]);
+        PERF_TICK(PERF_ITERS_NTT);
+        diff |= decaps_cmp_poly<KYBER_DU, CT_U_BYTES>(u_prime[i], e1[i], ct_u, i*KYBER_POLYCOMP_U);
     }
-    for(int i=0; i<32; i++) rho[i] = pk_ptr[1152+i];
+    diff_strm.write(diff);
+    PERF_MARK(pf, PERF_COMPARE, t);
+}
 
-    int16 r_hat[KYBER_K][KYBER_N];
-    #pragma HLS ARRAY_PARTITION variable=r_hat dim=1 complete
-    #pragma HLS ARRAY_PARTITION variable=r_hat dim=2 cyclic factor=2
-    
-    int16 u_prime[KYBER_K][KYBER_N] = {0}; // Initialize to 0 for accumulation
-    #pragma HLS ARRAY_PARTITION variable=u_prime dim=1 complete
-    #pragma HLS ARRAY_PARTITION variable=u_prime dim=2 cyclic factor=2
-
-    // --- FUSED MATRIX GEN & MULTIPLICATION ---
-    // Outer Loop: Columns j (Sequential)
-    // Inner Loop: Rows i (Parallel)
-    Fused_Gen_Loop: for(int j=0; j<KYBER_K; j++) {
-        
-        // 1. Generate r[j] (Sequential part for this col)
-        uint8 prf_in[33];
-        #pragma HLS ARRAY_PARTITION variable=prf_in complete
-        for(int k=0; k<32; k++) prf_in[k] = seed_r_prime[k];
-        prf_in[32] = (uint8)j; // nonce for r is 0,1,2 (same as j)
-        
-        uint64_t cbd_out_r[16];
-        shake256_prf(prf_in, cbd_out_r);
-        
-        int16 temp_r[256];
-        #pragma HLS ARRAY_PARTITION variable=temp_r cyclic factor=2
-        cbd_eta2((ap_uint<64>*)cbd_out_r, temp_r);
-        ntt(temp_r);
-        
-        // Store r_hat[j] for later use (v_prime)
-        for(int k=0; k<256; k++) {
-            #pragma HLS PIPELINE II=1
-            r_hat[j][k] = temp_r[k];
-        }
+static void decaps_cmp_v(
+    int16 v_acc[KYBER_N],
+    int16 ve[KYBER_N],
+    uint8 ct_v[KYBER_POLYCOMP_V],
+    hls::stream<ap_uint<KYBER_DV> >& diff_strm,
+    perf_t pf[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
+    perf_clear(pf);
+    perf_t t = PERF_NOW(0);
 
-        // 2. Matrix Mult Column j: A[j][i] * r[j]
-        // This runs for all rows i=0,1,2 in PARALLEL
-        Parallel_Row_Loop: for(int i=0; i<KYBER_K; i++) {
-            #pragma HLS UNROLL
-            
-            // Gen A[j][i] (Transpose logic: matrix A is row-major normally, but we gen A^T)
-            // A_hat definition in standard is A[i][j].
-            // We need A^T * r => u[i] += A[j][i] * r[j]
-            // We generate A[j][i] on the fly.
-            
-            ap_uint<64> xof_in[5];
-            #pragma HLS ARRAY_PARTITION variable=xof_in complete
-            for(int w=0; w<4; w++) {
-                #pragma HLS UNROLL
-                uint64_t val = 0;
-                for(int b=0; b<8; b++) val |= ((uint64_t)rho[w*8+b] << (b*8));
-                xof_in[w] = val;
-            }
-            xof_in[4] = (uint64_t)i | ((uint64_t)j << 8); // index j, i
-            
-            hls::stream<uint8> strm;
-            #pragma HLS STREAM variable=strm depth=256
-            int16 A_ji[256];
-            #pragma HLS ARRAY_PARTITION variable=A_ji cyclic factor=2
-            
-            xof_absorb_squeeze(xof_in, strm);
-            parse_ntt(strm, A_ji);
-            
-            int16 prod[256];
-            poly_pointwise(A_ji, temp_r, prod); // Use temp_r directly
-            
-            // Accumulate into u_prime
-            for(int k=0; k<256; k++) {
-                #pragma HLS PIPELINE II=2
-                ap_int<16> sum = (ap_int<16>)u_prime[i][k] + prod[k];
-                while(sum >= KYBER_Q) sum -= KYBER_Q;
-                u_prime[i][k] = (int16)sum;
-            }
-        }
+    inv_ntt_layers(v_acc);
+    PERF_TICK(PERF_ITERS_NTT);
+    diff_strm.write(decaps_cmp_poly<KYBER_DV, KYBER_POLYCOMP_V>(v_acc, ve, ct_v, 0));
+    PERF_MARK(pf, PERF_COMPARE, t);
+}
+
+// Constant-time select: mask = 0xFF nếu ct' != ct, hai nhánh cùng latency
+static void decaps_select(
+    hls::stream<ap_uint<KYBER_DU> >& diff_u_strm,
+    hls::stream<ap_uint<KYBER_DV> >& diff_v_strm,
+    uint8 K_prime[32],
+    uint8 K_bar[32],
+    uint8 ss_out[SS_SIZE],
+    perf_t pf[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
+    perf_clear(pf);
+    perf_t t = PERF_NOW(0);
+
+    ap_uint<KYBER_DU> diff = diff_u_strm.read();
+    diff |= (ap_uint<KYBER_DU>)diff_v_strm.read();
+    uint8 mask = (uint8)(0 - (ap_uint<8>)(diff != 0));
+
+    for(int i=0; i<32; i++) {
+        #pragma HLS UNROLL
+        ss_out[i] = K_prime[i] ^ (mask & (K_prime[i] ^ K_bar[i]));
     }
+    PERF_TICK(SS_SIZE / AXI_BEAT_BYTES);
+    PERF_MARK(pf, PERF_STORE, t);
+}
 
-    // Finalize u_prime: InvNTT and Add e1
-    Finalize_U_Loop: for(int i=0; i<KYBER_K; i++) {
+// Gom perf của các process nửa ct (1 writer cho pf_half)
+static void decaps_perf_collect_ct(
+    perf_t pf_ct[PERF_SLOTS],
+    perf_t pf_j[PERF_SLOTS],
+    perf_t pf_dec[PERF_SLOTS],
+    perf_t pf_noise[PERF_SLOTS],
+    perf_t pf_mat[PERF_SLOTS],
+    perf_t pf_cu[PERF_SLOTS],
+    perf_t pf_cv[PERF_SLOTS],
+    perf_t pf_sel[PERF_SLOTS],
+    perf_t pf_half[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
+    perf_t acc[PERF_SLOTS];
+    #pragma HLS ARRAY_PARTITION variable=acc complete
+    perf_clear(acc);
+    perf_merge(pf_ct, acc);
+    perf_merge(pf_j, acc);
+    perf_merge(pf_dec, acc);
+    perf_merge(pf_noise, acc);
+    perf_merge(pf_mat, acc);
+    perf_merge(pf_cu, acc);
+    perf_merge(pf_cv, acc);
+    perf_merge(pf_sel, acc);
+    for(int i=0; i<PERF_SLOTS; i++) {
         #pragma HLS UNROLL
-        
-        // Inverse NTT for u[i]
-        inv_ntt(u_prime[i]);
-        
-        // Gen e1[i] and Add
-        uint8 prf_in[33];
-        #pragma HLS ARRAY_PARTITION variable=prf_in complete
-        for(int k=0; k<32; k++) prf_in[k] = seed_r_prime[k];
-        prf_in[32] = (uint8)(3 + i); 
-        
-        uint64_t cbd_out_e1[16];
-        shake256_prf(prf_in, cbd_out_e1);
-        int16 e1_i[256];
-        #pragma HLS ARRAY_PARTITION variable=e1_i cyclic factor=2
-        cbd_eta2((ap_uint<64>*)cbd_out_e1, e1_i);
-        
-        for(int k=0; k<256; k++) {
-            #pragma HLS PIPELINE II=1
-            ap_int<16> val = (ap_int<16>)u_prime[i][k] + e1_i[k];
-            while(val >= KYBER_Q) val -= KYBER_Q;
-            if(val < 0) val += KYBER_Q;
-            u_prime[i][k] = (int16)val;
-        }
+        pf_half[i] = acc[i];
     }
+}
 
-    // Calc v_prime
-    int16 v_prime[256];
-    #pragma HLS ARRAY_PARTITION variable=v_prime cyclic factor=2
-    
-    // Gen e2
-    int16 e2[256];
-    #pragma HLS ARRAY_PARTITION variable=e2 cyclic factor=2
-    {
-        uint8 prf_in[33];
-        for(int k=0; k<32; k++) prf_in[k] = seed_r_prime[k];
-        prf_in[32] = 6;
-        uint64_t cbd_out[16];
-        shake256_prf(prf_in, cbd_out);
-        cbd_eta2((ap_uint<64>*)cbd_out, e2);
+// Gom perf của decaps_core (process cuối, 1 writer cho perf[])
+static void decaps_perf_collect(
+    perf_t pf_dk[PERF_SLOTS],
+    perf_t pf_xof[PERF_SLOTS],
+    perf_t pf_half[PERF_SLOTS],
+    perf_t perf[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
+    perf_t acc[PERF_SLOTS];
+    #pragma HLS ARRAY_PARTITION variable=acc complete
+    perf_clear(acc);
+    perf_merge(pf_dk, acc);
+    perf_merge(pf_xof, acc);
+    perf_merge(pf_half, acc);
+    for(int i=0; i<PERF_SLOTS; i++) {
+        #pragma HLS UNROLL
+        perf[i] = acc[i];
     }
-    
-    // v = t*r + e2 + m
-    {
-        int16 v_acc[256] = {0};
-        #pragma HLS ARRAY_PARTITION variable=v_acc cyclic factor=2
-        for(int i=0; i<KYBER_K; i++) {
+}
+
+// Nửa ct của mạng Decaps: read_ct -> hash_j / decrypt -> noise -> matrix
+// -> cmp_u / cmp_v -> select. INLINE vào vùng DATAFLOW của caller nên các
+// process ở đây vẫn chạy chồng với read_dk / decode / xof của decaps_core;
+// z_strm do caller cấp (read_dk hoặc z thường trú).
+static void decaps_ct_half(
+    uint8 ct_in[CT_SIZE],
+    hls::stream<ap_uint<64> >& z_strm,
+    int16 s_hat[KYBER_K][KYBER_N],
+    int16 t_hat[KYBER_K][KYBER_N],
+    int16 A_T[KYBER_K][KYBER_K][KYBER_N],
+    uint8 h_pk[32],
+    uint8 ss_out[SS_SIZE],
+    perf_t pf_half[PERF_SLOTS]
+) {
+    #pragma HLS INLINE
+
+    int16 u_poly[KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=u_poly dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=u_poly dim=2 cyclic factor=HW_POLY_PART)
+    int16 v_poly[KYBER_N];
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=v_poly cyclic factor=HW_POLY_PART)
+
+    int16 r_hat[KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=r_hat dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=r_hat dim=2 cyclic factor=HW_POLY_PART)
+    int16 e1[KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=e1 dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=e1 dim=2 cyclic factor=HW_POLY_PART)
+    int16 ve[KYBER_N];
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=ve cyclic factor=HW_POLY_PART)
+
+    int16 u_prime[KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=u_prime dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=u_prime dim=2 cyclic factor=HW_POLY_PART)
+    int16 v_acc[KYBER_N];
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=v_acc cyclic factor=HW_POLY_PART)
+
+    uint8 ct_u[CT_U_BYTES];
+    #pragma HLS ARRAY_RESHAPE variable=ct_u cyclic factor=16
+    uint8 ct_v[KYBER_POLYCOMP_V];
+    #pragma HLS ARRAY_RESHAPE variable=ct_v cyclic factor=16
+    uint8 K_bar[32], K_prime[32], m_prime[32], Kr_prime[64];
+    #pragma HLS ARRAY_PARTITION variable=K_bar complete
+    #pragma HLS ARRAY_PARTITION variable=K_prime complete
+    #pragma HLS ARRAY_PARTITION variable=m_prime complete
+    #pragma HLS ARRAY_PARTITION variable=Kr_prime complete
+
+    hls::stream<beat_t> j_strm;
+    DO_PRAGMA(HLS STREAM variable=j_strm depth=CT_BEATS)
+    hls::stream<ap_uint<KYBER_DU> > diff_u_strm;
+    #pragma HLS STREAM variable=diff_u_strm depth=2
+    hls::stream<ap_uint<KYBER_DV> > diff_v_strm;
+    #pragma HLS STREAM variable=diff_v_strm depth=2
+
+    perf_t pf_ct[PERF_SLOTS], pf_j[PERF_SLOTS], pf_dec[PERF_SLOTS], pf_noise[PERF_SLOTS];
+    perf_t pf_mat[PERF_SLOTS], pf_cu[PERF_SLOTS], pf_cv[PERF_SLOTS], pf_sel[PERF_SLOTS];
+    #pragma HLS ARRAY_PARTITION variable=pf_ct complete
+    #pragma HLS ARRAY_PARTITION variable=pf_j complete
+    #pragma HLS ARRAY_PARTITION variable=pf_dec complete
+    #pragma HLS ARRAY_PARTITION variable=pf_noise complete
+    #pragma HLS ARRAY_PARTITION variable=pf_mat complete
+    #pragma HLS ARRAY_PARTITION variable=pf_cu complete
+    #pragma HLS ARRAY_PARTITION variable=pf_cv complete
+    #pragma HLS ARRAY_PARTITION variable=pf_sel complete
+
+    decaps_read_ct(ct_in, j_strm, u_poly, v_poly, ct_u, ct_v, pf_ct);
+    decaps_hash_j(z_strm, j_strm, K_bar, pf_j);
+    decaps_decrypt(u_poly, v_poly, s_hat, h_pk, m_prime, Kr_prime, pf_dec);
+    decaps_noise(m_prime, Kr_prime, r_hat, e1, ve, K_prime, pf_noise);
+    decaps_matrix(A_T, t_hat, r_hat, u_prime, v_acc, pf_mat);
+    decaps_cmp_u(u_prime, e1, ct_u, diff_u_strm, pf_cu);
+    decaps_cmp_v(v_acc, ve, ct_v, diff_v_strm, pf_cv);
+    decaps_select(diff_u_strm, diff_v_strm, K_prime, K_bar, ss_out, pf_sel);
+    decaps_perf_collect_ct(pf_ct, pf_j, pf_dec, pf_noise, pf_mat, pf_cu, pf_cv, pf_sel, pf_half);
+}
+
+// Decrypt + re-encrypt trên key đã decode / A^T đã expand (resident mode)
+static void decaps_compute(
+    uint8 ct_in[CT_SIZE],
+    int16 s_hat[KYBER_K][KYBER_N],
+    int16 t_hat[KYBER_K][KYBER_N],
+    int16 A_T[KYBER_K][KYBER_K][KYBER_N],
+    uint8 h_pk[32],
+    uint8 z[32],
+    uint8 ss_out[SS_SIZE]
+) {
+    #pragma HLS INLINE off
+
+    hls::stream<ap_uint<64> > z_strm;
+    #pragma HLS STREAM variable=z_strm depth=4
+
+    // Resident mode không xuất perf: pf_half bị bỏ
+    perf_t pf_half[PERF_SLOTS];
+    #pragma HLS ARRAY_PARTITION variable=pf_half complete
+
+    // Cùng mạng với decaps_core, z lấy từ dk thường trú thay cho read_dk
+    #pragma HLS DATAFLOW
+    decaps_feed_z(z, z_strm);
+    decaps_ct_half(ct_in, z_strm, s_hat, t_hat, A_T, h_pk, ss_out, pf_half);
+}
+
+// Thân Decaps dùng chung cho ml_kem_decaps (1 dk, 1 ct)
+// DATAFLOW, mỗi channel 1 producer / 1 consumer:
+//   read_dk -> rho -> xof ------------------------------> A_T ----+
+//           -> s beats -> decode_vec -> s_hat --+                 |
+//           -> t beats -> decode_vec -> t_hat --|-----------------+-> matrix -> u' -> cmp_u --+
+//           -> z --------------------+          |                 |          -> v' -> cmp_v --+-> select
+//   read_ct -> ct beats -> hash_j ---+----------|---------- K_bar ---------------------------+
+//           -> u, v -------------------------> decrypt -> noise -> r, e1, e2+m, K' ----------+
+// decompress / NTT(u) / decode t_hat / expand A^T chạy chồng nhau; inv_ntt + compare
+// của u' và v' là 2 process song song, mỗi hàng u' được so ngay khi inv_ntt xong.
+// check_dk (hash check) chạy bên cạnh, chỉ ghi status, ss vẫn được tính.
+void decaps_core(
+    uint8 sk_in[SK_SIZE],
+    uint8 ct_in[CT_SIZE],
+    uint8 ss_out[SS_SIZE],
+    int& status,
+    perf_t perf[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
+
+    int16 s_hat[KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=s_hat dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=s_hat dim=2 cyclic factor=HW_POLY_PART)
+
+    int16 t_hat[KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=t_hat dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=t_hat dim=2 cyclic factor=HW_POLY_PART)
+
+    int16 A_T[KYBER_K][KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=A_T dim=1 type=complete
+    #pragma HLS ARRAY_PARTITION variable=A_T dim=2 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=A_T dim=3 cyclic factor=HW_POLY_PART)
+
+    uint8 h_pk[32];
+    #pragma HLS ARRAY_PARTITION variable=h_pk complete
+
+    hls::stream<ap_uint<64> > rho_strm;
+    #pragma HLS STREAM variable=rho_strm depth=4
+    hls::stream<beat_t> s_strm, t_strm;
+    #pragma HLS STREAM variable=s_strm depth=4
+    #pragma HLS STREAM variable=t_strm depth=4
+    hls::stream<beat_t> ek_strm;
+    DO_PRAGMA(HLS STREAM variable=ek_strm depth=EK_BEATS)
+    hls::stream<ap_uint<64> > h_strm;
+    #pragma HLS STREAM variable=h_strm depth=4
+
+    hls::stream<ap_uint<64> > z_strm;
+    #pragma HLS STREAM variable=z_strm depth=4
+
+    perf_t pf_dk[PERF_SLOTS], pf_xof[PERF_SLOTS], pf_half[PERF_SLOTS];
+    #pragma HLS ARRAY_PARTITION variable=pf_dk complete
+    #pragma HLS ARRAY_PARTITION variable=pf_xof complete
+    #pragma HLS ARRAY_PARTITION variable=pf_half complete
+
+    #pragma HLS DATAFLOW
+    decaps_read_dk(sk_in, rho_strm, z_strm, s_strm, t_strm, ek_strm, h_strm, h_pk, pf_dk);
+    decaps_check_dk(ek_strm, h_strm, status);
+    decaps_decode_vec(s_strm, s_hat);
+    decaps_decode_vec(t_strm, t_hat);
+    decaps_xof(rho_strm, A_T, pf_xof);
+    decaps_ct_half(ct_in, z_strm, s_hat, t_hat, A_T, h_pk, ss_out, pf_half);
+    decaps_perf_collect(pf_dk, pf_xof, pf_half, perf);
+}
+
+// perf: cycle theo phase PERF_* (AXI-lite, host chỉ đọc), đếm bằng perf_clock_now
+// ap_return = KEY_STATUS_OK / KEY_STATUS_BAD_DK
+int ml_kem_decaps(
+    uint8 sk_in[SK_SIZE],
+    uint8 ct_in[CT_SIZE],
+    uint8 ss_out[SS_SIZE],
+    perf_t perf[PERF_SLOTS]
+) {
+    #pragma HLS INTERFACE m_axi port=sk_in bundle=gmem0 depth=SK_SIZE max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=ct_in bundle=gmem1 depth=CT_SIZE max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=ss_out bundle=gmem2 depth=32 max_widen_bitwidth=128
+    #pragma HLS INTERFACE s_axilite port=perf
+    #pragma HLS INTERFACE s_axilite port=return
+
+    perf_t t_start = PERF_NOW(0);
+    int status;
+    decaps_core(sk_in, ct_in, ss_out, status, perf);
+    perf[PERF_TOTAL] = PERF_NOW(t_start) - t_start;
+    return status;
+}
+
+// KEY_OP_CLEAR / LOAD lỗi: ghi 0 đè phần bí mật của dk thường trú (s_hat, z),
+// H(ek) xoá kèm. t_hat / A^T suy ra từ ek công khai nên giữ nguyên.
+static void decaps_clear_resident(int16 s_hat[KYBER_K][KYBER_N], uint8 h_pk[32], uint8 z[32]) {
+    #pragma HLS INLINE off
+    Clear_S_Loop: for(int i=0; i<KYBER_N; i+=HW_POLY_PART) {
+        #pragma HLS PIPELINE II=1
+        for(int k=0; k<KYBER_K; k++) {
             #pragma HLS UNROLL
-            int16 prod[256];
-            poly_pointwise(t_hat[i], r_hat[i], prod);
-            for(int k=0; k<256; k++) {
-                #pragma HLS PIPELINE II=2
-                ap_int<16> sum = (ap_int<16>)v_acc[k] + prod[k];
-                while(sum >= KYBER_Q) sum -= KYBER_Q;
-                v_acc[k] = (int16)sum;
+            for(int l=0; l<HW_POLY_PART; l++) {
+                #pragma HLS UNROLL
+                s_hat[k][i + l] = 0;
             }
         }
-        inv_ntt(v_acc);
-        int16 m_poly_new[256];
-        poly_frommsg(m_prime, m_poly_new);
-        for(int k=0; k<256; k++) {
-            #pragma HLS PIPELINE II=1
-            ap_int<16> val = (ap_int<16>)v_acc[k] + e2[k] + m_poly_new[k];
-            while(val >= KYBER_Q) val -= KYBER_Q;
-            if(val < 0) val += KYBER_Q;
-            v_prime[k] = (int16)val;
-        }
     }
-
-    // Compare
-    uint8 fail = 0;
-    for(int i=0; i<KYBER_K; i++) {
+    for(int i=0; i<32; i++) {
         #pragma HLS UNROLL
-        uint8 cmp_buf[320];
-        poly_compress_u(u_prime[i], cmp_buf);
-        for(int k=0; k<320; k++) {
-            #pragma HLS PIPELINE II=1
-            if (ct_local[(int)(i*320 + k)] != cmp_buf[k]) fail = 1;
-        }
+        h_pk[i] = 0;
+        z[i] = 0;
     }
-    uint8 v_cmp_buf[128];
-    poly_compress_v(v_prime, v_cmp_buf);
-    for(int k=0; k<128; k++) {
-        #pragma HLS PIPELINE II=1
-        if (ct_local[(int)(KYBER_K*320 + k)] != v_cmp_buf[k]) fail = 1;
+}
+
+// =========================================================
+// DK-RESIDENT STREAMING DECAPS
+// =========================================================
+// KEY_OP_LOAD: nạp dk, decode s_hat / t_hat ở dạng NTT, expand A^T vào BRAM.
+//              dk không qua hash check -> KEY_STATUS_BAD_DK, key không được nạp.
+// KEY_OP_RUN : giải mã lần lượt n_ct ciphertext trong ct_in (CT_SIZE bytes / ct),
+//              mỗi ct chỉ còn decompress, NTT(u), basemul, m' và re-encrypt.
+// KEY_OP_CLEAR: ghi 0 đè s_hat / z trong BRAM, RUN sau đó trả KEY_STATUS_NO_KEY
+//              (như SESSION_OP_CLEAR); dk không được giữ tới lần LOAD sau.
+// ap_return = KEY_STATUS_*.
+int ml_kem_decaps_resident(
+    int op,
+    int n_ct,
+    uint8 sk_in[SK_SIZE],
+    uint8 ct_in[CT_SIZE * DECAPS_BATCH_MAX],
+    uint8 ss_out[SS_SIZE * DECAPS_BATCH_MAX]
+) {
+    #pragma HLS INTERFACE s_axilite port=op
+    #pragma HLS INTERFACE s_axilite port=n_ct
+    #pragma HLS INTERFACE m_axi port=sk_in bundle=gmem0 depth=SK_SIZE max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=ct_in bundle=gmem1 depth=CT_BATCH_BYTES max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=ss_out bundle=gmem2 depth=SS_BATCH_BYTES max_widen_bitwidth=128
+    #pragma HLS INTERFACE s_axilite port=return
+
+    // Trạng thái giữ lại giữa các lần gọi kernel
+    static int16 dk_s_hat[KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=dk_s_hat dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=dk_s_hat dim=2 cyclic factor=HW_POLY_PART)
+
+    static int16 dk_t_hat[KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=dk_t_hat dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=dk_t_hat dim=2 cyclic factor=HW_POLY_PART)
+
+    static int16 dk_A_T[KYBER_K][KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=dk_A_T dim=1 type=complete
+    #pragma HLS ARRAY_PARTITION variable=dk_A_T dim=2 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=dk_A_T dim=3 cyclic factor=HW_POLY_PART)
+
+    static uint8 dk_h[32], dk_z[32];
+    #pragma HLS ARRAY_PARTITION variable=dk_h complete
+    #pragma HLS ARRAY_PARTITION variable=dk_z complete
+    static bool dk_valid = false;
+
+    if (op == KEY_OP_CLEAR) {
+        decaps_clear_resident(dk_s_hat, dk_h, dk_z);
+        dk_valid = false;
+        return KEY_STATUS_OK;
     }
 
-    if (fail == 0) {
-        for(int i=0; i<32; i++) ss_out[i] = Kr_prime[i];
-    } else {
-        uint8 fail_input[32 + CT_SIZE];
-        for(int i=0; i<32; i++) fail_input[i] = sk_local[2368+i]; 
-        for(int i=0; i<CT_SIZE; i++) fail_input[32+i] = ct_local[i]; 
-        
-        uint8 fail_hash[64];
-        sha3_512_64bytes_decaps(fail_input, fail_hash);
-        for(int i=0; i<32; i++) ss_out[i] = fail_hash[i]; 
+    if (op == KEY_OP_LOAD) {
+        int status;
+        decaps_load_resident(sk_in, dk_s_hat, dk_t_hat, dk_A_T, dk_h, dk_z, status);
+        dk_valid = (status == KEY_STATUS_OK);
+        if (!dk_valid) decaps_clear_resident(dk_s_hat, dk_h, dk_z);
+        return status;
     }
-}
\ No newline at end of file
+
+    if (!dk_valid) return KEY_STATUS_NO_KEY;
+
+    Stream_CT_Loop: for(int c=0; c<n_ct; c++) {
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=DECAPS_BATCH_MAX
+        decaps_compute(&ct_in[c * CT_SIZE], dk_s_hat, dk_t_hat, dk_A_T, dk_h, dk_z, &ss_out[c * SS_SIZE]);
+    }
+    return KEY_STATUS_OK;
+}
@@ -0,0 +1,45 @@
+#include "params.h"
+#include "ap_int.h"
+
+extern void keccak_f1600(uint64_t state[25]);
+
+// =========================================================
+// ON-CHIP DRBG (SHAKE256)
+// =========================================================
+// out = SHAKE256(seed[32] || ctr (8 bytes LE) || domain, 64)
+// Input 41 bytes -> vừa 1 block (rate 136), 64 bytes output nằm trong
+// lần squeeze đầu tiên => đúng 1 lần gọi keccak_f1600 cho mỗi request.
+// Cùng seed + ctr + domain luôn cho ra cùng kết quả (replay được).
+void drbg_generate(
+    ap_uint<64> seed[4],
+    ap_uint<64> ctr,
+    uint8 domain,
+    uint8 out[DRBG_OUT_BYTES]
+) {
+    #pragma HLS INLINE off
+    uint64_t state[25];
+    #pragma HLS ARRAY_PARTITION variable=state type=complete
+    for(int i=0; i<25; i++) {
+        #pragma HLS UNROLL
+        state[i] = 0;
+    }
+
+    for(int i=0; i<4; i++) {
+        #pragma HLS UNROLL
+        state[i] = seed[i];
+    }
+    state[4] = ctr;
+    state[5] = (uint64_t)domain;
+
+    // SHAKE Padding (message dài 41 bytes)
+    state[5] ^= (0x1FULL << 8);
+    state[16] ^= (1ULL << 63);
+
+    keccak_f1600(state);
+
+    for(int i=0; i<DRBG_OUT_BYTES/8; i++) {
+        #pragma HLS UNROLL
+        uint64_t w = state[i];
+        for(int j=0; j<8; j++) out[i*8+j] = (uint8)(w >> (j*8));
+    }
+}
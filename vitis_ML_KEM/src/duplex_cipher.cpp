@@ -0,0 +1,187 @@
+#include "params.h"
+#include "hls_stream.h"
+#include "ap_int.h"
+
+// --- EXTERN DECLARATIONS ---
+extern void keccak_f1600(uint64_t state[25]);
+
+#define AES_FRAME_BEATS (AES_FRAME_MAX / AES_BLOCK_BYTES)
+#define DX_FRAME_BLOCKS (AES_FRAME_MAX / DX_RATE_BYTES + 1)
+
+// =========================================================
+// KECCAK DUPLEX FRAME CIPHER (AE không cần AES)
+// =========================================================
+// Authenticated encryption dạng duplex trên đúng keccak_f1600 của ML-KEM,
+// rate 168 byte (21 lane, capacity 256 bit như SHAKE128). Mô hình tham
+// chiếu: KeccakDuplex_Software trong AES_CTR/Duplex_Lib.py.
+//   init : state = key (32) || nonce (16) || pad10*1, DS_KEY, f
+//   block: C = P ^ state[0..r), state ^= P (r <= 168 byte),
+//          block cuối lẻ thêm pad 0x01 ở byte r, DS_CRYPT / DS_LAST, f
+//   tag  : state ^= LE64(n_bytes) || pad10*1, DS_TAG, f, tag = state[0..16)
+// Byte domain (DS_*) XOR vào byte cuối của state (capacity, lane 24 bit [63:56]).
+// Mỗi block = 1 lần absorb 21 lane song song + 1 permutation -> 168 byte /
+// keccak_f1600, I/O 16 byte / chu kỳ qua 21 stream lane luôn chạy trước.
+
+// Byte 0 .. n-1 của lane, n = 0: nguyên lane
+static uint64_t dx_lane_mask(int n) {
+    #pragma HLS INLINE
+    return (n == 0) ? ~0ULL : ((1ULL << (8 * n)) - 1);
+}
+
+// beat -> lane, lane g của payload vào stream g % 21
+static void dx_read(
+    beat_t* in,
+    int n_bytes,
+    hls::stream<uint64_t> lane_in[DX_RATE_LANES]
+) {
+    #pragma HLS INLINE off
+    int n_lanes = (n_bytes + 7) / 8;
+    int n_beats = (n_bytes + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES;
+    int pos = 0;
+    Dx_Read_Loop: for(int i=0; i<n_beats; i++) {
+        #pragma HLS PIPELINE II=1
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=AES_FRAME_BEATS
+        beat_t beat = in[i];
+        for(int h=0; h<2; h++) {
+            if (2*i + h < n_lanes) {
+                lane_in[pos].write((uint64_t)(beat >> (64*h)));
+                pos = (pos == DX_RATE_LANES - 1) ? 0 : pos + 1;
+            }
+        }
+    }
+}
+
+// Lõi duplex: giữ state, 1 block / vòng lặp
+static void dx_duplex(
+    uint8 key[32],
+    ap_uint<128> nonce,
+    int decrypt,
+    int n_bytes,
+    hls::stream<uint64_t> lane_in[DX_RATE_LANES],
+    hls::stream<uint64_t> lane_out[DX_RATE_LANES],
+    hls::stream<beat_t>& tag_strm
+) {
+    #pragma HLS INLINE off
+    uint64_t state[25];
+    #pragma HLS ARRAY_PARTITION variable=state type=complete
+    for(int i=0; i<25; i++) {
+        #pragma HLS UNROLL
+        state[i] = 0;
+    }
+
+    Dx_Key_Loop: for(int i=0; i<4; i++) {
+        #pragma HLS PIPELINE II=1
+        uint64_t w = 0;
+        for(int b=0; b<8; b++) w |= ((uint64_t)key[i*8 + b] << (b*8));
+        state[i] = w;
+    }
+    state[4] = (uint64_t)nonce;
+    state[5] = (uint64_t)(nonce >> 64);
+    state[6] ^= 0x01;
+    state[DX_RATE_LANES - 1] ^= (1ULL << 63);
+    state[24] ^= (uint64_t)DX_DS_KEY << 56;
+    keccak_f1600(state);
+
+    int n_blocks = (n_bytes + DX_RATE_BYTES - 1) / DX_RATE_BYTES;
+    Dx_Block_Loop: for(int b=0; b<n_blocks; b++) {
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=DX_FRAME_BLOCKS
+        bool last = (b == n_blocks - 1);
+        int r = last ? n_bytes - b * DX_RATE_BYTES : DX_RATE_BYTES; // byte trong block
+        int lanes = (r + 7) / 8;
+        for(int l=0; l<DX_RATE_LANES; l++) {
+            #pragma HLS UNROLL
+            if (l < lanes) {
+                uint64_t mask = (l == lanes - 1) ? dx_lane_mask(r % 8) : ~0ULL;
+                uint64_t x = lane_in[l].read() & mask;
+                uint64_t y = x ^ (state[l] & mask);
+                lane_out[l].write(y);
+                state[l] ^= decrypt ? y : x; // hấp thụ plaintext
+            }
+            if (r < DX_RATE_BYTES && l == r / 8) state[l] ^= 0x01ULL << (8 * (r % 8));
+        }
+        state[24] ^= (uint64_t)(last ? DX_DS_LAST : DX_DS_CRYPT) << 56;
+        keccak_f1600(state);
+    }
+
+    state[0] ^= (uint64_t)n_bytes;
+    state[1] ^= 0x01;
+    state[DX_RATE_LANES - 1] ^= (1ULL << 63);
+    state[24] ^= (uint64_t)DX_DS_TAG << 56;
+    keccak_f1600(state);
+    tag_strm.write(((beat_t)state[1] << 64) | (beat_t)state[0]);
+}
+
+// lane -> beat, rồi tag
+static void dx_write(
+    hls::stream<uint64_t> lane_out[DX_RATE_LANES],
+    hls::stream<beat_t>& tag_strm,
+    int n_bytes,
+    beat_t* out,
+    beat_t* tag_out
+) {
+    #pragma HLS INLINE off
+    int n_lanes = (n_bytes + 7) / 8;
+    int n_beats = (n_bytes + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES;
+    int pos = 0;
+    Dx_Write_Loop: for(int i=0; i<n_beats; i++) {
+        #pragma HLS PIPELINE II=1
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=AES_FRAME_BEATS
+        beat_t beat = 0;
+        for(int h=0; h<2; h++) {
+            if (2*i + h < n_lanes) {
+                beat |= (beat_t)lane_out[pos].read() << (64*h);
+                pos = (pos == DX_RATE_LANES - 1) ? 0 : pos + 1;
+            }
+        }
+        out[i] = beat;
+    }
+    tag_out[0] = tag_strm.read();
+}
+
+// Lõi DATAFLOW dùng chung: keccak_duplex_crypt và session.cpp (key từ slot)
+void keccak_duplex_core(
+    uint8 key[32],
+    ap_uint<128> nonce,
+    int decrypt,
+    int n_bytes,
+    beat_t* in,
+    beat_t* out,
+    beat_t* tag_out
+) {
+    #pragma HLS INLINE off
+    // 1 stream / lane: dx_duplex đọc 21 lane của 1 block trong 1 chu kỳ
+    hls::stream<uint64_t> lane_in[DX_RATE_LANES];
+    #pragma HLS STREAM variable=lane_in depth=4
+    hls::stream<uint64_t> lane_out[DX_RATE_LANES];
+    #pragma HLS STREAM variable=lane_out depth=4
+    hls::stream<beat_t> tag_strm;
+    #pragma HLS STREAM variable=tag_strm depth=1
+
+    #pragma HLS DATAFLOW
+    dx_read(in, n_bytes, lane_in);
+    dx_duplex(key, nonce, decrypt, n_bytes, lane_in, lane_out, tag_strm);
+    dx_write(lane_out, tag_strm, n_bytes, out, tag_out);
+}
+
+// Kernel: decrypt = 0 -> out = C, decrypt = 1 -> out = P; tag_out luôn là tag
+// tính lại (giải mã: host so với tag nhận được). Buffer cấp tròn lên bội 16 byte.
+void keccak_duplex_crypt(
+    uint8 key[32],
+    ap_uint<128> nonce,
+    int decrypt,
+    int n_bytes,
+    beat_t* in,
+    beat_t* out,
+    beat_t* tag_out
+) {
+    #pragma HLS INTERFACE m_axi port=key bundle=gmem0 depth=32 max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=in bundle=gmem0 depth=AES_FRAME_BEATS max_read_burst_length=256
+    #pragma HLS INTERFACE m_axi port=out bundle=gmem1 depth=AES_FRAME_BEATS max_write_burst_length=256
+    #pragma HLS INTERFACE m_axi port=tag_out bundle=gmem1 depth=1
+    #pragma HLS INTERFACE s_axilite port=nonce
+    #pragma HLS INTERFACE s_axilite port=decrypt
+    #pragma HLS INTERFACE s_axilite port=n_bytes
+    #pragma HLS INTERFACE s_axilite port=return
+
+    keccak_duplex_core(key, nonce, decrypt, n_bytes, in, out, tag_out);
+}
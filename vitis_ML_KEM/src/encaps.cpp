@@ -1,15 +1,14 @@
 #include "params.h"
+#include "poly_ops.h"
 #include "hls_stream.h"
 #include "ap_int.h"
-#include <cstring>
 
 // --- EXTERN DECLARATIONS ---
 extern void keccak_f1600(uint64_t state[25]);
-extern void shake256_prf(uint8 input[33], uint64_t output_64[16]);
-extern void cbd_eta2(ap_uint<64> input_buf[16], int16 coeffs[256]);
+template <int ETA> void sample_poly_cbd(uint8 seed[32], uint8 nonce, int16 coeffs[KYBER_N]);
 extern void ntt(int16 poly[256]);
-extern void inv_ntt(int16 poly[256]);
-extern void poly_pointwise(int16 a[256], int16 b[256], int16 r[256]);
+extern void inv_ntt_layers(int16 poly[256]);
+extern int16 inv_ntt_scale(int16 x);
 extern void xof_absorb_squeeze(ap_uint<64> input_B[5], hls::stream<uint8>& out_stream);
 extern void parse_ntt(hls::stream<uint8>& in_bytes, int16 a_hat[KYBER_N]);
 
@@ -17,10 +16,7 @@ extern void parse_ntt(hls::stream<uint8>& in_bytes, int16 a_hat[KYBER_N]);
 // Lưu ý: Bạn cần sửa cả trong file serializer.cpp (thêm pragma INLINE) hoặc copy nội dung hàm vào đây nếu muốn chắc chắn.
 // Tuy nhiên, với HLS, nếu ta gọi hàm nhỏ trong loop unroll, nó thường tự inline.
 // Để đảm bảo, ta khai báo lại prototype (việc inline thực sự diễn ra ở định nghĩa hàm).
-extern void poly_frombytes(uint8 input[384], int16 coeffs[KYBER_N]);
 extern void poly_frommsg(uint8 msg[32], int16 coeffs[KYBER_N]);
-extern void poly_compress_u(int16 coeffs[KYBER_N], uint8 output[320]);
-extern void poly_compress_v(int16 coeffs[KYBER_N], uint8 output[128]);
 
 // --- LOCAL STATIC FUNCTIONS ---
 // Giữ nguyên static để tránh duplicate logic SHA3
@@ -44,91 +40,207 @@ static void sha3_512_64bytes_encaps(uint8 input[64], uint8 output[64]) {
     }
 }
 
-static void sha3_256_pk_encaps(uint8 input[1184], uint8 output[32]) {
+#define PK_SIZE KYBER_PK_BYTES
+#define CT_SIZE KYBER_CT_BYTES
+#define PK_BEATS (PK_SIZE / AXI_BEAT_BYTES)            // 74 (768)
+#define T_BEATS  (KYBER_POLYVECBYTES / AXI_BEAT_BYTES) // 72 (768), phần còn lại là rho
+
+#define ENCAPS_BATCH_MAX 64
+// depth m_axi của batch: đủ ENCAPS_BATCH_MAX op (co-sim)
+#define PK_BATCH_BYTES (PK_SIZE * ENCAPS_BATCH_MAX)
+#define M_BATCH_BYTES  (32 * ENCAPS_BATCH_MAX)
+#define CT_BATCH_BYTES (CT_SIZE * ENCAPS_BATCH_MAX)
+#define SS_BATCH_BYTES (32 * ENCAPS_BATCH_MAX)
+
+extern void drbg_generate(ap_uint<64> seed[4], ap_uint<64> ctr, uint8 domain, uint8 out[DRBG_OUT_BYTES]);
+
+extern void matvec_At_t(int16 A_T[KYBER_K][KYBER_K][KYBER_N], int16 t_hat[KYBER_K][KYBER_N],
+                        int16 r_hat[KYBER_K][KYBER_N], int16 u[KYBER_K][KYBER_N], int16 v[KYBER_N]);
+extern void gen_matrix(hls::stream<ap_uint<64> >& rho_strm, int16 A[KYBER_K][KYBER_K][KYBER_N], int transposed);
+
+extern void perf_clear(perf_t pf[PERF_SLOTS]);
+extern void perf_merge(perf_t pf[PERF_SLOTS], perf_t acc[PERF_SLOTS]);
+
+// =========================================================
+// LOAD EK: rho, H(ek), t_hat
+// =========================================================
+// ek được đọc đúng 1 lần theo beat 128-bit; mỗi beat đi song song vào
+// sponge SHA3-256 và bộ decode 12-bit, nên H(ek) và t_hat xong cùng lúc
+// với burst cuối thay vì memcpy -> hash -> decode nối tiếp.
+
+// rho (ek[384k..384k+31]) được đọc và đẩy ra trước để gen_matrix
+// bắt đầu expand A^T ngay từ đầu kernel, song song với H(ek) và G.
+static void ek_read_beats(
+    uint8 pk_in[PK_SIZE],
+    hls::stream<ap_uint<64> >& rho_strm,
+    hls::stream<beat_t>& hash_strm,
+    hls::stream<beat_t>& dec_strm
+) {
     #pragma HLS INLINE off
-    uint64_t state[25] = {0};
+    Rho_First_Loop: for(int w=0; w<4; w++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        uint64_t val = 0;
+        for(int b=0; b<8; b++) val |= ((uint64_t)pk_in[KYBER_POLYVECBYTES + w*8 + b] << (b*8));
+        rho_strm.write(val);
+    }
+
+    Read_EK_Loop: for(int i=0; i<PK_BEATS; i++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        beat_t beat = 0;
+        for(int b=0; b<AXI_BEAT_BYTES; b++) beat |= (beat_t)pk_in[i*AXI_BEAT_BYTES + b] << (b*8);
+        hash_strm.write(beat);
+        if (i < T_BEATS) dec_strm.write(beat);
+    }
+}
+
+// H(ek) = SHA3-256(ek), 768: 1184 bytes = 148 lanes = 8 block đầy + 12 lanes
+// (512: 100 lanes, 1024: 196 lanes), pad tại lane pos còn lại
+static void ek_hash_beats(
+    hls::stream<beat_t>& hash_strm,
+    uint8 h_pk[32]
+) {
+    #pragma HLS INLINE off
+    uint64_t state[25];
     #pragma HLS ARRAY_PARTITION variable=state type=complete
-    
-    for(int b=0; b<8; b++) {
-        for(int w=0; w<17; w++) {
-            #pragma HLS PIPELINE II=1
-            uint64_t word = 0;
-            int base_idx = b*136 + w*8;
-            for(int j=0; j<8; j++) word |= ((uint64_t)input[base_idx+j] << (j*8));
-            state[w] ^= word;
-        }
-        keccak_f1600(state);
+    for(int i=0; i<25; i++) {
+        #pragma HLS UNROLL
+        state[i] = 0;
     }
-    int offset = 1088;
-    for(int w=0; w<12; w++) {
+
+    int pos = 0;
+    Absorb_EK_Loop: for(int i=0; i<PK_BEATS; i++) {
         #pragma HLS PIPELINE II=1
-        uint64_t word = 0;
-        for(int j=0; j<8; j++) word |= ((uint64_t)input[offset + w*8 + j] << (j*8));
-        state[w] ^= word;
+        PERF_TICK(1);
+        beat_t beat = hash_strm.read();
+        for(int h=0; h<2; h++) {
+            state[pos] ^= (uint64_t)beat.range(64*h + 63, 64*h);
+            pos++;
+            if (pos == 17) {
+                keccak_f1600(state);
+                PERF_TICK(PERF_ITERS_KECCAK);
+                pos = 0;
+            }
+        }
     }
-    state[12] ^= 0x06;
+
+    state[pos] ^= 0x06;
     state[16] ^= (1ULL << 63); 
     keccak_f1600(state);
+    PERF_TICK(PERF_ITERS_KECCAK);
     for(int i=0; i<4; i++) {
         #pragma HLS UNROLL
         uint64_t w = state[i];
-        for(int j=0; j<8; j++) output[i*8+j] = (uint8)(w >> (j*8));
+        for(int j=0; j<8; j++) h_pk[i*8+j] = (uint8)(w >> (j*8));
     }
 }
 
-#define PK_SIZE 1184
-#define CT_SIZE 1088 
+// t_hat: ByteDecode_12, mỗi 3 byte -> 2 hệ số (giống poly_frombytes)
+// Modulus check (FIPS 203): OR cờ "hệ số >= q" ngay trên đường decode,
+// status có cùng lúc với t_hat, không thêm cycle nào.
+static void ek_decode_beats(
+    hls::stream<beat_t>& dec_strm,
+    int16 t_hat[KYBER_K][KYBER_N],
+    int& status
+) {
+    #pragma HLS INLINE off
+    ap_uint<24> acc = 0;
+    int nb = 0;
+    int cidx = 0;
+    ap_uint<1> bad = 0;
+    Decode_EK_Loop: for(int i=0; i<T_BEATS; i++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        beat_t beat = dec_strm.read();
+        for(int b=0; b<AXI_BEAT_BYTES; b++) {
+            acc |= (ap_uint<24>)beat.range(8*b + 7, 8*b) << (8*nb);
+            nb++;
+            if (nb == 3) {
+                ap_uint<12> c0 = acc.range(11, 0);
+                ap_uint<12> c1 = acc.range(23, 12);
+                t_hat[cidx >> 8][cidx & 255]       = (int16)c0;
+                t_hat[cidx >> 8][(cidx & 255) + 1] = (int16)c1;
+                bad |= (c0 >= KYBER_Q) | (c1 >= KYBER_Q);
+                cidx += 2;
+                acc = 0;
+                nb = 0;
+            }
+        }
+    }
+    status = bad ? KEY_STATUS_BAD_EK : KEY_STATUS_OK;
+}
 
-void ml_kem_encaps(
+static void encaps_load_ek(
     uint8 pk_in[PK_SIZE],
-    uint8 randomness_m[32], 
-    uint8 ct_out[CT_SIZE],  
-    uint8 ss_out[32]   
+    hls::stream<ap_uint<64> >& rho_strm,
+    uint8 h_pk[32],
+    int16 t_hat[KYBER_K][KYBER_N],
+    int& status
 ) {
-    #pragma HLS INTERFACE m_axi port=pk_in bundle=gmem0 depth=1184 max_widen_bitwidth=128
-    #pragma HLS INTERFACE m_axi port=randomness_m bundle=gmem0 depth=32 max_widen_bitwidth=128
-    #pragma HLS INTERFACE m_axi port=ct_out bundle=gmem1 depth=1088 max_widen_bitwidth=128
-    #pragma HLS INTERFACE m_axi port=ss_out bundle=gmem1 depth=32 max_widen_bitwidth=128
-    #pragma HLS INTERFACE s_axilite port=return
-
-    // Resource Allocation: Limit=3 is Sweet Spot
-    #pragma HLS ALLOCATION function instances=keccak_f1600 limit=3
-    #pragma HLS ALLOCATION function instances=ntt limit=3
-    #pragma HLS ALLOCATION function instances=inv_ntt limit=3
-    #pragma HLS ALLOCATION function instances=poly_pointwise limit=3
-
-    // --- MEMORY OPTIMIZATION ---
-    // Loại bỏ A_hat toàn cục để tiết kiệm BRAM
-    // int16 A_hat... -> REMOVED
-
-    int16 t_hat[KYBER_K][KYBER_N];
-    #pragma HLS ARRAY_PARTITION variable=t_hat dim=1 type=complete
-    #pragma HLS ARRAY_PARTITION variable=t_hat dim=2 cyclic factor=2
+    #pragma HLS INLINE off
+    hls::stream<beat_t> hash_strm, dec_strm;
+    #pragma HLS STREAM variable=hash_strm depth=PK_BEATS
+    #pragma HLS STREAM variable=dec_strm depth=4
 
-    int16 r_hat[KYBER_K][KYBER_N]; 
-    #pragma HLS ARRAY_PARTITION variable=r_hat dim=1 type=complete
-    #pragma HLS ARRAY_PARTITION variable=r_hat dim=2 cyclic factor=2
+    #pragma HLS DATAFLOW
+    ek_read_beats(pk_in, rho_strm, hash_strm, dec_strm);
+    ek_hash_beats(hash_strm, h_pk);
+    ek_decode_beats(dec_strm, t_hat, status);
+}
 
-    int16 u_poly[KYBER_K][KYBER_N];
-    #pragma HLS ARRAY_PARTITION variable=u_poly dim=1 type=complete
-    #pragma HLS ARRAY_PARTITION variable=u_poly dim=2 cyclic factor=2
+// Bọc process DATAFLOW để chốt perf, H(ek) chạy chồng lên LOAD nên tính chung
+static void encaps_ingest(
+    uint8 pk_in[PK_SIZE],
+    hls::stream<ap_uint<64> >& rho_strm,
+    uint8 h_pk[32],
+    int16 t_hat[KYBER_K][KYBER_N],
+    int& status,
+    perf_t pf[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
+    perf_clear(pf);
+    perf_t t = PERF_NOW(0);
+    encaps_load_ek(pk_in, rho_strm, h_pk, t_hat, status);
+    PERF_MARK(pf, PERF_LOAD, t);
+}
 
-    int16 v_poly[KYBER_N];
-    #pragma HLS ARRAY_PARTITION variable=v_poly cyclic factor=2
+static void encaps_xof(
+    hls::stream<ap_uint<64> >& rho_strm,
+    int16 A_T[KYBER_K][KYBER_K][KYBER_N],
+    perf_t pf[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
+    perf_clear(pf);
+    perf_t t = PERF_NOW(0);
+    gen_matrix(rho_strm, A_T, 1);
+    PERF_TICK(PERF_ITERS_GEN_MATRIX);
+    PERF_MARK(pf, PERF_XOF, t);
+}
 
-    uint8 pk_local[PK_SIZE];
-    #pragma HLS ARRAY_PARTITION variable=pk_local block factor=3 
-    uint8 ct_local[CT_SIZE];
-    #pragma HLS ARRAY_PARTITION variable=ct_local block factor=3 
+// =========================================================
+// NOISE: G(m || H(ek)), r_hat, e1, e2, m_poly
+// =========================================================
+// Không phụ thuộc A^T -> chạy song song với gen_matrix
+static void encaps_noise(
+    uint8 randomness_m[32],
+    uint8 h_pk[32],
+    uint8 ss_out[32],
+    int16 r_hat[KYBER_K][KYBER_N],
+    int16 e1[KYBER_K][KYBER_N],
+    int16 e2[KYBER_N],
+    int16 m_poly[KYBER_N],
+    perf_t pf[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
 
-    // --- EXECUTION ---
-    memcpy(pk_local, pk_in, PK_SIZE);
+    DO_PRAGMA(HLS ALLOCATION function instances=keccak_f1600 limit=HW_KEM_KECCAK)
+    DO_PRAGMA(HLS ALLOCATION function instances=ntt limit=HW_KEM_NTT)
 
-    // 1. Hashing
-    uint8 h_pk[32];
-    #pragma HLS ARRAY_PARTITION variable=h_pk complete
-    sha3_256_pk_encaps(pk_local, h_pk);
+    perf_clear(pf);
+    perf_t t = PERF_NOW(0);
 
+    // 1. Hashing G(m || H(ek))
     uint8 g_in[64];
     #pragma HLS ARRAY_PARTITION variable=g_in complete
     for(int i=0; i<32; i++) {
@@ -140,183 +252,567 @@ void ml_kem_encaps(
     uint8 Kr[64]; 
     #pragma HLS ARRAY_PARTITION variable=Kr complete
     sha3_512_64bytes_encaps(g_in, Kr);
+    PERF_TICK(PERF_ITERS_KECCAK);
     
     for(int i=0; i<32; i++) {
         #pragma HLS UNROLL
         ss_out[i] = Kr[i];
     }
+    PERF_MARK(pf, PERF_HASH, t);
 
-    // Unpack PK
-    uint8 rho[32];
-    #pragma HLS ARRAY_PARTITION variable=rho complete
-    for(int i=0; i<KYBER_K; i++) {
-        #pragma HLS UNROLL
-        poly_frombytes(&pk_local[i*384], t_hat[i]);
-    }
+    // 2. GEN NOISE (r, e1, e2)
+    
+    uint8 seed_r[32];
+    #pragma HLS ARRAY_PARTITION variable=seed_r complete
     for(int i=0; i<32; i++) {
         #pragma HLS UNROLL
-        rho[i] = pk_local[1152 + i];
+        seed_r[i] = Kr[32+i];
     }
 
-    // 2. GEN NOISE (r, e1, e2) FIRST
-    // Sinh r trước để dùng cho phép nhân ma trận on-the-fly
-    
-    // Gen r (Parallel 3)
+    // Gen r (Parallel K, eta1, nonce 0..K-1)
     Gen_R_Loop: for(int i=0; i<KYBER_K; i++) {
         #pragma HLS UNROLL 
-        uint8 prf_in[33];
-        #pragma HLS ARRAY_PARTITION variable=prf_in complete
-        for(int k=0; k<32; k++) prf_in[k] = Kr[32+k];
-        prf_in[32] = (uint8)i; // nonce 0,1,2
-        
-        uint64_t cbd_input[16];
-        shake256_prf(prf_in, cbd_input);
-        
-        ap_uint<64> cbd_ap[16]; // Fix casting safely
-        #pragma HLS ARRAY_PARTITION variable=cbd_ap complete
-        for(int k=0; k<16; k++) cbd_ap[k] = cbd_input[k];
-
-        int16 poly_temp[256];
-        #pragma HLS ARRAY_PARTITION variable=poly_temp cyclic factor=2
-        cbd_eta2(cbd_ap, poly_temp);
-        ntt(poly_temp);
-        
-        for(int k=0; k<256; k++) {
-            #pragma HLS PIPELINE II=1
-            r_hat[i][k] = poly_temp[k];
-        }
+        sample_poly_cbd<KYBER_ETA1>(seed_r, (uint8)i, r_hat[i]);
+        ntt(r_hat[i]);
+        PERF_TICK(PERF_ITERS_CBD(KYBER_ETA1) + PERF_ITERS_NTT);
     }
 
-    // Gen e1 (Parallel 3) -> Store in u_poly
+    // Gen e1 (Parallel K, eta2, nonce K..2K-1)
     Gen_E1_Loop: for(int i=0; i<KYBER_K; i++) {
         #pragma HLS UNROLL 
-        uint8 prf_in[33];
-        #pragma HLS ARRAY_PARTITION variable=prf_in complete
-        for(int k=0; k<32; k++) prf_in[k] = Kr[32+k];
-        prf_in[32] = (uint8)(i + 3); // nonce 3,4,5
-        
-        uint64_t cbd_input[16];
-        shake256_prf(prf_in, cbd_input);
-        
-        ap_uint<64> cbd_ap[16];
-        #pragma HLS ARRAY_PARTITION variable=cbd_ap complete
-        for(int k=0; k<16; k++) cbd_ap[k] = cbd_input[k];
-
-        cbd_eta2(cbd_ap, u_poly[i]); 
+        sample_poly_cbd<KYBER_ETA2>(seed_r, (uint8)(KYBER_K + i), e1[i]);
+        PERF_TICK(PERF_ITERS_CBD(KYBER_ETA2));
     }
 
-    // Gen e2
-    int16 e2[256];
-    #pragma HLS ARRAY_PARTITION variable=e2 cyclic factor=2
-    {
-        uint8 prf_in[33];
-        for(int k=0; k<32; k++) prf_in[k] = Kr[32+k];
-        prf_in[32] = 6;
-        uint64_t cbd_input[16];
-        shake256_prf(prf_in, cbd_input);
-        ap_uint<64> cbd_ap[16];
-        #pragma HLS ARRAY_PARTITION variable=cbd_ap complete
-        for(int k=0; k<16; k++) cbd_ap[k] = cbd_input[k];
-        cbd_eta2(cbd_ap, e2);
-    }
+    // Gen e2 (nonce 2K)
+    sample_poly_cbd<KYBER_ETA2>(seed_r, (uint8)(2 * KYBER_K), e2);
 
-    // 3. STREAMING MATRIX MULTIPLY (The Optimization)
-    // Tính u = A^T * r + e1
-    // Loop i (0..2): Tính từng đa thức u[i] song song
-    // Loop j (0..2): Duyệt qua các phần tử của A^T (tức là A[j][i])
-    
-    Calc_U_Loop: for(int i=0; i<KYBER_K; i++) {
-        #pragma HLS UNROLL
-        
-        int16 acc[256] = {0};
-        #pragma HLS ARRAY_PARTITION variable=acc cyclic factor=2
-        
-        // Inner loop: Generate A on-the-fly -> Mult -> Acc
-        for(int j=0; j<KYBER_K; j++) {
-            // Không UNROLL loop này để tiết kiệm Keccak instance (chỉ cần 3 instance cho 3 hàng i)
-            
-            // Generate A[j][i] (Transpose)
-            ap_uint<64> xof_in[5];
-            #pragma HLS ARRAY_PARTITION variable=xof_in complete
-            for(int w=0; w<4; w++) {
+    poly_frommsg(randomness_m, m_poly);
+    PERF_TICK(PERF_ITERS_CBD(KYBER_ETA2) + PERF_ITERS_MSG);
+    PERF_MARK(pf, PERF_NOISE, t);
+}
+
+// =========================================================
+// OUTPUT STAGE: invNTT -> + noise -> Compress -> ct_out
+// =========================================================
+// Output stage gộp cho 1 đa thức của ct (u[i] với D = du, v với D = dv):
+//   lớp cuối inv_ntt (x F^-1) -> + e (+ m) -> Compress_D -> packer 128-bit
+// 256 hệ số x D bit = đúng 2D beat, nên mỗi đa thức ghi thẳng 2D beat vào
+// ct_out ngay khi xong, không cần u_poly / v_poly / ct_local trung gian.
+template <int D>
+static void encaps_emit_poly(
+    int16 acc[KYBER_N],
+    int16 e[KYBER_N],
+    int16 m[KYBER_N],
+    bool add_m,
+    uint8 ct_out[CT_SIZE],
+    int byte_base
+) {
+    #pragma HLS INLINE off
+
+    beat_t buf = 0;   // bit đang chờ, [0, nbits)
+    int nbits = 0;
+    int out = byte_base;
+
+    Emit_Loop: for(int k=0; k<KYBER_N; k++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+
+        poly_wide_t x = (poly_wide_t)inv_ntt_scale(acc[k]) + e[k];
+        if(add_m) x += m[k];
+        int16 val = poly_reduce_wide(x);
+
+        // Compress_D: round(2^D * x / q) mod 2^D
+        ap_uint<32> tc = (ap_uint<32>)val * (1 << D) + 1664;
+        ap_uint<D> c = (ap_uint<D>)((tc / KYBER_Q) & ((1 << D) - 1));
+
+        // Packer: nbits + D có thể vượt 128 -> phần dư sang beat sau
+        bool full = (nbits + D >= 128);
+        int lo_bits = full ? 128 - nbits : D;
+        buf |= (beat_t)c << nbits;
+        if(full) {
+            for(int b=0; b<AXI_BEAT_BYTES; b++) {
                 #pragma HLS UNROLL
-                uint64_t val = 0;
-                for(int b=0; b<8; b++) val |= ((uint64_t)rho[w*8+b] << (b*8));
-                xof_in[w] = val;
-            }
-            xof_in[4] = (uint64_t)i | ((uint64_t)j << 8);
-
-            hls::stream<uint8> strm;
-            #pragma HLS STREAM variable=strm depth=256
-            
-            // Buffer cục bộ cực nhỏ cho 1 đa thức A
-            int16 A_poly_temp[256];
-            #pragma HLS ARRAY_PARTITION variable=A_poly_temp cyclic factor=2
-            
-            xof_absorb_squeeze(xof_in, strm);
-            parse_ntt(strm, A_poly_temp);
-            
-            int16 prod[256];
-            poly_pointwise(A_poly_temp, r_hat[j], prod);
-            
-            for(int k=0; k<256; k++) {
-                #pragma HLS PIPELINE II=2
-                ap_int<16> sum = (ap_int<16>)acc[k] + prod[k];
-                while(sum >= KYBER_Q) sum -= KYBER_Q;
-                acc[k] = (int16)sum;
+                ct_out[out + b] = (uint8)buf.range(8*b + 7, 8*b);
             }
+            out += AXI_BEAT_BYTES;
+            buf = (lo_bits < D) ? (beat_t)(c >> lo_bits) : (beat_t)0;
+            nbits = nbits + D - 128;
+        } else {
+            nbits += D;
         }
-        
-        inv_ntt(acc);
-        
-        // Cộng e1 (đang ở u_poly)
-        for(int k=0; k<256; k++) {
-            #pragma HLS PIPELINE II=1
-            ap_int<16> val = (ap_int<16>)acc[k] + u_poly[i][k];
-            while(val >= KYBER_Q) val -= KYBER_Q;
-            if(val < 0) val += KYBER_Q;
-            u_poly[i][k] = (int16)val;
-        }
+    }
+}
+
+// =========================================================
+// FINISH: u = invNTT(A^T * r) + e1, v = invNTT(t^T * r) + e2 + m, packing
+// =========================================================
+// A_T[i][j] = A[j][i] đã được expand sẵn (gen_matrix transposed)
+// perf: inv_ntt + cộng noise + compress + ghi ct nằm chung PERF_COMPRESS
+static void encaps_finish(
+    int16 A_T[KYBER_K][KYBER_K][KYBER_N],
+    int16 t_hat[KYBER_K][KYBER_N],
+    int16 r_hat[KYBER_K][KYBER_N],
+    int16 e1[KYBER_K][KYBER_N],
+    int16 e2[KYBER_N],
+    int16 m_poly[KYBER_N],
+    uint8 ct_out[CT_SIZE],
+    perf_t pf[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
+
+    DO_PRAGMA(HLS ALLOCATION function instances=inv_ntt_layers limit=HW_KEM_NTT)
+
+    perf_clear(pf);
+    perf_t t = PERF_NOW(0);
+
+    int16 u_acc[KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=u_acc dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=u_acc dim=2 cyclic factor=HW_POLY_PART)
+
+    int16 v_acc[KYBER_N];
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=v_acc cyclic factor=HW_POLY_PART)
+
+    // 3. MATRIX MULTIPLY (miền NTT): u = A^T o r, v = t^T o r
+    // A^T và t^T là K+1 hàng của cùng 1 lượt qua matvec engine
+    matvec_At_t(A_T, t_hat, r_hat, u_acc, v_acc);
+    PERF_TICK(PERF_ITERS_MATVEC_AT_T);
+    PERF_MARK(pf, PERF_MATRIX, t);
+
+    // 4. Mỗi hàng: inv_ntt (trừ lớp F^-1) rồi emit ngay, hàng i ghi ra ct
+    // trong khi inv_ntt của hàng sau còn chạy
+    Out_U_Loop: for(int i=0; i<KYBER_K; i++) {
+        #pragma HLS UNROLL
+        inv_ntt_layers(u_acc[i]);
+        PERF_TICK(PERF_ITERS_NTT);
+        encaps_emit_poly<KYBER_DU>(u_acc[i], e1[i], m_poly, false, ct_out, i*KYBER_POLYCOMP_U);
+    }
+    inv_ntt_layers(v_acc);
+    PERF_TICK(PERF_ITERS_NTT);
+    encaps_emit_poly<KYBER_DV>(v_acc, e2, m_poly, true, ct_out, KYBER_K*KYBER_POLYCOMP_U);
+    PERF_MARK(pf, PERF_COMPRESS, t);
+}
+
+// Encrypt trên ek đã decode / A^T đã expand (resident mode)
+static void encaps_compute(
+    uint8 randomness_m[32],
+    uint8 h_pk[32],
+    int16 t_hat[KYBER_K][KYBER_N],
+    int16 A_T[KYBER_K][KYBER_K][KYBER_N],
+    uint8 ct_out[CT_SIZE],
+    uint8 ss_out[32]
+) {
+    #pragma HLS INLINE off
+
+    int16 r_hat[KYBER_K][KYBER_N]; 
+    #pragma HLS ARRAY_PARTITION variable=r_hat dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=r_hat dim=2 cyclic factor=HW_POLY_PART)
+
+    int16 e1[KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=e1 dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=e1 dim=2 cyclic factor=HW_POLY_PART)
+
+    int16 e2[KYBER_N];
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=e2 cyclic factor=HW_POLY_PART)
+    int16 m_poly[KYBER_N];
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=m_poly cyclic factor=HW_POLY_PART)
+
+    // Resident mode không xuất perf
+    perf_t pf_off[PERF_SLOTS];
+    encaps_noise(randomness_m, h_pk, ss_out, r_hat, e1, e2, m_poly, pf_off);
+    encaps_finish(A_T, t_hat, r_hat, e1, e2, m_poly, ct_out, pf_off);
+}
+
+// Gom perf của các process DATAFLOW (process cuối, 1 writer cho perf[])
+static void encaps_perf_collect(
+    perf_t pf_load[PERF_SLOTS],
+    perf_t pf_xof[PERF_SLOTS],
+    perf_t pf_noise[PERF_SLOTS],
+    perf_t pf_fin[PERF_SLOTS],
+    perf_t perf[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
+    perf_t acc[PERF_SLOTS];
+    #pragma HLS ARRAY_PARTITION variable=acc complete
+    perf_clear(acc);
+    perf_merge(pf_load, acc);
+    perf_merge(pf_xof, acc);
+    perf_merge(pf_noise, acc);
+    perf_merge(pf_fin, acc);
+    for(int i=0; i<PERF_SLOTS; i++) {
+        #pragma HLS UNROLL
+        perf[i] = acc[i];
+    }
+}
+
+// Thân Encaps dùng chung cho ml_kem_encaps và ml_kem_encaps_batch
+// DATAFLOW: A^T chỉ phụ thuộc rho nên được expand song song với
+// H(ek), G và sinh noise thay vì chờ chúng xong mới chạy XOF.
+// status: KEY_STATUS_BAD_EK nếu ek không qua modulus check; ct / ss vẫn được
+// tính (latency như nhau) và host phải bỏ đi.
+void encaps_core(
+    uint8 pk_in[PK_SIZE],
+    uint8 randomness_m[32], 
+    uint8 ct_out[CT_SIZE],  
+    uint8 ss_out[32],
+    int& status,
+    perf_t perf[PERF_SLOTS]
+) {
+    #pragma HLS INLINE off
+
+    int16 t_hat[KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=t_hat dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=t_hat dim=2 cyclic factor=HW_POLY_PART)
+
+    int16 A_T[KYBER_K][KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=A_T dim=1 type=complete
+    #pragma HLS ARRAY_PARTITION variable=A_T dim=2 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=A_T dim=3 cyclic factor=HW_POLY_PART)
+
+    uint8 h_pk[32];
+    #pragma HLS ARRAY_PARTITION variable=h_pk complete
+
+    int16 r_hat[KYBER_K][KYBER_N]; 
+    #pragma HLS ARRAY_PARTITION variable=r_hat dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=r_hat dim=2 cyclic factor=HW_POLY_PART)
+
+    int16 e1[KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=e1 dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=e1 dim=2 cyclic factor=HW_POLY_PART)
+
+    int16 e2[KYBER_N];
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=e2 cyclic factor=HW_POLY_PART)
+    int16 m_poly[KYBER_N];
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=m_poly cyclic factor=HW_POLY_PART)
+
+    hls::stream<ap_uint<64> > rho_strm;
+    #pragma HLS STREAM variable=rho_strm depth=4
+
+    perf_t pf_load[PERF_SLOTS], pf_xof[PERF_SLOTS], pf_noise[PERF_SLOTS], pf_fin[PERF_SLOTS];
+    #pragma HLS ARRAY_PARTITION variable=pf_load complete
+    #pragma HLS ARRAY_PARTITION variable=pf_xof complete
+    #pragma HLS ARRAY_PARTITION variable=pf_noise complete
+    #pragma HLS ARRAY_PARTITION variable=pf_fin complete
+
+    #pragma HLS DATAFLOW
+    encaps_ingest(pk_in, rho_strm, h_pk, t_hat, status, pf_load);
+    encaps_xof(rho_strm, A_T, pf_xof);
+    encaps_noise(randomness_m, h_pk, ss_out, r_hat, e1, e2, m_poly, pf_noise);
+    encaps_finish(A_T, t_hat, r_hat, e1, e2, m_poly, ct_out, pf_fin);
+    encaps_perf_collect(pf_load, pf_xof, pf_noise, pf_fin, perf);
+}
+
+// perf: cycle theo phase PERF_* (AXI-lite, host chỉ đọc), đếm bằng perf_clock_now
+// ap_return = KEY_STATUS_OK / KEY_STATUS_BAD_EK
+int ml_kem_encaps(
+    uint8 pk_in[PK_SIZE],
+    uint8 randomness_m[32], 
+    uint8 ct_out[CT_SIZE],  
+    uint8 ss_out[32],
+    perf_t perf[PERF_SLOTS]
+) {
+    #pragma HLS INTERFACE m_axi port=pk_in bundle=gmem0 depth=PK_SIZE max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=randomness_m bundle=gmem0 depth=32 max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=ct_out bundle=gmem1 depth=CT_SIZE max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=ss_out bundle=gmem1 depth=32 max_widen_bitwidth=128
+    #pragma HLS INTERFACE s_axilite port=perf
+    #pragma HLS INTERFACE s_axilite port=return
+
+    perf_t t_start = PERF_NOW(0);
+
+    uint8 m[32];
+    #pragma HLS ARRAY_PARTITION variable=m complete
+    for(int i=0; i<32; i++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        m[i] = randomness_m[i];
+    }
+    int status;
+    encaps_core(pk_in, m, ct_out, ss_out, status, perf);
+    perf[PERF_TOTAL] = PERF_NOW(t_start) - t_start;
+    return status;
+}
+
+// =========================================================
+// BATCH ENCAPS: m sinh bởi DRBG on-chip
+// =========================================================
+// Request thứ op dùng ctr = drbg_ctr + op, m = 32 bytes đầu của output DRBG.
+// mode = DRBG_MODE_REPLAY: m đọc từ m_in (32 bytes / op) -> chạy lại KAT;
+// mọi giá trị mode khác (kể cả 0 mặc định) là DRBG_MODE_LIVE.
+// ap_return = OR status của mọi op.
+int ml_kem_encaps_batch(
+    ap_uint<64> drbg_seed[4],
+    ap_uint<64> drbg_ctr,
+    int mode,
+    int n_ops,
+    uint8 pk_in[PK_SIZE * ENCAPS_BATCH_MAX],
+    uint8 m_in[32 * ENCAPS_BATCH_MAX],
+    uint8 ct_out[CT_SIZE * ENCAPS_BATCH_MAX],
+    uint8 ss_out[32 * ENCAPS_BATCH_MAX]
+) {
+    #pragma HLS INTERFACE s_axilite port=drbg_seed
+    #pragma HLS INTERFACE s_axilite port=drbg_ctr
+    #pragma HLS INTERFACE s_axilite port=mode
+    #pragma HLS INTERFACE s_axilite port=n_ops
+    #pragma HLS INTERFACE m_axi port=pk_in bundle=gmem0 depth=PK_BATCH_BYTES max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=m_in bundle=gmem0 depth=M_BATCH_BYTES max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=ct_out bundle=gmem1 depth=CT_BATCH_BYTES max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=ss_out bundle=gmem1 depth=SS_BATCH_BYTES max_widen_bitwidth=128
+    #pragma HLS INTERFACE s_axilite port=return
+
+    // Batch không xuất perf
+    perf_t perf_off[PERF_SLOTS];
+
+    ap_uint<64> seed_local[4];
+    #pragma HLS ARRAY_PARTITION variable=seed_local complete
+    for(int i=0; i<4; i++) {
+        #pragma HLS UNROLL
+        seed_local[i] = drbg_seed[i];
     }
 
-    // 4. Calc v
-    {
-        int16 v_acc[256] = {0};
-        #pragma HLS ARRAY_PARTITION variable=v_acc cyclic factor=2
-        for(int i=0; i<KYBER_K; i++) {
-            #pragma HLS UNROLL 
-            int16 prod[256];
-            #pragma HLS ARRAY_PARTITION variable=prod cyclic factor=2
-            poly_pointwise(t_hat[i], r_hat[i], prod);
-            for(int k=0; k<256; k++) {
-                #pragma HLS PIPELINE II=2
-                ap_int<16> sum = (ap_int<16>)v_acc[k] + prod[k];
-                while(sum >= KYBER_Q) sum -= KYBER_Q;
-                v_acc[k] = (int16)sum;
+    int status_all = KEY_STATUS_OK;
+    Batch_Loop: for(int op=0; op<n_ops; op++) {
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=ENCAPS_BATCH_MAX
+        uint8 rnd[DRBG_OUT_BYTES];
+        #pragma HLS ARRAY_PARTITION variable=rnd complete
+
+        if (mode == DRBG_MODE_REPLAY) {
+            for(int i=0; i<32; i++) {
+                #pragma HLS PIPELINE II=1
+                PERF_TICK(1);
+                rnd[i] = m_in[op*32 + i];
             }
+        } else {
+            drbg_generate(seed_local, drbg_ctr + op, DRBG_DOMAIN_ENCAPS, rnd);
         }
-        inv_ntt(v_acc);
-
-        int16 m_poly[256];
-        #pragma HLS ARRAY_PARTITION variable=m_poly cyclic factor=2
-        poly_frommsg(randomness_m, m_poly);
-        
-        for(int k=0; k<256; k++) {
-            #pragma HLS PIPELINE II=1
-            ap_int<16> val = (ap_int<16>)v_acc[k] + e2[k] + m_poly[k];
-            while(val >= KYBER_Q) val -= KYBER_Q;
-            if(val < 0) val += KYBER_Q;
-            v_poly[k] = (int16)val;
-        }
+
+        int status;
+        encaps_core(&pk_in[op * PK_SIZE], rnd, &ct_out[op * CT_SIZE], &ss_out[op * 32], status, perf_off);
+        status_all |= status;
+    }
+    return status_all;
+}
+
+// =========================================================
+// EK-RESIDENT ENCAPS
+// =========================================================
+// KEY_OP_LOAD: nạp ek, tính H(ek), decode t_hat, expand A^T vào BRAM.
+//              ek không qua modulus check -> KEY_STATUS_BAD_EK, key không được nạp.
+// KEY_OP_RUN : chỉ còn G, noise, basemul và packing (pk_in không được đọc).
+// KEY_OP_CLEAR: bỏ ek đã nạp (ek công khai, không cần ghi đè BRAM).
+// ap_return = KEY_STATUS_*.
+int ml_kem_encaps_resident(
+    int op,
+    uint8 pk_in[PK_SIZE],
+    uint8 randomness_m[32],
+    uint8 ct_out[CT_SIZE],
+    uint8 ss_out[32]
+) {
+    #pragma HLS INTERFACE s_axilite port=op
+    #pragma HLS INTERFACE m_axi port=pk_in bundle=gmem0 depth=PK_SIZE max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=randomness_m bundle=gmem0 depth=32 max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=ct_out bundle=gmem1 depth=CT_SIZE max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=ss_out bundle=gmem1 depth=32 max_widen_bitwidth=128
+    #pragma HLS INTERFACE s_axilite port=return
+
+    // Trạng thái giữ lại giữa các lần gọi kernel
+    static int16 ek_t_hat[KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=ek_t_hat dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=ek_t_hat dim=2 cyclic factor=HW_POLY_PART)
+
+    static int16 ek_A_T[KYBER_K][KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=ek_A_T dim=1 type=complete
+    #pragma HLS ARRAY_PARTITION variable=ek_A_T dim=2 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=ek_A_T dim=3 cyclic factor=HW_POLY_PART)
+
+    static uint8 ek_h[32];
+    #pragma HLS ARRAY_PARTITION variable=ek_h complete
+    static bool ek_valid = false;
+
+    if (op == KEY_OP_CLEAR) {
+        ek_valid = false;
+        return KEY_STATUS_OK;
+    }
+
+    if (op == KEY_OP_LOAD) {
+        hls::stream<ap_uint<64> > rho_strm;
+        #pragma HLS STREAM variable=rho_strm depth=4
+        int status;
+        encaps_load_ek(pk_in, rho_strm, ek_h, ek_t_hat, status);
+        gen_matrix(rho_strm, ek_A_T, 1);
+        ek_valid = (status == KEY_STATUS_OK);
+        return status;
     }
 
-    // 5. Pack Output
-    // Unroll packing để tận dụng các hàm đã được inline
-    for(int i=0; i<KYBER_K; i++) {
+    if (!ek_valid) return KEY_STATUS_NO_KEY;
+
+    uint8 m[32];
+    #pragma HLS ARRAY_PARTITION variable=m complete
+    for(int i=0; i<32; i++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        m[i] = randomness_m[i];
+    }
+    encaps_compute(m, ek_h, ek_t_hat, ek_A_T, ct_out, ss_out);
+    return KEY_STATUS_OK;
+}
+
+// =========================================================
+// SPLIT ENCAPS: KERNEL ARITH (cặp với ml_kem_encaps_xof)
+// =========================================================
+// Nhận A^T, r, e1, e2 đã sample qua AXIS từ HW_XOF_ENGINES kernel XOF
+// (xof_engine.cpp), op k đọc link k % HW_XOF_ENGINES. Kernel này không
+// chứa Keccak: chỉ decode t (+ modulus check), NTT(r), matvec, inv_ntt,
+// compress và packing ct. ss do kernel XOF ghi (ss = K của G).
+// ap_return = OR status của mọi op.
+
+// ek -> t beats cho ek_decode_beats (rho / H(ek) thuộc kernel XOF)
+static void arith_read_t(
+    uint8 pk_in[PK_SIZE],
+    hls::stream<beat_t>& dec_strm
+) {
+    #pragma HLS INLINE off
+    Read_T_Loop: for(int i=0; i<T_BEATS; i++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        beat_t beat = 0;
+        for(int b=0; b<AXI_BEAT_BYTES; b++) beat |= (beat_t)pk_in[i*AXI_BEAT_BYTES + b] << (b*8);
+        dec_strm.write(beat);
+    }
+}
+
+static xof_link_t arith_link_read(hls::stream<xof_link_t> poly_in[HW_XOF_ENGINES], int eng) {
+    #pragma HLS INLINE
+    xof_link_t w = 0;
+    for(int e=0; e<HW_XOF_ENGINES; e++) {
         #pragma HLS UNROLL
-        poly_compress_u(u_poly[i], &ct_local[i*320]);
+        if (e == eng) w = poly_in[e].read();
+    }
+    return w;
+}
+
+static void arith_link_poly(hls::stream<xof_link_t> poly_in[HW_XOF_ENGINES], int eng, int16 p[KYBER_N]) {
+    #pragma HLS INLINE
+    Unpack_Poly_Loop: for(int q=0; q<XOF_LINK_POLY_WORDS; q++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        xof_link_t w = arith_link_read(poly_in, eng);
+        for(int l=0; l<4; l++) p[4*q + l] = (int16)(ap_int<16>)w.range(16*l + 15, 16*l);
+    }
+}
+
+// Link -> A_T, r_hat (NTT ngay khi nhận xong), e1, e2; thứ tự như xe_link_out
+static void arith_unpack(
+    hls::stream<xof_link_t> poly_in[HW_XOF_ENGINES],
+    int eng,
+    int16 A_T[KYBER_K][KYBER_K][KYBER_N],
+    int16 r_hat[KYBER_K][KYBER_N],
+    int16 e1[KYBER_K][KYBER_N],
+    int16 e2[KYBER_N]
+) {
+    #pragma HLS INLINE off
+    DO_PRAGMA(HLS ALLOCATION function instances=ntt limit=HW_KEM_NTT)
+
+    Unpack_Matrix_Loop: for(int j=0; j<KYBER_K; j++) {
+        for(int q=0; q<XOF_LINK_POLY_WORDS; q++) {
+            for(int c=0; c<KYBER_K; c++) {
+                #pragma HLS PIPELINE II=1
+                PERF_TICK(1);
+                xof_link_t w = arith_link_read(poly_in, eng);
+                for(int l=0; l<4; l++) A_T[c][j][4*q + l] = (int16)w.range(16*l + 15, 16*l);
+            }
+        }
+    }
+    Unpack_R_Loop: for(int i=0; i<KYBER_K; i++) {
+        arith_link_poly(poly_in, eng, r_hat[i]);
+        ntt(r_hat[i]);
+    }
+    Unpack_E1_Loop: for(int i=0; i<KYBER_K; i++) {
+        arith_link_poly(poly_in, eng, e1[i]);
     }
-    poly_compress_v(v_poly, &ct_local[KYBER_K*320]);
+    arith_link_poly(poly_in, eng, e2);
+}
+
+static void arith_msg(uint8 m_in[32], int16 m_poly[KYBER_N]) {
+    #pragma HLS INLINE off
+    uint8 m[32];
+    #pragma HLS ARRAY_PARTITION variable=m complete
+    for(int i=0; i<32; i++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        m[i] = m_in[i];
+    }
+    poly_frommsg(m, m_poly);
+}
+
+static void encaps_arith_op(
+    uint8 pk_in[PK_SIZE],
+    uint8 m_in[32],
+    hls::stream<xof_link_t> poly_in[HW_XOF_ENGINES],
+    int eng,
+    uint8 ct_out[CT_SIZE],
+    int& status
+) {
+    #pragma HLS INLINE off
+
+    int16 t_hat[KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=t_hat dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=t_hat dim=2 cyclic factor=HW_POLY_PART)
 
-    memcpy(ct_out, ct_local, CT_SIZE);
-}
\ No newline at end of file
+    int16 A_T[KYBER_K][KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=A_T dim=1 type=complete
+    #pragma HLS ARRAY_PARTITION variable=A_T dim=2 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=A_T dim=3 cyclic factor=HW_POLY_PART)
+
+    int16 r_hat[KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=r_hat dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=r_hat dim=2 cyclic factor=HW_POLY_PART)
+
+    int16 e1[KYBER_K][KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=e1 dim=1 type=complete
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=e1 dim=2 cyclic factor=HW_POLY_PART)
+
+    int16 e2[KYBER_N];
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=e2 cyclic factor=HW_POLY_PART)
+    int16 m_poly[KYBER_N];
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=m_poly cyclic factor=HW_POLY_PART)
+
+    hls::stream<beat_t> dec_strm;
+    #pragma HLS STREAM variable=dec_strm depth=4
+
+    // Split kernel không xuất perf
+    perf_t pf_off[PERF_SLOTS];
+
+    #pragma HLS DATAFLOW
+    arith_read_t(pk_in, dec_strm);
+    ek_decode_beats(dec_strm, t_hat, status);
+    arith_unpack(poly_in, eng, A_T, r_hat, e1, e2);
+    arith_msg(m_in, m_poly);
+    encaps_finish(A_T, t_hat, r_hat, e1, e2, m_poly, ct_out, pf_off);
+}
+
+int ml_kem_encaps_arith(
+    int n_ops,
+    uint8 pk_in[PK_SIZE * ENCAPS_BATCH_MAX],
+    uint8 m_in[32 * ENCAPS_BATCH_MAX],
+    hls::stream<xof_link_t> poly_in[HW_XOF_ENGINES],
+    uint8 ct_out[CT_SIZE * ENCAPS_BATCH_MAX]
+) {
+    #pragma HLS INTERFACE s_axilite port=n_ops
+    #pragma HLS INTERFACE m_axi port=pk_in bundle=gmem0 depth=PK_BATCH_BYTES max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=m_in bundle=gmem0 depth=M_BATCH_BYTES max_widen_bitwidth=128
+    #pragma HLS INTERFACE axis port=poly_in
+    #pragma HLS INTERFACE m_axi port=ct_out bundle=gmem1 depth=CT_BATCH_BYTES max_widen_bitwidth=128
+    #pragma HLS INTERFACE s_axilite port=return
+
+    int status_all = KEY_STATUS_OK;
+    int eng = 0;
+    Arith_Op_Loop: for(int op=0; op<n_ops; op++) {
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=ENCAPS_BATCH_MAX
+        int status;
+        encaps_arith_op(&pk_in[op * PK_SIZE], &m_in[op * 32], poly_in, eng, &ct_out[op * CT_SIZE], status);
+        status_all |= status;
+        eng = (eng == HW_XOF_ENGINES - 1) ? 0 : eng + 1;
+    }
+    return status_all;
+}
@@ -0,0 +1,100 @@
+#ifndef HW_CONFIG_H
+#define HW_CONFIG_H
+
+// =========================================================
+// HW PARALLELISM KNOBS
+// =========================================================
+// Mọi lựa chọn song song / partition / II của các kernel đọc từ đây.
+// Giá trị mặc định ~ cấu hình đã chạy trên K26 (bitstream/), có thể ghi đè
+// bằng -D lúc C-synthesis, vd: -DHW_KG_KECCAK=5 -DHW_POLY_PART=8.
+// sweep_hw_config.py quét các knob này và gom latency / II / tài nguyên vào CSV.
+
+// Pragma có tham số là macro: _Pragma cần chuỗi đã expand,
+// nên phải qua 2 tầng macro để HW_* được thay giá trị trước khi stringify.
+#define HW_PRAGMA_SUB(x) _Pragma(#x)
+#define DO_PRAGMA(x) HW_PRAGMA_SUB(x)
+
+// --- Keccak-f1600 instances (ALLOCATION limit) ---
+#ifndef HW_KG_KECCAK
+#define HW_KG_KECCAK 6   // keygen: G + noise + K cột A (matvec_keygen), cần >= K+1
+#endif
+#ifndef HW_KEM_KECCAK
+#define HW_KEM_KECCAK 3  // encaps / decaps: G, PRF noise
+#endif
+#ifndef HW_XOF_KECCAK
+#define HW_XOF_KECCAK 3  // gen_matrix / kernel XOF: số hàng A expand song song
+#endif
+
+// --- NTT units (ALLOCATION limit) ---
+// basemul không còn knob: K PE trong matvec.cpp + K trong poly_basemul_acc
+#ifndef HW_KG_NTT
+#define HW_KG_NTT 6
+#endif
+#ifndef HW_KEM_NTT
+#define HW_KEM_NTT 3     // ntt và inv_ntt mỗi loại
+#endif
+
+// --- NTT butterfly ---
+// Số butterfly mỗi vòng trong 1 lõi NTT (UNROLL factor của loop j),
+// cần HW_POLY_PART >= 2 * HW_NTT_BUTTERFLIES để đủ cổng RAM.
+#ifndef HW_NTT_BUTTERFLIES
+#define HW_NTT_BUTTERFLIES 1
+#endif
+#ifndef HW_NTT_II
+#define HW_NTT_II 2      // poly[j], poly[j+len] cùng bank khi len chẵn
+#endif
+
+// --- Partition ---
+// cyclic factor của mọi mảng hệ số int16[256], đồng thời là số lane của
+// poly_ops.h (add / sub / acc / reduce xử lý HW_POLY_PART hệ số / chu kỳ).
+// Bitstream cũ dùng 2 (accumulate II=2); 4 cho accumulate 4 hệ số / chu kỳ.
+#ifndef HW_POLY_PART
+#define HW_POLY_PART 4
+#endif
+#ifndef HW_BYTES_PART
+#define HW_BYTES_PART 3  // block factor của buffer pk / sk / ct local
+#endif
+
+// --- Sampler (SampleNTT) ---
+// Parse đọc 3 byte / ứng viên từ stream 8-bit -> II >= 3. Độ rộng stream cố
+// định 1 byte / chu kỳ (xof_absorb_squeeze), không có knob width: II > 3 chỉ
+// đổi throughput parse lấy ít logic hơn.
+#ifndef HW_SAMPLER_II
+#define HW_SAMPLER_II 3
+#endif
+#ifndef HW_XOF_DEPTH
+#define HW_XOF_DEPTH 256 // depth stream XOF -> parse
+#endif
+
+// --- Split XOF / arith (xof_engine.cpp + ml_kem_encaps_arith) ---
+// Số kernel XOF nối AXIS vào 1 kernel arith; op k lấy đa thức từ link k % N.
+#ifndef HW_XOF_ENGINES
+#define HW_XOF_ENGINES 2
+#endif
+
+// --- Session (session.cpp) ---
+// Số slot key AES-256 giữ on-chip, mỗi slot = 1 phiên (ss của 1 encaps / decaps).
+#ifndef HW_SESSION_SLOTS
+#define HW_SESSION_SLOTS 4
+#endif
+// SESSION_CIPHER_AES_CTR / SESSION_CIPHER_DUPLEX (params.h)
+#ifndef HW_SESSION_CIPHER
+#define HW_SESSION_CIPHER 0
+#endif
+
+// --- AES-GCM (aes_gcm.cpp) ---
+// Số block GHASH gộp / lần reduce: HW_GHASH_WAYS nhân Karatsuba song song với
+// H^W .. H^1, loop II = HW_GHASH_WAYS -> vẫn 1 block / chu kỳ như datapath CTR,
+// vòng hồi tiếp X có HW_GHASH_WAYS chu kỳ cho nhân + reduce.
+#ifndef HW_GHASH_WAYS
+#define HW_GHASH_WAYS 4
+#endif
+
+#if HW_POLY_PART < 2 * HW_NTT_BUTTERFLIES
+#error "HW_POLY_PART must be >= 2 * HW_NTT_BUTTERFLIES"
+#endif
+#if HW_GHASH_WAYS < 1 || HW_GHASH_WAYS > 8
+#error "HW_GHASH_WAYS must be in 1..8"
+#endif
+
+#endif
@@ -6,17 +6,16 @@
 // --- EXTERN DECLARATIONS ---
 extern void keccak_f1600(uint64_t state[25]); 
 extern void sha3_512_hash(uint8 input[33], uint8 output[64]);
-extern void shake256_prf(uint8 input[33], uint64_t output_64[16]);
-extern void cbd_eta2(ap_uint<64> input_buf[16], int16 coeffs[256]);
+template <int ETA> void sample_poly_cbd(uint8 seed[32], uint8 nonce, int16 coeffs[KYBER_N]);
 extern void ntt(int16 poly[256]);
-extern void poly_pointwise(int16 a[256], int16 b[256], int16 r[256]);
-extern void xof_absorb_squeeze(ap_uint<64> input_B[5], hls::stream<uint8>& out_stream);
-extern void parse_ntt(hls::stream<uint8>& in_bytes, int16 a_hat[KYBER_N]);
+extern void matvec_keygen(uint8 rho[32], int16 s_hat[KYBER_K][KYBER_N], int16 e_hat[KYBER_K][KYBER_N],
+                          uint8 t_bytes[KYBER_POLYVECBYTES]);
 
 static void poly_tobytes(int16 coeffs[KYBER_N], uint8 output[384]) {
     #pragma HLS INLINE
     for(int i=0; i<KYBER_N/2; i++) {
         #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
         uint16_t t0 = coeffs[2*i];
         uint16_t t1 = coeffs[2*i+1];
         output[3*i+0] = (uint8)(t0 & 0xFF);
@@ -25,167 +24,202 @@ static void poly_tobytes(int16 coeffs[KYBER_N], uint8 output[384]) {
     }
 }
 
-#define PK_SIZE_BYTES (384 * KYBER_K + 32)
-#define SK_SIZE_BYTES (384 * KYBER_K)
-
-void ml_kem_keygen(
-    ap_uint<64> seed_d[4],
-    ap_uint<64> seed_z[4],
-    uint8 pk_out[PK_SIZE_BYTES],  
-    uint8 sk_out[SK_SIZE_BYTES]   
+#define PK_SIZE_BYTES KYBER_PK_BYTES
+#define SK_SIZE_BYTES KYBER_POLYVECBYTES // chỉ phần s_hat encoded
+#define KEYGEN_BATCH_MAX 64
+// depth m_axi của batch: đủ KEYGEN_BATCH_MAX op (co-sim)
+#define SEEDS_BATCH_WORDS (8 * KEYGEN_BATCH_MAX)
+#define PK_BATCH_BYTES    (PK_SIZE_BYTES * KEYGEN_BATCH_MAX)
+#define SK_BATCH_BYTES    (SK_SIZE_BYTES * KEYGEN_BATCH_MAX)
+#define Z_BATCH_BYTES     (32 * KEYGEN_BATCH_MAX)
+
+extern void drbg_generate(ap_uint<64> seed[4], ap_uint<64> ctr, uint8 domain, uint8 out[DRBG_OUT_BYTES]);
+extern void perf_clear(perf_t pf[PERF_SLOTS]);
+
+// Thân KeyGen dùng chung cho ml_kem_keygen và ml_kem_keygen_batch
+// perf[]: HASH, NOISE, MATRIX (gồm cả XOF + encode vì A được expand on-the-fly), STORE
+static void keygen_core(
+    uint8 d[32],
+    uint8 pk_out[PK_SIZE_BYTES],
+    uint8 sk_out[SK_SIZE_BYTES],
+    perf_t perf[PERF_SLOTS]
 ) {
-    #pragma HLS INTERFACE m_axi port=seed_d bundle=gmem0 depth=4 max_widen_bitwidth=128
-    #pragma HLS INTERFACE m_axi port=seed_z bundle=gmem0 depth=4 max_widen_bitwidth=128
-    #pragma HLS INTERFACE m_axi port=pk_out bundle=gmem1 depth=1184 max_widen_bitwidth=128
-    #pragma HLS INTERFACE m_axi port=sk_out bundle=gmem1 depth=1152 max_widen_bitwidth=128
-    #pragma HLS INTERFACE s_axilite port=return
+    #pragma HLS INLINE off
+    #pragma HLS ARRAY_PARTITION variable=d complete
 
-    // --- CHIẾN LƯỢC LIMIT = 5 (SWEET SPOT) ---
-    // 5 bộ Keccak sẽ xử lý 9 phần tử ma trận trong 2 lượt (5 song song -> 4 song song)
-    // Tổng cộng sẽ có 1 bộ cho Hash/Noise + 5 bộ cho Matrix = 6 bộ vật lý được tạo ra
-    #pragma HLS ALLOCATION function instances=keccak_f1600 limit=6
-    #pragma HLS ALLOCATION function instances=ntt limit=6
-    #pragma HLS ALLOCATION function instances=poly_pointwise limit=6
+    // --- SỐ LÕI: xem hw_config.h (Keccak: 1 Hash/Noise + K cột của matvec_keygen) ---
+    DO_PRAGMA(HLS ALLOCATION function instances=keccak_f1600 limit=HW_KG_KECCAK)
+    DO_PRAGMA(HLS ALLOCATION function instances=ntt limit=HW_KG_NTT)
 
     // --- BUFFERS ---
     int16 s_hat[KYBER_K][KYBER_N];
     #pragma HLS ARRAY_PARTITION variable=s_hat dim=1 type=complete
-    #pragma HLS ARRAY_PARTITION variable=s_hat dim=2 cyclic factor=2
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=s_hat dim=2 cyclic factor=HW_POLY_PART)
 
     int16 e_hat[KYBER_K][KYBER_N];
     #pragma HLS ARRAY_PARTITION variable=e_hat dim=1 type=complete
-    #pragma HLS ARRAY_PARTITION variable=e_hat dim=2 cyclic factor=2
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=e_hat dim=2 cyclic factor=HW_POLY_PART)
 
     uint8 pk_local[PK_SIZE_BYTES];
-    #pragma HLS ARRAY_PARTITION variable=pk_local block factor=3 
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=pk_local block factor=HW_BYTES_PART)
     uint8 sk_local[SK_SIZE_BYTES];
-    #pragma HLS ARRAY_PARTITION variable=sk_local block factor=3
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=sk_local block factor=HW_BYTES_PART)
 
     uint8 rho[32], sigma[32];
     #pragma HLS ARRAY_PARTITION variable=rho complete
     #pragma HLS ARRAY_PARTITION variable=sigma complete
 
+    perf_t t = PERF_NOW(0);
+
     // Step 1: Hash G
     uint8 g_in[33];
     #pragma HLS ARRAY_PARTITION variable=g_in complete
-    for(int i=0; i<4; i++) {
+    for(int i=0; i<32; i++) {
         #pragma HLS UNROLL
-        uint64_t w = seed_d[i];
-        for(int j=0; j<8; j++) g_in[i*8+j] = (uint8)(w >> (j*8));
+        g_in[i] = d[i];
     }
     g_in[32] = KYBER_K;
 
     uint8 g_out[64];
     sha3_512_hash(g_in, g_out);
+    PERF_TICK(PERF_ITERS_KECCAK);
     for(int i=0; i<32; i++) {
         #pragma HLS UNROLL
         rho[i]   = g_out[i];
         sigma[i] = g_out[32+i];
     }
+    PERF_MARK(perf, PERF_HASH, t);
 
-    uint8 sigma_local[32];
-    #pragma HLS ARRAY_PARTITION variable=sigma_local complete
-    for(int i=0;i<32;i++) sigma_local[i] = sigma[i];
-
-    // Step 2: Gen s & e (Unroll 3 is fine, uses 3/6 Keccaks)
+    // Step 2: Gen s & e (Unroll K, nonce s: 0..K-1, e: K..2K-1)
     Gen_S_Loop: for(int i=0; i<KYBER_K; i++) {
         #pragma HLS UNROLL
-        uint8 prf_in[33];
-        #pragma HLS ARRAY_PARTITION variable=prf_in complete
-        for(int k=0; k<32; k++) prf_in[k] = sigma_local[k];
-        prf_in[32] = (uint8)i; 
-        
-        uint64_t cbd_input[16];
-        shake256_prf(prf_in, cbd_input);
-        
-        ap_uint<64> cbd_ap[16];
-        #pragma HLS ARRAY_PARTITION variable=cbd_ap complete
-        for(int k=0; k<16; k++) cbd_ap[k] = cbd_input[k];
-
-        int16 poly_temp[256];
-        #pragma HLS ARRAY_PARTITION variable=poly_temp cyclic factor=2
-        cbd_eta2(cbd_ap, poly_temp);
-        ntt(poly_temp);
-        for(int k=0; k<256; k++) s_hat[i][k] = poly_temp[k];
-        poly_tobytes(s_hat[i], &sk_local[i*384]);
+        sample_poly_cbd<KYBER_ETA1>(sigma, (uint8)i, s_hat[i]);
+        ntt(s_hat[i]);
+        PERF_TICK(PERF_ITERS_CBD(KYBER_ETA1) + PERF_ITERS_NTT);
+        poly_tobytes(s_hat[i], &sk_local[i*KYBER_POLYBYTES]);
     }
 
     Gen_E_Loop: for(int i=0; i<KYBER_K; i++) {
         #pragma HLS UNROLL
-        uint8 prf_in[33];
-        #pragma HLS ARRAY_PARTITION variable=prf_in complete
-        for(int k=0; k<32; k++) prf_in[k] = sigma_local[k];
-        prf_in[32] = (uint8)(3 + i); 
-        uint64_t cbd_input[16];
-        shake256_prf(prf_in, cbd_input);
-        ap_uint<64> cbd_ap[16];
-        #pragma HLS ARRAY_PARTITION variable=cbd_ap complete
-        for(int k=0; k<16; k++) cbd_ap[k] = cbd_input[k];
-        int16 poly_temp[256];
-        #pragma HLS ARRAY_PARTITION variable=poly_temp cyclic factor=2
-        cbd_eta2(cbd_ap, poly_temp);
-        ntt(poly_temp);
-        for(int k=0; k<256; k++) e_hat[i][k] = poly_temp[k];
+        sample_poly_cbd<KYBER_ETA1>(sigma, (uint8)(KYBER_K + i), e_hat[i]);
+        ntt(e_hat[i]);
+        PERF_TICK(PERF_ITERS_CBD(KYBER_ETA1) + PERF_ITERS_NTT);
     }
+    PERF_MARK(perf, PERF_NOISE, t);
 
-    // Step 3: Matrix Mult with Limit=6
-    Gen_PK_Loop: for(int i=0; i<KYBER_K; i++) {
-        #pragma HLS UNROLL 
-        
-        int16 acc[256];
-        #pragma HLS ARRAY_PARTITION variable=acc cyclic factor=2
-        
-        int16 products[KYBER_K][256];
-        #pragma HLS ARRAY_PARTITION variable=products dim=1 complete
-        #pragma HLS ARRAY_PARTITION variable=products dim=2 cyclic factor=2
-
-        // UNROLL vòng lặp này: Sẽ yêu cầu 3 bộ Keccak cho mỗi hàng i
-        // Tổng cộng 3 hàng x 3 cột = 9 bộ.
-        // NHƯNG ta đã set limit=6. HLS sẽ tự động schedule:
-        // Cycle T: Chạy 3 bộ cho i=0, và 3 bộ cho i=1. (Tổng 6)
-        // Cycle T+n: Chạy nốt 3 bộ cho i=2.
-        // -> Rất hiệu quả!
-        for(int j=0; j<KYBER_K; j++) {
-            #pragma HLS UNROLL 
-            
-            ap_uint<64> xof_in[5];
-            #pragma HLS ARRAY_PARTITION variable=xof_in complete
-            for(int w=0; w<4; w++) {
-                #pragma HLS UNROLL
-                uint64_t val = 0;
-                for(int b=0; b<8; b++) val |= ((uint64_t)rho[w*8+b] << (b*8));
-                xof_in[w] = val;
-            }
-            xof_in[4] = (uint64_t)j | ((uint64_t)i << 8); 
-
-            hls::stream<uint8> strm;
-            #pragma HLS STREAM variable=strm depth=256
-            
-            int16 A_poly_temp[256];
-            #pragma HLS ARRAY_PARTITION variable=A_poly_temp cyclic factor=2
-            
-            xof_absorb_squeeze(xof_in, strm);
-            parse_ntt(strm, A_poly_temp);
-            poly_pointwise(A_poly_temp, s_hat[j], products[j]);
-        }
-        
-        for(int k=0; k<256; k++) {
-            #pragma HLS PIPELINE II=1
-            ap_int<16> sum = e_hat[i][k];
-            for(int j=0; j<KYBER_K; j++) sum += products[j][k];
-            while(sum >= KYBER_Q) sum -= KYBER_Q;
-            if(sum < 0) sum += KYBER_Q;
-            acc[k] = (int16)sum;
-        }
-        poly_tobytes(acc, &pk_local[i*384]);
-    }
+    // Step 3: t = A o s + e qua matvec engine (A sample theo cột, stream
+    // thẳng vào K PE), ByteEncode_12(t) ghi thẳng vào pk_local
+    matvec_keygen(rho, s_hat, e_hat, pk_local);
+    PERF_TICK(PERF_ITERS_MATVEC_KEYGEN);
 
-    int rho_offset = 384 * KYBER_K;
+    int rho_offset = KYBER_POLYVECBYTES;
     for(int i=0; i<32; i++) {
         #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
         pk_local[rho_offset + i] = rho[i];
     }
+    PERF_MARK(perf, PERF_MATRIX, t);
 
     memcpy(sk_out, sk_local, SK_SIZE_BYTES);
     memcpy(pk_out, pk_local, PK_SIZE_BYTES);
-}
\ No newline at end of file
+    PERF_TICK((SK_SIZE_BYTES + PK_SIZE_BYTES) / AXI_BEAT_BYTES);
+    PERF_MARK(perf, PERF_STORE, t);
+}
+
+// perf: cycle theo phase PERF_* (AXI-lite, host chỉ đọc), đếm bằng perf_clock_now
+void ml_kem_keygen(
+    ap_uint<64> seed_d[4],
+    ap_uint<64> seed_z[4],
+    uint8 pk_out[PK_SIZE_BYTES],  
+    uint8 sk_out[SK_SIZE_BYTES],
+    perf_t perf[PERF_SLOTS]
+) {
+    #pragma HLS INTERFACE m_axi port=seed_d bundle=gmem0 depth=4 max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=seed_z bundle=gmem0 depth=4 max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=pk_out bundle=gmem1 depth=PK_SIZE_BYTES max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=sk_out bundle=gmem1 depth=SK_SIZE_BYTES max_widen_bitwidth=128
+    #pragma HLS INTERFACE s_axilite port=perf
+    #pragma HLS INTERFACE s_axilite port=return
+
+    perf_clear(perf);
+    perf_t t_start = PERF_NOW(0);
+    perf_t t = t_start;
+
+    uint8 d[32];
+    #pragma HLS ARRAY_PARTITION variable=d complete
+    for(int i=0; i<4; i++) {
+        #pragma HLS UNROLL
+        uint64_t w = seed_d[i];
+        for(int j=0; j<8; j++) d[i*8+j] = (uint8)(w >> (j*8));
+    }
+    PERF_TICK(4);
+    PERF_MARK(perf, PERF_LOAD, t);
+
+    keygen_core(d, pk_out, sk_out, perf);
+    perf[PERF_TOTAL] = PERF_NOW(t) - t_start;
+}
+
+// =========================================================
+// BATCH KEYGEN: d, z sinh bởi DRBG on-chip
+// =========================================================
+// drbg_seed/drbg_ctr/mode/n_ops nằm trên AXI-lite, host chỉ ghi 1 lần cho cả batch.
+// Request thứ op dùng ctr = drbg_ctr + op, out = d || z.
+// mode = DRBG_MODE_REPLAY: d || z đọc từ seeds_in (8 words / op) -> chạy lại KAT;
+// mọi giá trị mode khác (kể cả 0 mặc định) là DRBG_MODE_LIVE.
+// z được trả về qua z_out để host ghép thành dk đầy đủ.
+void ml_kem_keygen_batch(
+    ap_uint<64> drbg_seed[4],
+    ap_uint<64> drbg_ctr,
+    int mode,
+    int n_ops,
+    ap_uint<64> seeds_in[8 * KEYGEN_BATCH_MAX],
+    uint8 pk_out[PK_SIZE_BYTES * KEYGEN_BATCH_MAX],
+    uint8 sk_out[SK_SIZE_BYTES * KEYGEN_BATCH_MAX],
+    uint8 z_out[32 * KEYGEN_BATCH_MAX]
+) {
+    #pragma HLS INTERFACE s_axilite port=drbg_seed
+    #pragma HLS INTERFACE s_axilite port=drbg_ctr
+    #pragma HLS INTERFACE s_axilite port=mode
+    #pragma HLS INTERFACE s_axilite port=n_ops
+    #pragma HLS INTERFACE m_axi port=seeds_in bundle=gmem0 depth=SEEDS_BATCH_WORDS max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=pk_out bundle=gmem1 depth=PK_BATCH_BYTES max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=sk_out bundle=gmem1 depth=SK_BATCH_BYTES max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=z_out bundle=gmem1 depth=Z_BATCH_BYTES max_widen_bitwidth=128
+    #pragma HLS INTERFACE s_axilite port=return
+
+    // Batch không xuất perf
+    perf_t perf_off[PERF_SLOTS];
+
+    ap_uint<64> seed_local[4];
+    #pragma HLS ARRAY_PARTITION variable=seed_local complete
+    for(int i=0; i<4; i++) {
+        #pragma HLS UNROLL
+        seed_local[i] = drbg_seed[i];
+    }
+
+    Batch_Loop: for(int op=0; op<n_ops; op++) {
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=KEYGEN_BATCH_MAX
+        uint8 dz[DRBG_OUT_BYTES];
+        #pragma HLS ARRAY_PARTITION variable=dz complete
+
+        if (mode == DRBG_MODE_REPLAY) {
+            for(int i=0; i<8; i++) {
+                #pragma HLS PIPELINE II=1
+                PERF_TICK(1);
+                uint64_t w = seeds_in[op*8 + i];
+                for(int j=0; j<8; j++) dz[i*8+j] = (uint8)(w >> (j*8));
+            }
+        } else {
+            drbg_generate(seed_local, drbg_ctr + op, DRBG_DOMAIN_KEYGEN, dz);
+        }
+
+        perf_clear(perf_off);
+        keygen_core(dz, &pk_out[op * PK_SIZE_BYTES], &sk_out[op * SK_SIZE_BYTES], perf_off);
+
+        for(int i=0; i<32; i++) {
+            #pragma HLS PIPELINE II=1
+            PERF_TICK(1);
+            z_out[op*32 + i] = dz[32 + i];
+        }
+    }
+}
@@ -0,0 +1,306 @@
+#include "params.h"
+#include "hls_stream.h"
+#include "ap_int.h"
+#include "poly_ops.h"
+
+// --- EXTERN DECLARATIONS ---
+extern const int16 GAMMAS[128];
+extern void basemul(int16 a0, int16 a1, int16 b0, int16 b1, int16 gamma, int16* c0_out, int16* c1_out);
+extern void gen_matrix_col(hls::stream<ap_uint<64> >& rho_strm, int j, hls::stream<coef_pair_t>& a_col);
+
+// =========================================================
+// MATRIX-VECTOR ENGINE (miền NTT): y[i] = init[i] + sum_j M[i][j] o v[j]
+// =========================================================
+// Chuỗi systolic K PE, PE j giữ v[j] resident trong BRAM riêng:
+//
+//   init -> PE_0 -> PE_1 -> ... -> PE_{K-1} -> y      (psum, theo hàng)
+//            ^       ^               ^
+//          M[.][0]  M[.][1]        M[.][K-1]          (a_strm[j], theo hàng)
+//
+// Mỗi chu kỳ mỗi PE nhận 1 cặp hệ số của M[i][j], làm 1 basemul với cặp
+// tương ứng của v[j], cộng psum từ PE trước (chưa reduce) rồi đẩy sang PE sau.
+// K PE chạy chồng nhau (lệch nhau vài chu kỳ), nên 1 hàng ra sau ~128 chu
+// kỳ và toàn bộ ROWS hàng mất ~ROWS*128 + K*latency(PE): đúng bằng thời
+// gian stream K^2 đa thức qua K cổng song song, không còn buffer tích.
+
+static coef_pair_t pair_pack(int16 c0, int16 c1) {
+    #pragma HLS INLINE
+    return ((coef_pair_t)(ap_uint<16>)c1 << 16) | (coef_pair_t)(ap_uint<16>)c0;
+}
+
+static int16 pair_lo(coef_pair_t p) {
+    #pragma HLS INLINE
+    return (int16)p.range(15, 0);
+}
+
+static int16 pair_hi(coef_pair_t p) {
+    #pragma HLS INLINE
+    return (int16)p.range(31, 16);
+}
+
+// ---------------------------------------------------------
+// PE: nạp v[j] (128 cặp), rồi xử lý ROWS hàng
+// ---------------------------------------------------------
+template <int ROWS>
+static void matvec_pe(
+    hls::stream<coef_pair_t>& v_in,
+    hls::stream<coef_pair_t>& a_in,
+    hls::stream<coef_pair_t>& psum_in,
+    hls::stream<coef_pair_t>& psum_out
+) {
+    #pragma HLS INLINE off
+
+    // 2 hệ số / chu kỳ -> factor 2 là đủ
+    int16 v_loc[KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=v_loc cyclic factor=2
+
+    PE_Load_Loop: for(int p=0; p<KYBER_N/2; p++) {
+        #pragma HLS PIPELINE II=1
+        coef_pair_t w = v_in.read();
+        v_loc[2*p]   = pair_lo(w);
+        v_loc[2*p+1] = pair_hi(w);
+    }
+
+    PE_Row_Loop: for(int i=0; i<ROWS; i++) {
+        for(int p=0; p<KYBER_N/2; p++) {
+            #pragma HLS PIPELINE II=1
+            coef_pair_t a  = a_in.read();
+            coef_pair_t ps = psum_in.read();
+
+            int16 c0, c1;
+            basemul(pair_lo(a), pair_hi(a), v_loc[2*p], v_loc[2*p+1], GAMMAS[p], &c0, &c1);
+
+            // Không reduce: psum sau PE j < (j+2)Q <= (K+1)Q < 2^15,
+            // matvec_link_out reduce 1 lần ở cuối chuỗi
+            psum_out.write(pair_pack(c0 + pair_lo(ps), c1 + pair_hi(ps)));
+        }
+    }
+}
+
+// Đầu / cuối chuỗi: tách khỏi vòng PE để mỗi link có đúng 1 producer / 1 consumer
+template <int ROWS>
+static void matvec_link_in(hls::stream<coef_pair_t>& in, hls::stream<coef_pair_t>& out) {
+    #pragma HLS INLINE off
+    for(int n=0; n<ROWS*KYBER_N/2; n++) {
+        #pragma HLS PIPELINE II=1
+        out.write(in.read());
+    }
+}
+
+// Cuối chuỗi: reduce tổng K+1 số hạng về [0, Q)
+template <int ROWS>
+static void matvec_link_out(hls::stream<coef_pair_t>& in, hls::stream<coef_pair_t>& out) {
+    #pragma HLS INLINE off
+    for(int n=0; n<ROWS*KYBER_N/2; n++) {
+        #pragma HLS PIPELINE II=1
+        coef_pair_t w = in.read();
+        out.write(pair_pack(poly_reduce_wide(pair_lo(w)), poly_reduce_wide(pair_hi(w))));
+    }
+}
+
+template <int ROWS>
+void matvec_ntt(
+    hls::stream<coef_pair_t> v_strm[KYBER_K],
+    hls::stream<coef_pair_t> a_strm[KYBER_K],
+    hls::stream<coef_pair_t>& init_strm,
+    hls::stream<coef_pair_t>& y_strm
+) {
+    #pragma HLS DATAFLOW
+
+    hls::stream<coef_pair_t> link[KYBER_K + 1];
+    #pragma HLS STREAM variable=link depth=4
+
+    matvec_link_in<ROWS>(init_strm, link[0]);
+    PE_Chain: for(int j=0; j<KYBER_K; j++) {
+        #pragma HLS UNROLL
+        matvec_pe<ROWS>(v_strm[j], a_strm[j], link[j], link[j + 1]);
+    }
+    matvec_link_out<ROWS>(link[KYBER_K], y_strm);
+}
+
+template void matvec_ntt<KYBER_K>(hls::stream<coef_pair_t>*, hls::stream<coef_pair_t>*,
+                                  hls::stream<coef_pair_t>&, hls::stream<coef_pair_t>&);
+template void matvec_ntt<KYBER_K + 1>(hls::stream<coef_pair_t>*, hls::stream<coef_pair_t>*,
+                                      hls::stream<coef_pair_t>&, hls::stream<coef_pair_t>&);
+
+// =========================================================
+// FEEDERS / DRAIN (mảng <-> stream cặp hệ số)
+// =========================================================
+// v[j] -> v_strm[j], K PE nạp song song
+static void matvec_feed_vec(
+    int16 v[KYBER_K][KYBER_N],
+    hls::stream<coef_pair_t> v_strm[KYBER_K]
+) {
+    #pragma HLS INLINE off
+    Feed_Vec_Loop: for(int p=0; p<KYBER_N/2; p++) {
+        #pragma HLS PIPELINE II=1
+        for(int j=0; j<KYBER_K; j++) {
+            #pragma HLS UNROLL
+            v_strm[j].write(pair_pack(v[j][2*p], v[j][2*p+1]));
+        }
+    }
+}
+
+// init[i] -> psum đầu chuỗi (KeyGen: e_hat)
+static void matvec_feed_init(
+    int16 init[KYBER_K][KYBER_N],
+    hls::stream<coef_pair_t>& init_strm
+) {
+    #pragma HLS INLINE off
+    Feed_Init_Loop: for(int i=0; i<KYBER_K; i++) {
+        for(int p=0; p<KYBER_N/2; p++) {
+            #pragma HLS PIPELINE II=1
+            init_strm.write(pair_pack(init[i][2*p], init[i][2*p+1]));
+        }
+    }
+}
+
+// Không có init: psum đầu chuỗi = 0
+template <int ROWS>
+static void matvec_feed_zero(hls::stream<coef_pair_t>& init_strm) {
+    #pragma HLS INLINE off
+    for(int n=0; n<ROWS*KYBER_N/2; n++) {
+        #pragma HLS PIPELINE II=1
+        init_strm.write((coef_pair_t)0);
+    }
+}
+
+// Hàng i < K: A_T[i][j], hàng K: t_hat[j]  (u = A^T r, v = t^T r trong 1 lượt)
+static void matvec_feed_rows(
+    int16 A_T[KYBER_K][KYBER_K][KYBER_N],
+    int16 t_hat[KYBER_K][KYBER_N],
+    hls::stream<coef_pair_t> a_strm[KYBER_K]
+) {
+    #pragma HLS INLINE off
+    Feed_Rows_Loop: for(int i=0; i<KYBER_K + 1; i++) {
+        for(int p=0; p<KYBER_N/2; p++) {
+            #pragma HLS PIPELINE II=1
+            for(int j=0; j<KYBER_K; j++) {
+                #pragma HLS UNROLL
+                int16 c0 = (i < KYBER_K) ? A_T[i][j][2*p]   : t_hat[j][2*p];
+                int16 c1 = (i < KYBER_K) ? A_T[i][j][2*p+1] : t_hat[j][2*p+1];
+                a_strm[j].write(pair_pack(c0, c1));
+            }
+        }
+    }
+}
+
+static void matvec_drain_uv(
+    hls::stream<coef_pair_t>& y_strm,
+    int16 u[KYBER_K][KYBER_N],
+    int16 v[KYBER_N]
+) {
+    #pragma HLS INLINE off
+    Drain_Loop: for(int i=0; i<KYBER_K + 1; i++) {
+        for(int p=0; p<KYBER_N/2; p++) {
+            #pragma HLS PIPELINE II=1
+            coef_pair_t w = y_strm.read();
+            if(i < KYBER_K) {
+                u[i][2*p]   = pair_lo(w);
+                u[i][2*p+1] = pair_hi(w);
+            } else {
+                v[2*p]   = pair_lo(w);
+                v[2*p+1] = pair_hi(w);
+            }
+        }
+    }
+}
+
+// =========================================================
+// WRAPPER: Encaps / Decaps (A^T đã expand sẵn trong BRAM)
+// =========================================================
+// u = A^T o r_hat, v = t_hat^T o r_hat (chưa inv_ntt)
+void matvec_At_t(
+    int16 A_T[KYBER_K][KYBER_K][KYBER_N],
+    int16 t_hat[KYBER_K][KYBER_N],
+    int16 r_hat[KYBER_K][KYBER_N],
+    int16 u[KYBER_K][KYBER_N],
+    int16 v[KYBER_N]
+) {
+    #pragma HLS INLINE off
+    #pragma HLS DATAFLOW
+
+    hls::stream<coef_pair_t> v_strm[KYBER_K];
+    #pragma HLS STREAM variable=v_strm depth=2
+    hls::stream<coef_pair_t> a_strm[KYBER_K];
+    #pragma HLS STREAM variable=a_strm depth=KYBER_N/2
+    hls::stream<coef_pair_t> init_strm;
+    #pragma HLS STREAM variable=init_strm depth=2
+    hls::stream<coef_pair_t> y_strm;
+    #pragma HLS STREAM variable=y_strm depth=2
+
+    matvec_feed_vec(r_hat, v_strm);
+    matvec_feed_zero<KYBER_K + 1>(init_strm);
+    matvec_feed_rows(A_T, t_hat, a_strm);
+    matvec_ntt<KYBER_K + 1>(v_strm, a_strm, init_strm, y_strm);
+    matvec_drain_uv(y_strm, u, v);
+}
+
+// =========================================================
+// WRAPPER: KeyGen (A expand on-the-fly từ rho, t_hat encode ngay)
+// =========================================================
+// t = A o s_hat + e_hat, ghi thẳng ByteEncode_12(t) vào t_bytes.
+// K cột A được sample song song (K Keccak), stream thẳng vào PE tương ứng.
+static void matvec_split_rho(
+    uint8 rho[32],
+    hls::stream<ap_uint<64> > rho_strm[KYBER_K]
+) {
+    #pragma HLS INLINE off
+    for(int w=0; w<4; w++) {
+        #pragma HLS PIPELINE II=1
+        uint64_t val = 0;
+        for(int b=0; b<8; b++) val |= ((uint64_t)rho[w*8+b] << (b*8));
+        for(int j=0; j<KYBER_K; j++) {
+            #pragma HLS UNROLL
+            rho_strm[j].write(val);
+        }
+    }
+}
+
+// 1 cặp hệ số -> 3 byte (ByteEncode_12, giống poly_tobytes)
+static void matvec_encode_t(
+    hls::stream<coef_pair_t>& y_strm,
+    uint8 t_bytes[KYBER_POLYVECBYTES]
+) {
+    #pragma HLS INLINE off
+    Encode_T_Loop: for(int n=0; n<KYBER_K*KYBER_N/2; n++) {
+        #pragma HLS PIPELINE II=1
+        coef_pair_t w = y_strm.read();
+        uint16_t t0 = pair_lo(w);
+        uint16_t t1 = pair_hi(w);
+        t_bytes[3*n+0] = (uint8)(t0 & 0xFF);
+        t_bytes[3*n+1] = (uint8)((t0 >> 8) | ((t1 & 0x0F) << 4));
+        t_bytes[3*n+2] = (uint8)(t1 >> 4);
+    }
+}
+
+void matvec_keygen(
+    uint8 rho[32],
+    int16 s_hat[KYBER_K][KYBER_N],
+    int16 e_hat[KYBER_K][KYBER_N],
+    uint8 t_bytes[KYBER_POLYVECBYTES]
+) {
+    #pragma HLS INLINE off
+    #pragma HLS DATAFLOW
+
+    hls::stream<ap_uint<64> > rho_strm[KYBER_K];
+    #pragma HLS STREAM variable=rho_strm depth=4
+    hls::stream<coef_pair_t> v_strm[KYBER_K];
+    #pragma HLS STREAM variable=v_strm depth=2
+    hls::stream<coef_pair_t> a_strm[KYBER_K];
+    #pragma HLS STREAM variable=a_strm depth=KYBER_N/2
+    hls::stream<coef_pair_t> init_strm;
+    #pragma HLS STREAM variable=init_strm depth=2
+    hls::stream<coef_pair_t> y_strm;
+    #pragma HLS STREAM variable=y_strm depth=2
+
+    matvec_split_rho(rho, rho_strm);
+    Sample_Cols: for(int j=0; j<KYBER_K; j++) {
+        #pragma HLS UNROLL
+        gen_matrix_col(rho_strm[j], j, a_strm[j]);
+    }
+    matvec_feed_vec(s_hat, v_strm);
+    matvec_feed_init(e_hat, init_strm);
+    matvec_ntt<KYBER_K>(v_strm, a_strm, init_strm, y_strm);
+    matvec_encode_t(y_strm, t_bytes);
+}
@@ -0,0 +1,151 @@
+#ifndef ML_KEM_NATIVE_AP_INT_H
+#define ML_KEM_NATIVE_AP_INT_H
+
+// =========================================================
+// ap_int / ap_uint CHO BUILD NATIVE (-DML_KEM_NATIVE -Inative)
+// =========================================================
+// Thay header ap_int.h của Vitis khi build src/ thành thư viện host (xem
+// native/Makefile). Chỉ đủ cho các idiom kernel đang dùng:
+//   - W <= 64 : lưu trong int8_t .. uint64_t, mọi phép toán đi qua implicit
+//               conversion sang unsigned long long / long long nên compiler
+//               sinh đúng lệnh native; chỉ mask lại khi gán (wrap theo W).
+//   - W <= 128: unsigned __int128 (beat_t, IV GCM, acc của compress 88 bit).
+//   - range(hi, lo) chỉ đọc (kernel không ghi qua range()).
+// Không có arbitrary precision > 128 bit, không có ap_fixed.
+
+#ifndef ML_KEM_NATIVE
+#error "native/ap_int.h chỉ dùng cho build native (-DML_KEM_NATIVE)"
+#endif
+
+#include <stdint.h>
+
+namespace ml_kem_native {
+template <int W, bool S> struct store;
+template <> struct store<8, false>  { typedef uint8_t  type; };
+template <> struct store<16, false> { typedef uint16_t type; };
+template <> struct store<32, false> { typedef uint32_t type; };
+template <> struct store<64, false> { typedef uint64_t type; };
+template <> struct store<8, true>   { typedef int8_t   type; };
+template <> struct store<16, true>  { typedef int16_t  type; };
+template <> struct store<32, true>  { typedef int32_t  type; };
+template <> struct store<64, true>  { typedef int64_t  type; };
+
+// Kiểu native nhỏ nhất chứa W bit
+template <int W, bool S>
+struct storage {
+    static_assert(W >= 1 && W <= 64, "ap_int native: W phải trong [1, 64]");
+    typedef typename store<(W <= 8 ? 8 : W <= 16 ? 16 : W <= 32 ? 32 : 64), S>::type type;
+};
+}
+
+template <int W, bool WIDE = (W > 64)> struct ap_uint;
+
+// ---------------------------------------------------------
+// ap_uint<W>, W <= 64
+// ---------------------------------------------------------
+template <int W>
+struct ap_uint<W, false> {
+    typedef typename ml_kem_native::storage<W, false>::type native_t;
+    native_t v;
+
+    static uint64_t mask(uint64_t x) { return W >= 64 ? x : (x & ((1ULL << (W & 63)) - 1)); }
+
+    ap_uint() : v(0) {}
+    ap_uint(uint64_t x) : v((native_t)mask(x)) {}
+    template <typename T> ap_uint(T x) : v((native_t)mask((uint64_t)(unsigned long long)(long long)x)) {}
+
+    operator unsigned long long() const { return v; }
+
+    ap_uint range(int hi, int lo) const {
+        int w = hi - lo + 1;
+        return ap_uint(((uint64_t)v >> lo) & (w >= 64 ? ~0ULL : ((1ULL << w) - 1)));
+    }
+    bool operator[](int i) const { return (v >> i) & 1; }
+    ap_uint operator~() const { return ap_uint(~(uint64_t)v); }
+
+#define AP_OPEQ(op) \
+    template <typename T> ap_uint& operator op##=(T x) { v = (native_t)mask((uint64_t)v op (unsigned long long)x); return *this; }
+    AP_OPEQ(+) AP_OPEQ(-) AP_OPEQ(*) AP_OPEQ(/) AP_OPEQ(%) AP_OPEQ(^) AP_OPEQ(|) AP_OPEQ(&) AP_OPEQ(<<) AP_OPEQ(>>)
+#undef AP_OPEQ
+    ap_uint& operator++() { v = (native_t)mask((uint64_t)v + 1); return *this; }
+    ap_uint operator++(int) { ap_uint t = *this; ++*this; return t; }
+    ap_uint& operator--() { v = (native_t)mask((uint64_t)v - 1); return *this; }
+    ap_uint operator--(int) { ap_uint t = *this; --*this; return t; }
+};
+
+// ---------------------------------------------------------
+// ap_int<W>, W <= 64 (sign-extend từ bit W-1 khi gán)
+// ---------------------------------------------------------
+template <int W>
+struct ap_int {
+    typedef typename ml_kem_native::storage<W, true>::type native_t;
+    native_t v;
+
+    static int64_t sx(uint64_t x) {
+        if (W >= 64) return (int64_t)x;
+        const uint64_t m = (1ULL << (W & 63)) - 1;
+        x &= m;
+        if ((x >> (W - 1)) & 1) x |= ~m;
+        return (int64_t)x;
+    }
+
+    ap_int() : v(0) {}
+    template <typename T> ap_int(T x) : v((native_t)sx((uint64_t)(long long)x)) {}
+
+    operator long long() const { return v; }
+
+    ap_uint<W> range(int hi, int lo) const { return ap_uint<W>((uint64_t)v).range(hi, lo); }
+    ap_int operator~() const { return ap_int(~(long long)v); }
+
+#define AP_OPEQ(op) \
+    template <typename T> ap_int& operator op##=(T x) { v = (native_t)sx((uint64_t)((long long)v op (long long)x)); return *this; }
+    AP_OPEQ(+) AP_OPEQ(-) AP_OPEQ(*) AP_OPEQ(/) AP_OPEQ(%) AP_OPEQ(^) AP_OPEQ(|) AP_OPEQ(&) AP_OPEQ(<<) AP_OPEQ(>>)
+#undef AP_OPEQ
+    ap_int& operator++() { v = (native_t)sx((uint64_t)v + 1); return *this; }
+    ap_int operator++(int) { ap_int t = *this; ++*this; return t; }
+    ap_int& operator--() { v = (native_t)sx((uint64_t)v - 1); return *this; }
+    ap_int operator--(int) { ap_int t = *this; --*this; return t; }
+};
+
+// ---------------------------------------------------------
+// ap_uint<W>, 64 < W <= 128: chỉ phép bit / shift / so sánh
+// ---------------------------------------------------------
+template <int W>
+struct ap_uint<W, true> {
+    static_assert(W <= 128, "ap_uint native: W tối đa 128");
+    typedef unsigned __int128 u128;
+    u128 v;
+
+    static u128 mask(u128 x) { return W >= 128 ? x : (x & (((u128)1 << (W & 127)) - 1)); }
+
+    ap_uint() : v(0) {}
+    ap_uint(unsigned long long x) : v(x) {}
+    ap_uint(u128 x) : v(mask(x)) {}
+    template <typename T> ap_uint(T x) : v(mask((u128)(unsigned long long)(long long)x)) {}
+    template <int W2> ap_uint(const ap_uint<W2, true>& o) : v(mask(o.v)) {}
+
+    // Cắt về 64 bit thấp như (uint64_t) của ap_uint
+    operator unsigned long long() const { return (unsigned long long)v; }
+
+    ap_uint range(int hi, int lo) const {
+        int w = hi - lo + 1;
+        return ap_uint((v >> lo) & (w >= 128 ? ~(u128)0 : (((u128)1 << w) - 1)));
+    }
+    bool operator[](int i) const { return (v >> i) & 1; }
+    ap_uint operator~() const { return ap_uint(~v); }
+
+    ap_uint operator<<(int s) const { return ap_uint(v << s); }
+    ap_uint operator>>(int s) const { return ap_uint(v >> s); }
+    ap_uint operator|(const ap_uint& o) const { return ap_uint(v | o.v); }
+    ap_uint operator&(const ap_uint& o) const { return ap_uint(v & o.v); }
+    ap_uint operator^(const ap_uint& o) const { return ap_uint(v ^ o.v); }
+    ap_uint& operator|=(const ap_uint& o) { v |= o.v; return *this; }
+    ap_uint& operator&=(const ap_uint& o) { v &= o.v; return *this; }
+    ap_uint& operator^=(const ap_uint& o) { v ^= o.v; return *this; }
+    ap_uint& operator<<=(int s) { v = mask(v << s); return *this; }
+    ap_uint& operator>>=(int s) { v >>= s; return *this; }
+    bool operator==(const ap_uint& o) const { return v == o.v; }
+    bool operator!=(const ap_uint& o) const { return v != o.v; }
+};
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef ML_KEM_NATIVE_HLS_STREAM_H
+#define ML_KEM_NATIVE_HLS_STREAM_H
+
+// =========================================================
+// hls::stream CHO BUILD NATIVE (-DML_KEM_NATIVE -Inative)
+// =========================================================
+// Host chạy các process DATAFLOW tuần tự (producer chạy hết rồi mới tới
+// consumer) nên FIFO phải không giới hạn như C-sim của Vitis, bỏ qua depth.
+// Vector + chỉ số đầu đọc: không cấp phát lại khi đã đủ lớn, reset khi rỗng.
+
+#ifndef ML_KEM_NATIVE
+#error "native/hls_stream.h chỉ dùng cho build native (-DML_KEM_NATIVE)"
+#endif
+
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+
+namespace hls {
+
+template <typename T>
+class stream {
+    std::vector<T> buf;
+    size_t head;
+    const char* name;
+
+public:
+    stream() : head(0), name("") {}
+    explicit stream(const char* n) : head(0), name(n) {}
+
+    T read() {
+        if (head == buf.size()) {
+            // Giống C-sim: đọc stream rỗng là lỗi thiết kế (deadlock trên HW)
+            std::fprintf(stderr, "hls::stream %s: read while empty\n", name);
+            std::abort();
+        }
+        T x = buf[head++];
+        if (head == buf.size()) {
+            buf.clear();
+            head = 0;
+        }
+        return x;
+    }
+    void read(T& x) { x = read(); }
+    bool read_nb(T& x) {
+        if (empty()) return false;
+        x = read();
+        return true;
+    }
+    void write(const T& x) { buf.push_back(x); }
+    bool write_nb(const T& x) { write(x); return true; }
+
+    bool empty() const { return head == buf.size(); }
+    bool full() const { return false; }
+    size_t size() const { return buf.size() - head; }
+
+    void operator>>(T& x) { x = read(); }
+    void operator<<(const T& x) { write(x); }
+};
+
+}
+
+#endif
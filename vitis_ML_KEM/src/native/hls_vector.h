@@ -0,0 +1,33 @@
+#ifndef ML_KEM_NATIVE_HLS_VECTOR_H
+#define ML_KEM_NATIVE_HLS_VECTOR_H
+
+// hls::vector cho build native: mảng cố định + cộng / trừ theo lane (poly_ops.h)
+
+#ifndef ML_KEM_NATIVE
+#error "native/hls_vector.h chỉ dùng cho build native (-DML_KEM_NATIVE)"
+#endif
+
+#include <cstddef>
+
+namespace hls {
+
+template <typename T, size_t N>
+class vector {
+    T d[N];
+
+public:
+    vector() : d() {}
+    vector(const T& x) { for (size_t i = 0; i < N; i++) d[i] = x; }
+
+    T& operator[](size_t i) { return d[i]; }
+    const T& operator[](size_t i) const { return d[i]; }
+
+    vector& operator+=(const vector& o) { for (size_t i = 0; i < N; i++) d[i] += o.d[i]; return *this; }
+    vector& operator-=(const vector& o) { for (size_t i = 0; i < N; i++) d[i] -= o.d[i]; return *this; }
+    friend vector operator+(vector a, const vector& b) { a += b; return a; }
+    friend vector operator-(vector a, const vector& b) { a -= b; return a; }
+};
+
+}
+
+#endif
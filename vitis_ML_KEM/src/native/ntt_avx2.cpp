@@ -0,0 +1,414 @@
+#include "params.h"
+#include <immintrin.h>
+
+#ifndef ML_KEM_NATIVE_AVX2
+#error "ntt_avx2.cpp chỉ build với -DML_KEM_NATIVE_AVX2 (native/Makefile, AVX2=1)"
+#endif
+
+// --- EXTERN DECLARATIONS ---
+extern const int16 ZETAS[128];
+extern const int16 GAMMAS[128];
+extern const int16 F_INV_128;
+extern void ntt_scalar(int16 poly[256]);
+extern void inv_ntt_scalar(int16 poly[256]);
+extern void inv_ntt_layers_scalar(int16 poly[256]);
+extern void poly_pointwise_scalar(int16 a[256], int16 b[256], int16 r[256]);
+extern void poly_basemul_acc_scalar(int16 acc[256], int16 a[KYBER_K][256], int16 b[KYBER_K][256]);
+
+// =========================================================
+// NTT / INV_NTT / BASEMUL AVX2 CHO BUILD NATIVE
+// =========================================================
+// Cùng chữ ký và cùng kết quả (hệ số chuẩn [0, Q)) với bản scalar trong
+// ntt.cpp, 16 hệ số int16 / thanh ghi ymm:
+//   - nhân Montgomery 16 lane (R = 2^16): mulhi(a, zR) - mulhi(mullo(a, zR*QINV), Q),
+//     zeta lưu sẵn dạng Montgomery -> |kết quả| < Q, không cần chia
+//   - Barrett 2^26/Q ở đầu vào / đầu ra, cộng trừ lazy ở giữa (|x| <= 8Q < 2^15)
+//   - layer len 128..16: cả đa thức nằm trong 16 thanh ghi, zeta broadcast;
+//     layer len 8 / 4 / 2: gộp theo cặp thanh ghi, xếp lại lane bằng
+//     permute2x128 / unpack epi64 / shuffle epi32 ngay trong thanh ghi
+//   - basemul: giữ nguyên thứ tự cặp (2i, 2i+1), đổi chỗ 2 lane int16 trong
+//     mỗi dword thay vì tách chẵn / lẻ, gamma lấy từ bảng GAMMAS
+// Chọn lúc build (-mavx2 / -march có AVX2) hoặc runtime theo CPUID.
+
+#define AVX2_FN __attribute__((target("avx2")))
+
+#define MONT_QINV (-3327) // Q^-1 mod 2^16
+
+// c * 2^16 mod Q, về (-Q/2, Q/2]
+static int16_t mont_form(int c) {
+    int r = (int)(((long long)c * 65536) % KYBER_Q);
+    if (r < 0) r += KYBER_Q;
+    if (r > KYBER_Q / 2) r -= KYBER_Q;
+    return (int16_t)r;
+}
+
+// Hằng Montgomery: zh = c*R mod Q, zl = zh * QINV mod 2^16
+struct MontConst {
+    int16_t zh, zl;
+};
+
+static MontConst mont_const(int c) {
+    MontConst m;
+    m.zh = mont_form(c);
+    m.zl = (int16_t)(m.zh * MONT_QINV);
+    return m;
+}
+
+// =========================================================
+// PHẦN 1: SỐ HỌC 16 LANE
+// =========================================================
+AVX2_FN static inline __m256i v_q() { return _mm256_set1_epi16(KYBER_Q); }
+
+// a * z (z ở dạng Montgomery), |kết quả| < Q với |a| < 2^15
+AVX2_FN static inline __m256i fqmul(__m256i a, __m256i zh, __m256i zl) {
+    __m256i lo = _mm256_mullo_epi16(a, zl);
+    __m256i hi = _mm256_mulhi_epi16(a, zh);
+    lo = _mm256_mulhi_epi16(lo, v_q());
+    return _mm256_sub_epi16(hi, lo);
+}
+
+// a * b * R^-1, cả 2 đều biến (|a * b| < Q * 2^15)
+AVX2_FN static inline __m256i fqmul_vv(__m256i a, __m256i b) {
+    __m256i lo = _mm256_mullo_epi16(_mm256_mullo_epi16(a, b), _mm256_set1_epi16(MONT_QINV));
+    __m256i hi = _mm256_mulhi_epi16(a, b);
+    lo = _mm256_mulhi_epi16(lo, v_q());
+    return _mm256_sub_epi16(hi, lo);
+}
+
+// int16 bất kỳ -> [0, Q] (t = floor(x * 20159 / 2^26))
+AVX2_FN static inline __m256i barrett(__m256i a) {
+    __m256i t = _mm256_mulhi_epi16(a, _mm256_set1_epi16(20159));
+    t = _mm256_srai_epi16(t, 10);
+    return _mm256_sub_epi16(a, _mm256_mullo_epi16(t, v_q()));
+}
+
+// int16 bất kỳ -> [0, Q)
+AVX2_FN static inline __m256i canonical(__m256i a) {
+    a = _mm256_sub_epi16(barrett(a), v_q());
+    return _mm256_add_epi16(a, _mm256_and_si256(v_q(), _mm256_srai_epi16(a, 15)));
+}
+
+// Cooley-Tukey: a' = a + z*b, b' = a - z*b
+AVX2_FN static inline void ct_bf(__m256i& a, __m256i& b, __m256i zh, __m256i zl) {
+    __m256i t = fqmul(b, zh, zl);
+    b = _mm256_sub_epi16(a, t);
+    a = _mm256_add_epi16(a, t);
+}
+
+// Gentleman-Sande: a' = a + b, b' = z*(a - b)
+AVX2_FN static inline void gs_bf(__m256i& a, __m256i& b, __m256i zh, __m256i zl) {
+    __m256i d = _mm256_sub_epi16(a, b);
+    a = _mm256_add_epi16(a, b);
+    b = fqmul(d, zh, zl);
+}
+
+// =========================================================
+// PHẦN 2: XẾP LANE CHO LAYER len = 8 / 4 / 2
+// =========================================================
+// (v0, v1) = 32 hệ số liên tiếp -> A chứa mọi phần tử "trên", B mọi phần tử
+// "dưới" của các butterfly cùng layer; unshuffle là phép ngược.
+AVX2_FN static inline void shuf8(__m256i v0, __m256i v1, __m256i& A, __m256i& B) {
+    A = _mm256_permute2x128_si256(v0, v1, 0x20);
+    B = _mm256_permute2x128_si256(v0, v1, 0x31);
+}
+AVX2_FN static inline void unshuf8(__m256i A, __m256i B, __m256i& v0, __m256i& v1) {
+    v0 = _mm256_permute2x128_si256(A, B, 0x20);
+    v1 = _mm256_permute2x128_si256(A, B, 0x31);
+}
+AVX2_FN static inline void shuf4(__m256i v0, __m256i v1, __m256i& A, __m256i& B) {
+    A = _mm256_unpacklo_epi64(v0, v1);
+    B = _mm256_unpackhi_epi64(v0, v1);
+}
+AVX2_FN static inline void unshuf4(__m256i A, __m256i B, __m256i& v0, __m256i& v1) {
+    v0 = _mm256_unpacklo_epi64(A, B);
+    v1 = _mm256_unpackhi_epi64(A, B);
+}
+AVX2_FN static inline void shuf2(__m256i v0, __m256i v1, __m256i& A, __m256i& B) {
+    __m256i t0 = _mm256_shuffle_epi32(v0, 0xD8);
+    __m256i t1 = _mm256_shuffle_epi32(v1, 0xD8);
+    A = _mm256_unpacklo_epi64(t0, t1);
+    B = _mm256_unpackhi_epi64(t0, t1);
+}
+AVX2_FN static inline void unshuf2(__m256i A, __m256i B, __m256i& v0, __m256i& v1) {
+    v0 = _mm256_unpacklo_epi32(A, B);
+    v1 = _mm256_unpackhi_epi32(A, B);
+}
+
+// =========================================================
+// PHẦN 3: BẢNG ZETA / GAMMA DẠNG MONTGOMERY
+// =========================================================
+// Layer nhỏ: zeta theo đúng thứ tự lane của A sau shufX, lấy bằng cách cho
+// chính shufX chạy trên vector chỉ số hệ số.
+struct Avx2Tables {
+    alignas(32) int16_t fwd_h[128], fwd_l[128];  // ZETAS[k]
+    alignas(32) int16_t inv_h[128], inv_l[128];  // Q - ZETAS[k]
+    alignas(32) int16_t fwd_small_h[3][8][16], fwd_small_l[3][8][16]; // [len 8/4/2][cặp]
+    alignas(32) int16_t inv_small_h[3][8][16], inv_small_l[3][8][16];
+    alignas(32) int16_t gamma_h[256], gamma_l[256]; // lane lẻ 2i+1: GAMMAS[i]
+    MontConst r2, f_inv;
+};
+
+AVX2_FN static void build_small(Avx2Tables& T, int s, int len) {
+    alignas(32) int16_t idx0[16], idx1[16], lanes[16];
+    for (int p = 0; p < 8; p++) {
+        for (int l = 0; l < 16; l++) {
+            idx0[l] = (int16_t)(32 * p + l);
+            idx1[l] = (int16_t)(32 * p + 16 + l);
+        }
+        __m256i v0 = _mm256_load_si256((const __m256i*)idx0);
+        __m256i v1 = _mm256_load_si256((const __m256i*)idx1);
+        __m256i A, B;
+        if (len == 8) shuf8(v0, v1, A, B);
+        else if (len == 4) shuf4(v0, v1, A, B);
+        else shuf2(v0, v1, A, B);
+        _mm256_store_si256((__m256i*)lanes, A);
+        for (int l = 0; l < 16; l++) {
+            int blk = lanes[l] / (2 * len);
+            // ntt: k = 128/len + blk; inv_ntt: k = 256/len - 1 - blk
+            MontConst f = mont_const((int)ZETAS[128 / len + blk]);
+            MontConst g = mont_const(KYBER_Q - (int)ZETAS[256 / len - 1 - blk]);
+            T.fwd_small_h[s][p][l] = f.zh;
+            T.fwd_small_l[s][p][l] = f.zl;
+            T.inv_small_h[s][p][l] = g.zh;
+            T.inv_small_l[s][p][l] = g.zl;
+        }
+    }
+}
+
+AVX2_FN static Avx2Tables* build_tables() {
+    static Avx2Tables T;
+    for (int k = 0; k < 128; k++) {
+        MontConst f = mont_const((int)ZETAS[k]);
+        MontConst g = mont_const(KYBER_Q - (int)ZETAS[k]);
+        T.fwd_h[k] = f.zh;
+        T.fwd_l[k] = f.zl;
+        T.inv_h[k] = g.zh;
+        T.inv_l[k] = g.zl;
+        // basemul: mont(P, gamma*R) = a1*b1*gamma*R^-1
+        MontConst c = mont_const((int)GAMMAS[k]);
+        T.gamma_h[2 * k] = 0;
+        T.gamma_l[2 * k] = 0;
+        T.gamma_h[2 * k + 1] = c.zh;
+        T.gamma_l[2 * k + 1] = c.zl;
+    }
+    build_small(T, 0, 8);
+    build_small(T, 1, 4);
+    build_small(T, 2, 2);
+    T.r2 = mont_const(65536 % KYBER_Q); // x * R^2 * R^-1: bỏ hệ số R^-1 của basemul
+    T.f_inv = mont_const((int)F_INV_128);
+    return &T;
+}
+
+AVX2_FN static const Avx2Tables& tables() {
+    static const Avx2Tables* T = build_tables();
+    return *T;
+}
+
+AVX2_FN static inline __m256i ld(const int16_t* p) { return _mm256_load_si256((const __m256i*)p); }
+
+// Build native: int16 = int16_t (params.h) -> load / store thẳng
+static_assert(sizeof(int16) == 2, "ntt_avx2.cpp cần int16 = int16_t (-DML_KEM_NATIVE)");
+
+AVX2_FN static inline void load_poly(const int16 poly[256], __m256i r[16]) {
+    for (int i = 0; i < 16; i++) r[i] = _mm256_loadu_si256((const __m256i*)(poly + 16 * i));
+}
+
+AVX2_FN static inline void store_poly(int16 poly[256], const __m256i r[16]) {
+    for (int i = 0; i < 16; i++) _mm256_storeu_si256((__m256i*)(poly + 16 * i), r[i]);
+}
+
+// =========================================================
+// PHẦN 4: NTT / INV_NTT
+// =========================================================
+// |hệ số| sau layer L <= (L + 1) * Q -> 7 layer <= 8Q, không cần reduce giữa chừng
+AVX2_FN static void ntt_avx2(int16 poly[256]) {
+    const Avx2Tables& T = tables();
+    __m256i r[16];
+    load_poly(poly, r);
+    for (int i = 0; i < 16; i++) r[i] = barrett(r[i]);
+
+    // len 128 .. 16: butterfly giữa thanh ghi i và i + len/16
+    int k = 1;
+    for (int d = 8; d >= 1; d >>= 1) {
+        for (int start = 0; start < 16; start += 2 * d) {
+            __m256i zh = _mm256_set1_epi16(T.fwd_h[k]);
+            __m256i zl = _mm256_set1_epi16(T.fwd_l[k]);
+            k++;
+            for (int i = start; i < start + d; i++) ct_bf(r[i], r[i + d], zh, zl);
+        }
+    }
+
+    // len 8 / 4 / 2 gộp trên từng cặp thanh ghi
+    for (int p = 0; p < 8; p++) {
+        __m256i v0 = r[2 * p], v1 = r[2 * p + 1], A, B;
+        shuf8(v0, v1, A, B);
+        ct_bf(A, B, ld(T.fwd_small_h[0][p]), ld(T.fwd_small_l[0][p]));
+        unshuf8(A, B, v0, v1);
+        shuf4(v0, v1, A, B);
+        ct_bf(A, B, ld(T.fwd_small_h[1][p]), ld(T.fwd_small_l[1][p]));
+        unshuf4(A, B, v0, v1);
+        shuf2(v0, v1, A, B);
+        ct_bf(A, B, ld(T.fwd_small_h[2][p]), ld(T.fwd_small_l[2][p]));
+        unshuf2(A, B, v0, v1);
+        r[2 * p] = canonical(v0);
+        r[2 * p + 1] = canonical(v1);
+    }
+    store_poly(poly, r);
+}
+
+// Nhánh cộng gấp đôi biên mỗi layer: reduce sau len 8 và len 64 (<= 8Q)
+AVX2_FN static void inv_ntt_avx2_core(__m256i r[16]) {
+    const Avx2Tables& T = tables();
+    for (int i = 0; i < 16; i++) r[i] = barrett(r[i]);
+
+    for (int p = 0; p < 8; p++) {
+        __m256i v0 = r[2 * p], v1 = r[2 * p + 1], A, B;
+        shuf2(v0, v1, A, B);
+        gs_bf(A, B, ld(T.inv_small_h[2][p]), ld(T.inv_small_l[2][p]));
+        unshuf2(A, B, v0, v1);
+        shuf4(v0, v1, A, B);
+        gs_bf(A, B, ld(T.inv_small_h[1][p]), ld(T.inv_small_l[1][p]));
+        unshuf4(A, B, v0, v1);
+        shuf8(v0, v1, A, B);
+        gs_bf(A, B, ld(T.inv_small_h[0][p]), ld(T.inv_small_l[0][p]));
+        unshuf8(A, B, v0, v1);
+        r[2 * p] = barrett(v0);
+        r[2 * p + 1] = barrett(v1);
+    }
+
+    // len 16 .. 128, k giảm dần như inv_ntt_core
+    int k = 15;
+    for (int d = 1; d <= 8; d <<= 1) {
+        for (int start = 0; start < 16; start += 2 * d) {
+            __m256i zh = _mm256_set1_epi16(T.inv_h[k]);
+            __m256i zl = _mm256_set1_epi16(T.inv_l[k]);
+            k--;
+            for (int i = start; i < start + d; i++) gs_bf(r[i], r[i + d], zh, zl);
+        }
+        if (d == 4)
+            for (int i = 0; i < 16; i++) r[i] = barrett(r[i]);
+    }
+}
+
+AVX2_FN static void inv_ntt_layers_avx2(int16 poly[256]) {
+    __m256i r[16];
+    load_poly(poly, r);
+    inv_ntt_avx2_core(r);
+    for (int i = 0; i < 16; i++) r[i] = canonical(r[i]);
+    store_poly(poly, r);
+}
+
+AVX2_FN static void inv_ntt_avx2(int16 poly[256]) {
+    const Avx2Tables& T = tables();
+    __m256i r[16];
+    load_poly(poly, r);
+    inv_ntt_avx2_core(r);
+    __m256i fh = _mm256_set1_epi16(T.f_inv.zh), fl = _mm256_set1_epi16(T.f_inv.zl);
+    for (int i = 0; i < 16; i++) r[i] = canonical(fqmul(r[i], fh, fl));
+    store_poly(poly, r);
+}
+
+// =========================================================
+// PHẦN 5: BASEMUL
+// =========================================================
+// 8 cặp (a0, a1) x (b0, b1) / thanh ghi, kết quả nhân R^-1:
+//   P = a*b        -> [a0b0, a1b1],  Q = a*swap(b) -> [a0b1, a1b0]
+//   X = [P0, Q1],  Y = [Q0, gamma*P1], X + swap(Y) = [c0, c1] * R^-1
+// |X + swap(Y)| < 2Q; cộng dồn K cặp vẫn <= 8Q.
+AVX2_FN static inline __m256i swap16(__m256i x) {
+    return _mm256_or_si256(_mm256_slli_epi32(x, 16), _mm256_srli_epi32(x, 16));
+}
+
+AVX2_FN static inline __m256i basemul_vec(__m256i a, __m256i b, __m256i gh, __m256i gl) {
+    __m256i P = fqmul_vv(a, b);
+    __m256i Q = fqmul_vv(a, swap16(b));
+    __m256i Pg = fqmul(P, gh, gl);
+    __m256i X = _mm256_blend_epi16(P, Q, 0xAA);
+    __m256i Y = _mm256_blend_epi16(Q, Pg, 0xAA);
+    return _mm256_add_epi16(X, swap16(Y));
+}
+
+AVX2_FN static void poly_pointwise_avx2(int16 a[256], int16 b[256], int16 r[256]) {
+    const Avx2Tables& T = tables();
+    __m256i va[16], vb[16], vr[16];
+    load_poly(a, va);
+    load_poly(b, vb);
+    __m256i rh = _mm256_set1_epi16(T.r2.zh), rl = _mm256_set1_epi16(T.r2.zl);
+    for (int i = 0; i < 16; i++) {
+        __m256i c = basemul_vec(barrett(va[i]), barrett(vb[i]), ld(T.gamma_h + 16 * i), ld(T.gamma_l + 16 * i));
+        vr[i] = canonical(fqmul(c, rh, rl));
+    }
+    store_poly(r, vr);
+}
+
+AVX2_FN static void poly_basemul_acc_avx2(int16 acc[256], int16 a[KYBER_K][256], int16 b[KYBER_K][256]) {
+    const Avx2Tables& T = tables();
+    __m256i s[16], va[16], vb[16];
+    for (int i = 0; i < 16; i++) s[i] = _mm256_setzero_si256();
+    for (int j = 0; j < KYBER_K; j++) {
+        load_poly(a[j], va);
+        load_poly(b[j], vb);
+        for (int i = 0; i < 16; i++)
+            s[i] = _mm256_add_epi16(s[i], basemul_vec(barrett(va[i]), barrett(vb[i]),
+                                                      ld(T.gamma_h + 16 * i), ld(T.gamma_l + 16 * i)));
+    }
+    __m256i rh = _mm256_set1_epi16(T.r2.zh), rl = _mm256_set1_epi16(T.r2.zl);
+    for (int i = 0; i < 16; i++) s[i] = canonical(fqmul(s[i], rh, rl));
+    store_poly(acc, s);
+}
+
+// =========================================================
+// PHẦN 6: DISPATCH
+// =========================================================
+// Build với AVX2 bật sẵn (-mavx2, -march=native trên máy có AVX2): gọi thẳng.
+// Ngược lại kiểm tra CPUID 1 lần, máy không có AVX2 chạy bản scalar.
+// perf[] không phụ thuộc bản nào được chọn: primitive không PERF_TICK, top
+// cộng PERF_ITERS_* tại call site (params.h).
+static bool use_avx2() {
+#ifdef __AVX2__
+    return true;
+#else
+    static const bool ok = __builtin_cpu_supports("avx2");
+    return ok;
+#endif
+}
+
+void ntt(int16 poly[256]) {
+    if (use_avx2()) {
+        ntt_avx2(poly);
+    } else {
+        ntt_scalar(poly);
+    }
+}
+
+void inv_ntt(int16 poly[256]) {
+    if (use_avx2()) {
+        inv_ntt_avx2(poly);
+    } else {
+        inv_ntt_scalar(poly);
+    }
+}
+
+void inv_ntt_layers(int16 poly[256]) {
+    if (use_avx2()) {
+        inv_ntt_layers_avx2(poly);
+    } else {
+        inv_ntt_layers_scalar(poly);
+    }
+}
+
+void poly_pointwise(int16 a[256], int16 b[256], int16 r[256]) {
+    if (use_avx2()) {
+        poly_pointwise_avx2(a, b, r);
+    } else {
+        poly_pointwise_scalar(a, b, r);
+    }
+}
+
+void poly_basemul_acc(int16 acc[256], int16 a[KYBER_K][256], int16 b[KYBER_K][256]) {
+    if (use_avx2()) {
+        poly_basemul_acc_avx2(acc, a, b);
+    } else {
+        poly_basemul_acc_scalar(acc, a, b);
+    }
+}
@@ -0,0 +1,121 @@
+#include <iostream>
+#include <chrono>
+#include "params.h"
+
+// --- DUT: dispatcher (ntt_avx2.cpp) và bản scalar gốc (ntt.cpp) ---
+extern void ntt(int16 poly[256]);
+extern void inv_ntt(int16 poly[256]);
+extern void inv_ntt_layers(int16 poly[256]);
+extern void poly_pointwise(int16 a[256], int16 b[256], int16 r[256]);
+extern void poly_basemul_acc(int16 acc[256], int16 a[KYBER_K][256], int16 b[KYBER_K][256]);
+extern void ntt_scalar(int16 poly[256]);
+extern void inv_ntt_scalar(int16 poly[256]);
+extern void inv_ntt_layers_scalar(int16 poly[256]);
+extern void poly_pointwise_scalar(int16 a[256], int16 b[256], int16 r[256]);
+extern void poly_basemul_acc_scalar(int16 acc[256], int16 a[KYBER_K][256], int16 b[KYBER_K][256]);
+
+#define NUM_TESTS 1000
+#define BENCH_ITERS 20000
+
+static unsigned int rng_state = 2026;
+static unsigned int rnd() {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return rng_state >> 8;
+}
+
+// [0, Q), hoặc (-Q, Q) như đầu ra CBD / hệ số chưa chuẩn hoá
+static void rnd_poly(int16 p[256], bool signed_in) {
+    for (int i = 0; i < 256; i++) {
+        int v = (int)(rnd() % KYBER_Q);
+        if (signed_in && (rnd() & 1)) v = -v;
+        p[i] = (int16)v;
+    }
+}
+
+static int check(const int16 got[256], const int16 exp[256], const char* name, int t) {
+    for (int i = 0; i < 256; i++) {
+        if (got[i] != exp[i]) {
+            std::cout << "ERROR [" << name << "] test " << t << " index " << i
+                      << " got " << got[i] << " expected " << exp[i] << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void copy_poly(int16 dst[256], const int16 src[256]) {
+    for (int i = 0; i < 256; i++) dst[i] = src[i];
+}
+
+// ns / lần gọi
+template <typename F>
+static double bench(F f) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int it = 0; it < BENCH_ITERS; it++) f();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / BENCH_ITERS;
+}
+
+int main() {
+    std::cout << "--- STARTING NTT AVX2 vs SCALAR TEST ---" << std::endl;
+    int fails = 0;
+    static int16 a[KYBER_K][256], b[KYBER_K][256];
+    int16 x[256], y[256], r0[256], r1[256];
+
+    // 1. Từng hàm: AVX2 == scalar, bit-exact
+    for (int t = 0; t < NUM_TESTS && fails < 5; t++) {
+        rnd_poly(x, true);
+        copy_poly(y, x);
+        ntt(x);
+        ntt_scalar(y);
+        fails += check(x, y, "ntt", t);
+
+        rnd_poly(x, false);
+        copy_poly(y, x);
+        inv_ntt(x);
+        inv_ntt_scalar(y);
+        fails += check(x, y, "inv_ntt", t);
+
+        rnd_poly(x, false);
+        copy_poly(y, x);
+        inv_ntt_layers(x);
+        inv_ntt_layers_scalar(y);
+        fails += check(x, y, "inv_ntt_layers", t);
+
+        for (int j = 0; j < KYBER_K; j++) {
+            rnd_poly(a[j], false);
+            rnd_poly(b[j], false);
+        }
+        poly_pointwise(a[0], b[0], r0);
+        poly_pointwise_scalar(a[0], b[0], r1);
+        fails += check(r0, r1, "poly_pointwise", t);
+
+        poly_basemul_acc(r0, a, b);
+        poly_basemul_acc_scalar(r1, a, b);
+        fails += check(r0, r1, "poly_basemul_acc", t);
+    }
+
+    // 2. inv_ntt(ntt(x)) = x
+    for (int t = 0; t < NUM_TESTS && fails < 5; t++) {
+        rnd_poly(x, false);
+        copy_poly(y, x);
+        ntt(x);
+        inv_ntt(x);
+        fails += check(x, y, "round trip", t);
+    }
+    std::cout << (fails == 0 ? "[PASS] " : "[FAIL] ") << NUM_TESTS << " random cases" << std::endl;
+
+    // 3. Thời gian (chỉ in, không phải tiêu chí pass)
+    rnd_poly(x, false);
+    std::cout << "ntt             : scalar " << bench([&] { ntt_scalar(x); }) << " ns, avx2 "
+              << bench([&] { ntt(x); }) << " ns" << std::endl;
+    std::cout << "inv_ntt         : scalar " << bench([&] { inv_ntt_scalar(x); }) << " ns, avx2 "
+              << bench([&] { inv_ntt(x); }) << " ns" << std::endl;
+    std::cout << "poly_basemul_acc: scalar " << bench([&] { poly_basemul_acc_scalar(r0, a, b); }) << " ns, avx2 "
+              << bench([&] { poly_basemul_acc(r0, a, b); }) << " ns" << std::endl;
+
+    std::cout << "---------------------------------" << std::endl;
+    if (fails == 0) std::cout << "ALL NTT AVX2 TESTS PASSED!" << std::endl;
+    else std::cout << "NTT AVX2 TESTS FAILED: " << fails << " errors." << std::endl;
+    return fails;
+}
@@ -1,10 +1,25 @@
 #include "params.h"
+#include "poly_ops.h"
 #include "ap_int.h" // Cần thư viện này cho ap_int/ap_uint
 
+// Build native có AVX2 (native/Makefile, AVX2=1): bản scalar bên dưới đổi tên
+// thành *_scalar, ntt / inv_ntt / ... là dispatcher trong native/ntt_avx2.cpp.
+// HLS và build native không AVX2: NTT_SCALAR(f) = f, không đổi gì.
+#ifdef ML_KEM_NATIVE_AVX2
+#define NTT_SCALAR(f) f##_scalar
+void ntt(int16 poly[256]);
+void inv_ntt(int16 poly[256]);
+#else
+#define NTT_SCALAR(f) f
+#endif
+
 // =========================================================
 // PHẦN 1: BẢNG TRA CỨU (BRAM STRATEGY)
 // =========================================================
 
+// Bản AVX2 của build native (native/ntt_avx2.cpp) dựng bảng Montgomery từ
+// ZETAS / F_INV_128 -> external linkage như GAMMAS
+extern const int16 ZETAS[128];
 const int16 ZETAS[128] = {
     1, 1729, 2580, 3289, 2642, 630, 1897, 848,
     1062, 1919, 193, 797, 2786, 3260, 569, 1746,
@@ -24,6 +39,8 @@ const int16 ZETAS[128] = {
     1722, 1212, 1874, 1029, 2110, 2935, 885, 2154
 };
 
+// matvec.cpp dùng chung bảng gamma cho các PE -> cần external linkage
+extern const int16 GAMMAS[128];
 const int16 GAMMAS[128] = {
     17, -17, 2761, -2761, 583, -583, 2649, -2649,
     1637, -1637, 723, -723, 2288, -2288, 1100, -1100,
@@ -78,8 +95,10 @@ int16 mul_mod(int16 a, int16 b) {
     prod_t res = product - sub_term;
     
     // Xử lý modulo cuối
+    // 20159 > 2^26/3329 nên t có thể dư 1 -> res thuộc (-q, 2q), đưa về [0, q)
     int16 res_final = (int16)res;
     if (res_final >= 3329) res_final -= 3329;
+    if (res_final < 0) res_final += 3329;
     
     return res_final;
 }
@@ -87,10 +106,10 @@ int16 mul_mod(int16 a, int16 b) {
 // =========================================================
 // PHẦN 3: NTT CORE (FACTOR 2 COMPATIBLE)
 // =========================================================
-void ntt(int16 poly[256]) {
+void NTT_SCALAR(ntt)(int16 poly[256]) {
     #pragma HLS INLINE off
-    // Giữ factor=2 theo yêu cầu hệ thống
-    #pragma HLS ARRAY_PARTITION variable=poly cyclic factor=2 
+    // HW_POLY_PART >= 2 * HW_NTT_BUTTERFLIES (hw_config.h)
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=poly cyclic factor=HW_POLY_PART)
     // Ép bảng hằng số vào BRAM để tiết kiệm LUT
     // #pragma HLS BIND_STORAGE variable=ZETAS type=rom_1p impl=bram
 
@@ -103,14 +122,19 @@ void ntt(int16 poly[256]) {
             int16 zeta = ZETAS[k++];
             
             for (int j = start; j < start + len; j++) {
-                #pragma HLS PIPELINE II=2
+                DO_PRAGMA(HLS PIPELINE II=HW_NTT_II)
+                DO_PRAGMA(HLS UNROLL factor=HW_NTT_BUTTERFLIES)
                 
                 // Pipeline II=1 với factor=2 là khả thi vì mỗi chu kỳ đọc 2 số (poly[j], poly[j+len])
                 int16 t = mul_mod(zeta, poly[j + len]);
+                // Input từ CBD có hệ số âm (-eta..eta): ở layer đầu poly[j] - t có thể
+                // < -Q và poly[j] + t có thể < 0 -> chuẩn hoá thêm 1 lần để ra [0, Q)
                 int16 r2 = poly[j] - t;
                 if (r2 < 0) r2 += KYBER_Q;
+                if (r2 < 0) r2 += KYBER_Q;
                 int16 r1 = poly[j] + t;
                 if (r1 >= KYBER_Q) r1 -= KYBER_Q;
+                if (r1 < 0) r1 += KYBER_Q;
                 
                 poly[j + len] = r2;
                 poly[j]       = r1;
@@ -122,6 +146,7 @@ void ntt(int16 poly[256]) {
 // =========================================================
 // PHẦN 4: POINTWISE & INV_NTT
 // =========================================================
+extern const int16 F_INV_128;
 const int16 F_INV_128 = 3303; 
 
 void basemul(int16 a0, int16 a1, int16 b0, int16 b1, int16 gamma, int16* c0_out, int16* c1_out) {
@@ -141,7 +166,7 @@ void basemul(int16 a0, int16 a1, int16 b0, int16 b1, int16 gamma, int16* c0_out,
     *c1_out = sum1;
 }
 
-void poly_pointwise(int16 a[256], int16 b[256], int16 r[256]) {
+void NTT_SCALAR(poly_pointwise)(int16 a[256], int16 b[256], int16 r[256]) {
     #pragma HLS INLINE off
     // #pragma HLS BIND_STORAGE variable=GAMMAS type=rom_1p impl=bram
 
@@ -156,11 +181,31 @@ void poly_pointwise(int16 a[256], int16 b[256], int16 r[256]) {
     }
 }
 
-void inv_ntt(int16 poly[256]) {
+// acc = sum_j a[j] o b[j]: K basemul trong cùng 1 pipeline, cộng dồn chưa
+// reduce (K tích [0, Q) < 2^15) và reduce 1 lần ở cuối -> không còn prod[256]
+// trung gian và vòng cộng dồn riêng.
+void NTT_SCALAR(poly_basemul_acc)(int16 acc[256], int16 a[KYBER_K][256], int16 b[KYBER_K][256]) {
     #pragma HLS INLINE off
-    #pragma HLS ARRAY_PARTITION variable=poly cyclic factor=2
-    // #pragma HLS BIND_STORAGE variable=ZETAS type=rom_1p impl=bram
-    
+
+    Basemul_Acc_Loop: for(int i=0; i<128; i++) {
+        #pragma HLS PIPELINE II=1
+
+        poly_wide_t s0 = 0, s1 = 0;
+        for(int j=0; j<KYBER_K; j++) {
+            #pragma HLS UNROLL
+            int16 c0, c1;
+            basemul(a[j][2*i], a[j][2*i+1], b[j][2*i], b[j][2*i+1], GAMMAS[i], &c0, &c1);
+            s0 += c0;
+            s1 += c1;
+        }
+        acc[2*i]   = poly_reduce_wide(s0);
+        acc[2*i+1] = poly_reduce_wide(s1);
+    }
+}
+
+// Các layer butterfly GS của inv_ntt (chưa nhân F^-1 = 128^-1)
+static void inv_ntt_core(int16 poly[256]) {
+    #pragma HLS INLINE
     // Dùng int cho biến vòng lặp
     int k = 127; 
     
@@ -170,7 +215,8 @@ void inv_ntt(int16 poly[256]) {
             int16 zeta_inv = KYBER_Q - zeta; 
 
             for (int j = start; j < start + len; j++) {
-                #pragma HLS PIPELINE II=2
+                DO_PRAGMA(HLS PIPELINE II=HW_NTT_II)
+                DO_PRAGMA(HLS UNROLL factor=HW_NTT_BUTTERFLIES)
                 
                 int16 t = poly[j];
                 int16 r1 = t + poly[j + len];
@@ -184,10 +230,32 @@ void inv_ntt(int16 poly[256]) {
             }
         }
     }
+}
+
+// Lớp cuối của inv_ntt (nhân F^-1) cho 1 hệ số: cho phép caller gộp bước
+// này vào pipeline phía sau (cộng noise, compress, ...) thay vì 1 vòng 256 riêng
+int16 inv_ntt_scale(int16 x) {
+    #pragma HLS INLINE
+    return mul_mod(x, F_INV_128);
+}
+
+// inv_ntt không có lớp nhân F^-1: poly[k] * F^-1 = inv_ntt_scale(poly[k])
+void NTT_SCALAR(inv_ntt_layers)(int16 poly[256]) {
+    #pragma HLS INLINE off
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=poly cyclic factor=HW_POLY_PART)
+    inv_ntt_core(poly);
+}
+
+void NTT_SCALAR(inv_ntt)(int16 poly[256]) {
+    #pragma HLS INLINE off
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=poly cyclic factor=HW_POLY_PART)
+    // #pragma HLS BIND_STORAGE variable=ZETAS type=rom_1p impl=bram
+
+    inv_ntt_core(poly);
     // Vòng lặp cuối cùng
     for (int i = 0; i < 256; i++) {
         #pragma HLS PIPELINE II=1
-        poly[i] = mul_mod(poly[i], F_INV_128);
+        poly[i] = inv_ntt_scale(poly[i]);
     }
 }
 
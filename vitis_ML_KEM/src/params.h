@@ -2,18 +2,212 @@
 #define PARAMS_H
 
 #include "ap_int.h"
+#include "hw_config.h"
+
+// =========================================================
+// PARAMETER SET (FIPS 203, Table 2)
+// =========================================================
+// Chọn lúc compile: -DML_KEM_LEVEL=512 | 768 | 1024 (mặc định 768).
+// Mỗi solution HLS build đúng 1 bộ tham số, mọi kích thước bên dưới là
+// hằng số compile-time nên kernel 512 / 1024 không tốn thêm logic runtime.
+#ifndef ML_KEM_LEVEL
+#define ML_KEM_LEVEL 768
+#endif
+
+#if ML_KEM_LEVEL == 512
+#define KYBER_K    2
+#define KYBER_ETA1 3
+#define KYBER_DU   10
+#define KYBER_DV   4
+#define KYBER_KAT_FILE "KAT_512.txt"
+#elif ML_KEM_LEVEL == 768
+#define KYBER_K    3
+#define KYBER_ETA1 2
+#define KYBER_DU   10
+#define KYBER_DV   4
+#define KYBER_KAT_FILE "KAT_768.txt"
+#elif ML_KEM_LEVEL == 1024
+#define KYBER_K    4
+#define KYBER_ETA1 2
+#define KYBER_DU   11
+#define KYBER_DV   5
+#define KYBER_KAT_FILE "KAT_1024.txt"
+#else
+#error "ML_KEM_LEVEL must be 512, 768 or 1024"
+#endif
 
-#define KYBER_K 3
 #define KYBER_N 256
 #define KYBER_Q 3329
 
 #define KYBER_SYMBYTES 32
-#define KYBER_ETA1 2
 #define KYBER_ETA2 2
 
+// Kích thước dẫn xuất (byte)
+#define KYBER_POLYBYTES      384                              // ByteEncode_12
+#define KYBER_POLYVECBYTES   (KYBER_K * KYBER_POLYBYTES)
+#define KYBER_POLYCOMP_U     (KYBER_DU * KYBER_N / 8)         // 1 đa thức u
+#define KYBER_POLYCOMP_V     (KYBER_DV * KYBER_N / 8)
+#define KYBER_PK_BYTES       (KYBER_POLYVECBYTES + KYBER_SYMBYTES)     // ek
+#define KYBER_SK_BYTES       (2 * KYBER_POLYVECBYTES + 3 * KYBER_SYMBYTES) // dk = s || ek || H(ek) || z
+#define KYBER_CT_BYTES       (KYBER_K * KYBER_POLYCOMP_U + KYBER_POLYCOMP_V)
+
+// Offset trong dk
+#define KYBER_SK_EK_OFF      KYBER_POLYVECBYTES
+#define KYBER_SK_RHO_OFF     (2 * KYBER_POLYVECBYTES)
+#define KYBER_SK_H_OFF       (KYBER_SK_RHO_OFF + KYBER_SYMBYTES)
+#define KYBER_SK_Z_OFF       (KYBER_SK_H_OFF + KYBER_SYMBYTES)
+
 // Typedefs mới (Fix lỗi redefinition)
+// -DML_KEM_NATIVE: build host bằng native/Makefile, hệ số / byte là kiểu
+// native (cùng wrap 16 / 8 bit khi gán), ap_int.h / hls_stream.h lấy từ native/.
+#ifdef ML_KEM_NATIVE
+typedef int16_t int16;
+typedef uint16_t uint16;
+typedef uint8_t uint8;
+#else
 typedef ap_int<16> int16;
 typedef ap_uint<16> uint16;
 typedef ap_uint<8> uint8;
+#endif
+
+// Level chọn bằng macro, không có type tham số: top HLS không là template được
+// và mọi buffer / depth pragma dùng thẳng KYBER_*, nên đổi level là build lại
+// với -DML_KEM_LEVEL khác. static_assert chốt kích thước theo FIPS 203.
+#if ML_KEM_LEVEL == 512
+static_assert(KYBER_PK_BYTES == 800 && KYBER_SK_BYTES == 1632 && KYBER_CT_BYTES == 768, "ML-KEM-512 sizes");
+#elif ML_KEM_LEVEL == 768
+static_assert(KYBER_PK_BYTES == 1184 && KYBER_SK_BYTES == 2400 && KYBER_CT_BYTES == 1088, "ML-KEM-768 sizes");
+#else
+static_assert(KYBER_PK_BYTES == 1568 && KYBER_SK_BYTES == 3168 && KYBER_CT_BYTES == 1568, "ML-KEM-1024 sizes");
+#endif
+
+// On-chip DRBG (drbg.cpp) cho batch keygen/encaps
+#define DRBG_OUT_BYTES 64
+#define DRBG_DOMAIN_KEYGEN 0x01 // out = d || z
+#define DRBG_DOMAIN_ENCAPS 0x02 // out[0..31] = m
+
+// LIVE = 0: thanh ghi mode chưa ghi / bị xoá vẫn sinh d/z/m on-chip, chỉ đúng
+// mã REPLAY mới đọc từ host buffer.
+#define DRBG_MODE_LIVE   0 // d/z/m sinh từ seed của batch
+#define DRBG_MODE_REPLAY 1 // d/z/m lấy từ host buffer (KAT)
+
+// Resident-key kernels (ek / dk giữ on-chip giữa các lần gọi)
+#define KEY_OP_LOAD 0 // nạp key, decode + expand A một lần
+#define KEY_OP_RUN  1 // encaps / decaps trên key đã nạp
+#define KEY_OP_CLEAR 2 // xoá key thường trú (decaps: ghi 0 đè s_hat, z)
+
+// Session kernels (session.cpp): ss của ML-KEM vào thẳng slot key on-chip
+#define SESSION_OP_KEM     0 // encaps (client) / decaps (server), ss -> slot
+#define SESSION_OP_CRYPT   1 // mã hóa frame bằng key của slot
+#define SESSION_OP_CLEAR   2 // xóa key của slot
+#define SESSION_OP_DECRYPT 3 // giải mã frame (AES-CTR: giống CRYPT)
+#define SESSION_OP_RATCHET 4 // key slot <- SHAKE256(key || SESSION_RATCHET_DS), không chạy KEM
+#define SESSION_RATCHET_DS 0xFF // byte thứ 33 của input ratchet (PRF của ML-KEM dùng b < 0x10)
+// Cipher của frame trong session kernel (knob HW_SESSION_CIPHER)
+#define SESSION_CIPHER_AES_CTR 0
+#define SESSION_CIPHER_DUPLEX  1 // keccak_duplex_core, không tốn datapath AES
+
+// ap_return của ml_kem_encaps / ml_kem_decaps và các kernel resident.
+// Các lỗi input FIPS 203 là cờ bit, được OR lại (batch: OR của mọi op).
+#define KEY_STATUS_OK     0
+#define KEY_STATUS_NO_KEY 1 // KEY_OP_RUN khi chưa có key
+#define KEY_STATUS_BAD_EK 2 // ek: có hệ số ByteDecode_12 >= q (modulus check)
+#define KEY_STATUS_BAD_DK 4 // dk: H(ek nhúng trong dk) != hash lưu trong dk (hash check)
+#define KEY_STATUS_BAD_SLOT 8 // session: slot ngoài [0, HW_SESSION_SLOTS)
+
+// m_axi ingest: 1 beat = 128 bit (max_widen_bitwidth=128), byte 0 ở bit [7:0]
+#define AXI_BEAT_BYTES 16
+typedef ap_uint<128> beat_t;
+
+// Matrix-vector engine (matvec.cpp): 1 phần tử stream = 1 cặp basemul
+// (hệ số 2p ở [15:0], 2p+1 ở [31:16])
+typedef ap_uint<32> coef_pair_t;
+
+// AXIS giữa kernel XOF và kernel arith: 1 word = 4 hệ số int16 liên tiếp,
+// hệ số 4q+l ở bit [16l+15:16l]. Mỗi op: A^T (K*K, thứ tự xem xof_engine.cpp),
+// rồi r[0..K-1] (chưa NTT), e1[0..K-1], e2.
+typedef ap_uint<64> xof_link_t;
+#define XOF_LINK_POLY_WORDS  (KYBER_N / 4)
+#define XOF_LINK_NOISE_WORDS ((2 * KYBER_K + 1) * XOF_LINK_POLY_WORDS)
+
+// AES-256-CTR (aes_ctr.cpp): 1 block = 1 beat m_axi, byte 0 ở bit [7:0].
+// Counter block = nonce (8 byte) || counter 64-bit big-endian, giống
+// Counter.new(64, prefix=nonce) của AES_CTR/AES_Lib.py.
+#define AES_ROUNDS      14
+#define AES_BLOCK_BYTES AXI_BEAT_BYTES
+#define AES_FRAME_MAX   (1920 * 1080 * 3) // frame RGB lớn nhất (depth m_axi)
+
+// Keccak duplex cipher (duplex_cipher.cpp): rate = SHAKE128, byte domain ở byte 199
+#define DX_RATE_LANES 21
+#define DX_RATE_BYTES (8 * DX_RATE_LANES)
+#define DX_DS_KEY   0x01
+#define DX_DS_CRYPT 0x02 // block payload, còn block sau
+#define DX_DS_LAST  0x03 // block payload cuối
+#define DX_DS_TAG   0x04
+
+// Per-phase cycle counters (perf[] trên AXI-lite, host chỉ đọc)
+// HW   : PERF_NOW đọc perf_clock_now, counter 64-bit free-running trong kernel
+//        (RTL blackbox perf_clock.v, reset cùng ap_rst nên mọi instance bằng nhau).
+//        Mỗi phase chốt counter ở biên và cộng hiệu số vào perf[phase].
+// C-sim: không có clock -> perf_clock_now trả về perf_sim_ticks, tổng số iteration
+//        PERF_TICK đếm ở các loop của top, tức perf[] = iteration count.
+//        Primitive dùng chung (ntt, keccak, cbd, matvec...) không tự đếm, top
+//        cộng số iteration danh định PERF_ITERS_* của chúng tại call site.
+// Các process trong DATAFLOW chạy chồng nhau nên tổng các phase > PERF_TOTAL.
+typedef ap_uint<64> perf_t;
+
+#define PERF_LOAD     0 // đọc input m_axi + decode
+#define PERF_HASH     1 // H / G / J
+#define PERF_XOF      2 // expand A (SHAKE128 + rejection sampling)
+#define PERF_NOISE    3 // PRF + CBD (+ NTT của noise)
+#define PERF_MATRIX   4 // NTT(u), basemul + accumulate
+#define PERF_INVNTT   5
+#define PERF_COMPRESS 6 // compress / encode (+ cộng e1, e2, m)
+#define PERF_STORE    7 // ghi output m_axi
+#define PERF_COMPARE  8 // decaps: re-encrypt compare + select
+#define PERF_TOTAL    9 // toàn kernel
+#define PERF_SLOTS    10
+
+// after: mốc trước đó, chỉ để tạo phụ thuộc dữ liệu giữ thứ tự đọc counter
+perf_t perf_clock_now(perf_t after);
+
+// Native: PERF_TICK rỗng (không tốn gì trên đường nóng) trừ khi build với
+// -DML_KEM_NATIVE_PERF (make PERF=1). Bộ đếm thread_local: nhiều thread gọi
+// kernel song song không đua trên cùng 1 biến, perf[] là của thread gọi.
+#ifndef __SYNTHESIS__
+extern thread_local unsigned long long perf_sim_ticks;
+#endif
+#if !defined(__SYNTHESIS__) && (!defined(ML_KEM_NATIVE) || defined(ML_KEM_NATIVE_PERF))
+#define PERF_TICK(n)  (perf_sim_ticks += (unsigned long long)(n))
+#else
+#define PERF_TICK(n)
+#endif
+#define PERF_NOW(t)   perf_clock_now(t)
+
+// t: timestamp của biên phase trước, được cập nhật thành biên hiện tại
+#define PERF_MARK(pf, phase, t) \
+    do { perf_t _now = PERF_NOW(t); pf[phase] += _now - (t); t = _now; } while (0)
+
+// Số iteration danh định của primitive cho 1 lần gọi (khớp work của perf_model.cpp)
+#define PERF_ITERS_KECCAK     24                          // keccak_f1600
+#define PERF_ITERS_NTT        (7 * KYBER_N / 2)           // ntt / inv_ntt_layers
+#define PERF_ITERS_INVNTT     (PERF_ITERS_NTT + KYBER_N)  // inv_ntt (+ x F^-1)
+#define PERF_ITERS_BASEMUL    (KYBER_N / 2)               // poly_basemul_acc
+#define PERF_ITERS_MSG        KYBER_N                     // poly_frommsg / poly_tomsg
+// sample_poly_cbd: PRF (1 keccak, eta=3: 2) + lõi CBD (eta=2: 128 vòng, eta=3: 64)
+#define PERF_ITERS_CBD(eta)   ((eta) == 3 ? 2 * PERF_ITERS_KECCAK + 64 : PERF_ITERS_KECCAK + 128)
+// SampleNTT 1 đa thức: 6 keccak + 5 x 168 byte squeeze + parse / flush với
+// PERF_XOF_TRIPLES bộ 3 byte (số vòng parse thật phụ thuộc dữ liệu)
+#define PERF_XOF_TRIPLES      158
+#define PERF_ITERS_SAMPLE_NTT (6 * PERF_ITERS_KECCAK + 5 * 168 + PERF_XOF_TRIPLES + \
+                               (5 * 168 - 3 * PERF_XOF_TRIPLES))
+// gen_matrix: 4 word rho + K x K SampleNTT
+#define PERF_ITERS_GEN_MATRIX (4 + KYBER_K * KYBER_K * PERF_ITERS_SAMPLE_NTT)
+// matvec_At_t: feed_vec + PE load + K+1 hàng qua K PE + feed_rows + drain_uv
+#define PERF_ITERS_MATVEC_AT_T (128 + KYBER_K * 128 + KYBER_K * (KYBER_K + 1) * 128 + \
+                                2 * (KYBER_K + 1) * 128)
+// matvec_keygen: split rho + K cột (rho + K SampleNTT) + PE + encode t
+#define PERF_ITERS_MATVEC_KEYGEN (4 + KYBER_K * (4 + KYBER_K * PERF_ITERS_SAMPLE_NTT) + \
+                                  128 + KYBER_K * 128 + KYBER_K * (128 + KYBER_K * 128) + KYBER_K * 128)
 
 #endif
\ No newline at end of file
@@ -0,0 +1,28 @@
+#include "params.h"
+
+// =========================================================
+// PER-PHASE PERF COUNTERS
+// =========================================================
+#ifndef __SYNTHESIS__
+// Bộ đếm iteration cho C-sim (PERF_TICK / PERF_NOW), 1 bộ / thread
+thread_local unsigned long long perf_sim_ticks = 0;
+#endif
+
+// Mỗi process DATAFLOW ghi vào mảng perf riêng (1 writer / buffer),
+// phải xoá trước khi PERF_MARK cộng dồn.
+void perf_clear(perf_t pf[PERF_SLOTS]) {
+    #pragma HLS INLINE
+    for(int i=0; i<PERF_SLOTS; i++) {
+        #pragma HLS UNROLL
+        pf[i] = 0;
+    }
+}
+
+// acc += pf, dùng trong process gom perf cuối DATAFLOW
+void perf_merge(perf_t pf[PERF_SLOTS], perf_t acc[PERF_SLOTS]) {
+    #pragma HLS INLINE
+    for(int i=0; i<PERF_SLOTS; i++) {
+        #pragma HLS UNROLL
+        acc[i] += pf[i];
+    }
+}
@@ -0,0 +1,17 @@
+#include "params.h"
+
+// =========================================================
+// PERF CLOCK (C model)
+// =========================================================
+// Synthesis thay hàm này bằng perf_clock.v qua RTL blackbox (perf_clock.json):
+// counter 64-bit đếm mọi chu kỳ từ ap_rst, đọc tổ hợp (latency 0).
+// C-sim / native: trả về perf_sim_ticks (xem PERF_TICK trong params.h).
+// File này chỉ vào project qua add_files -blackbox, không add_files như kernel.
+perf_t perf_clock_now(perf_t after) {
+    (void)after;
+#ifndef __SYNTHESIS__
+    return (perf_t)perf_sim_ticks;
+#else
+    return 0;
+#endif
+}
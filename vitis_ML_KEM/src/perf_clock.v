@@ -0,0 +1,31 @@
+// Counter free-running cho perf[] (RTL blackbox của perf_clock_now, perf_clock.cpp).
+// Đếm mọi chu kỳ kể từ ap_rst, không phụ thuộc ap_ce / ap_start, nên mọi
+// instance trong cùng kernel luôn cùng giá trị. Đọc tổ hợp: ap_done = ap_start.
+module perf_clock (
+    input  wire        ap_clk,
+    input  wire        ap_rst,
+    input  wire        ap_ce,
+    input  wire        ap_start,
+    input  wire        ap_continue,
+    output wire        ap_idle,
+    output wire        ap_done,
+    output wire        ap_ready,
+    input  wire [63:0] after,
+    output wire [63:0] ap_return
+);
+
+    reg [63:0] cnt;
+
+    always @(posedge ap_clk) begin
+        if (ap_rst)
+            cnt <= 64'd0;
+        else
+            cnt <= cnt + 64'd1;
+    end
+
+    assign ap_return = cnt;
+    assign ap_idle   = 1'b1;
+    assign ap_done   = ap_start;
+    assign ap_ready  = ap_start;
+
+endmodule
@@ -0,0 +1,701 @@
+#include "perf_model.h"
+
+#ifndef __SYNTHESIS__
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstring>
+#include <string>
+#include <cstdlib>
+#include <cmath>
+
+// =========================================================
+// PHẦN 1: CẤU HÌNH
+// =========================================================
+const char* PM_UNIT_NAMES[PM_UNITS] = {
+    "m_axi", "keccak", "sampler", "cbd", "ntt", "basemul", "pack"
+};
+const char* PM_KERNEL_NAMES[PM_KERNELS] = { "keygen", "encaps", "decaps" };
+
+static const char* PM_PHASE_NAMES[PERF_SLOTS] = {
+    "LOAD", "HASH", "XOF", "NOISE", "MATRIX", "INVNTT", "COMPRESS", "STORE", "COMPARE", "TOTAL"
+};
+
+static void pm_set_level(PmConfig& cfg, int level) {
+    cfg.level = level;
+    if (level == 512)       { cfg.k = 2; cfg.eta1 = 3; cfg.du = 10; cfg.dv = 4; }
+    else if (level == 1024) { cfg.k = 4; cfg.eta1 = 2; cfg.du = 11; cfg.dv = 5; }
+    else                    { cfg.k = 3; cfg.eta1 = 2; cfg.du = 10; cfg.dv = 4; cfg.level = 768; }
+}
+
+void pm_default_config(PmConfig& cfg) {
+    pm_set_level(cfg, ML_KEM_LEVEL);
+    cfg.kg_keccak       = HW_KG_KECCAK;
+    cfg.kem_keccak      = HW_KEM_KECCAK;
+    cfg.xof_keccak      = HW_XOF_KECCAK;
+    cfg.kg_ntt          = HW_KG_NTT;
+    cfg.kem_ntt         = HW_KEM_NTT;
+    cfg.ntt_butterflies = HW_NTT_BUTTERFLIES;
+    cfg.ntt_ii          = HW_NTT_II;
+    cfg.poly_part       = HW_POLY_PART;
+    cfg.sampler_ii      = HW_SAMPLER_II;
+
+    // Placeholder chưa calibrate (ước lượng, chưa so với perf[] board)
+    cfg.keccak_lat  = 26;
+    cfg.bf_depth    = 10;
+    cfg.loop_ovh    = 3;
+    cfg.axi_lat     = 64;
+    cfg.xof_triples = PERF_XOF_TRIPLES;
+    cfg.calibrated  = false;
+}
+
+bool pm_set(PmConfig& cfg, const char* assign) {
+    const char* eq = strchr(assign, '=');
+    if (!eq) return false;
+    std::string key(assign, eq - assign);
+    int v = atoi(eq + 1);
+    if (v < 0) return false;
+
+    if      (key == "ML_KEM_LEVEL")       pm_set_level(cfg, v);
+    else if (key == "HW_KG_KECCAK")       cfg.kg_keccak = v;
+    else if (key == "HW_KEM_KECCAK")      cfg.kem_keccak = v;
+    else if (key == "HW_XOF_KECCAK")      cfg.xof_keccak = v;
+    else if (key == "HW_KG_NTT")          cfg.kg_ntt = v;
+    else if (key == "HW_KEM_NTT")         cfg.kem_ntt = v;
+    else if (key == "HW_NTT_BUTTERFLIES") cfg.ntt_butterflies = v;
+    else if (key == "HW_NTT_II")          cfg.ntt_ii = v;
+    else if (key == "HW_POLY_PART")       cfg.poly_part = v;
+    else if (key == "HW_SAMPLER_II")      cfg.sampler_ii = v;
+    else if (key == "KECCAK_LAT")         { cfg.keccak_lat = v; cfg.calibrated = false; }
+    else if (key == "BF_DEPTH")           { cfg.bf_depth = v; cfg.calibrated = false; }
+    else if (key == "LOOP_OVH")           { cfg.loop_ovh = v; cfg.calibrated = false; }
+    else if (key == "AXI_LAT")            { cfg.axi_lat = v; cfg.calibrated = false; }
+    else if (key == "XOF_TRIPLES")        cfg.xof_triples = v;
+    else return false;
+
+    // Cùng ràng buộc với #error trong hw_config.h, và mọi pool phải có >= 1 instance
+    return cfg.poly_part >= 2 * cfg.ntt_butterflies && cfg.ntt_butterflies >= 1 &&
+           cfg.kg_keccak >= 1 && cfg.kem_keccak >= 1 && cfg.xof_keccak >= 1 &&
+           cfg.kg_ntt >= 1 && cfg.kem_ntt >= 1 && cfg.ntt_ii >= 1 && cfg.sampler_ii >= 1;
+}
+
+// =========================================================
+// PHẦN 2: CHI PHÍ TỪNG KHỐI
+// =========================================================
+// work   = số PERF_TICK mà khối đó sinh ra trong C-sim
+// cycles = II * trip count + depth, theo pragma của khối trong src/
+struct PmCost {
+    unsigned long long work;
+    unsigned long long cycles;
+};
+
+// Loop PIPELINE: n iteration, II cho trước
+static PmCost pm_pipe(const PmConfig& c, int n, int ii = 1) {
+    PmCost r = { (unsigned long long)n, (unsigned long long)(n * ii + c.loop_ovh) };
+    return r;
+}
+
+static PmCost pm_keccak(const PmConfig& c, int n = 1) {
+    PmCost r = { 24ULL * n, (unsigned long long)(n * c.keccak_lat) };
+    return r;
+}
+
+// ntt / inv_ntt_layers (ntt.cpp): 7 layer, mỗi nhóm butterfly là 1 loop
+// PIPELINE riêng (bound không hằng -> không flatten), nên mỗi nhóm trả depth
+static PmCost pm_ntt(const PmConfig& c) {
+    PmCost r = { 7ULL * 128, 0 };
+    for (int len = 128; len >= 2; len >>= 1) {
+        int groups = 128 / len;
+        int iters = (len + c.ntt_butterflies - 1) / c.ntt_butterflies;
+        r.cycles += (unsigned long long)groups * (iters * c.ntt_ii + c.bf_depth);
+    }
+    return r;
+}
+
+// SampleNTT 1 đa thức: xof_absorb_squeeze (1 + 5 keccak, 5 x 168 byte II=1)
+// chạy song song với parse_ntt (t vòng, II = HW_SAMPLER_II) rồi flush phần dư.
+static PmCost pm_sample_ntt(const PmConfig& c) {
+    const int t = c.xof_triples;
+    PmCost r;
+    r.work = 6 * 24 + 5 * 168 + t + (5 * 168 - 3 * t);
+    unsigned long long squeeze = 6ULL * c.keccak_lat + 5 * 168;
+    unsigned long long parse = (unsigned long long)c.keccak_lat + (unsigned long long)t * c.sampler_ii;
+    r.cycles = (squeeze > parse ? squeeze : parse) + c.loop_ovh;
+    return r;
+}
+
+// Lõi CBD sau PRF (cbd.cpp): eta=2 -> 128 vòng II=1, eta=3 -> 64 vòng II=2
+static PmCost pm_cbd_core(const PmConfig& c, int eta) {
+    return (eta == 2) ? pm_pipe(c, 128) : pm_pipe(c, 64, 2);
+}
+
+// Absorb nbeats beat 128-bit vào sponge rate 17 lane (pre lane đã có sẵn),
+// keccak nằm trong loop absorb (stall) + 1 keccak cuối sau padding
+static PmCost pm_absorb(const PmConfig& c, int nbeats, int pre_lanes) {
+    int nk = (pre_lanes + 2 * nbeats) / 17 + 1;
+    PmCost r = { (unsigned long long)(nbeats + 24 * nk),
+                 (unsigned long long)(nbeats + nk * c.keccak_lat + c.loop_ovh) };
+    return r;
+}
+
+// Burst m_axi: beat đầu sau axi_lat, sau đó 1 beat / chu kỳ
+static PmCost pm_axi(const PmConfig& c, int nbeats) {
+    PmCost r = { (unsigned long long)nbeats, (unsigned long long)(c.axi_lat + nbeats + c.loop_ovh) };
+    return r;
+}
+
+static PmCost pm_cost(unsigned long long work, unsigned long long cycles) {
+    PmCost r = { work, cycles };
+    return r;
+}
+
+// =========================================================
+// PHẦN 3: ĐỒ THỊ TASK + LỊCH DISCRETE-EVENT
+// =========================================================
+// Cạnh dep : start >= end(dep)                  (mảng ping-pong, thứ tự lệnh)
+// Cạnh sdep: start >= start(dep) + lag,         (hls::stream: consumer chạy
+//            end   >= end(dep) + tail            chồng lên producer)
+struct PmEdge {
+    int task;
+    int lag, tail;
+};
+
+struct PmTask {
+    const char* name;
+    int proc;   // process DATAFLOW / hàm tuần tự chứa task (1 bộ PERF_MARK)
+    int phase;  // PERF_*, -1 = không nằm trong phase nào (chỉ vào TOTAL)
+    int unit;
+    int pool;   // -1 = không giới hạn
+    PmCost cost;
+    std::vector<int> deps;
+    std::vector<PmEdge> sdeps;
+
+    long long start, end;
+    int start_by;     // task quyết định start (dep / sdep / holder của pool)
+    int end_by;       // sdep quyết định end (tail), -1 nếu end = start + cycles
+};
+
+struct PmPool {
+    int cap;
+    std::vector<long long> free_at;
+    std::vector<int> holder;
+};
+
+struct PmGraph {
+    std::vector<PmTask> tasks;
+    std::vector<PmPool> pools;
+    int n_proc;
+
+    PmGraph() : n_proc(0) {}
+
+    int proc() { return n_proc++; }
+
+    int pool(int cap) {
+        PmPool p;
+        p.cap = cap;
+        pools.push_back(p);
+        return (int)pools.size() - 1;
+    }
+
+    int add(const char* name, int proc, int phase, int unit, PmCost cost,
+            const std::vector<int>& deps, int pool = -1) {
+        PmTask t;
+        t.name = name;
+        t.proc = proc;
+        t.phase = phase;
+        t.unit = unit;
+        t.pool = pool;
+        t.cost = cost;
+        t.deps = deps;
+        t.start = t.end = 0;
+        t.start_by = t.end_by = -1;
+        tasks.push_back(t);
+        return (int)tasks.size() - 1;
+    }
+
+    void stream(int consumer, int producer, int lag, int tail) {
+        PmEdge e = { producer, lag, tail };
+        tasks[consumer].sdeps.push_back(e);
+    }
+};
+
+// Thời điểm sớm nhất task bắt đầu được nếu lên lịch ngay bây giờ
+static long long pm_ready(const PmGraph& g, const PmTask& t, int& by, int& inst) {
+    long long ready = 0;
+    by = -1;
+    for (size_t d = 0; d < t.deps.size(); d++) {
+        const PmTask& dt = g.tasks[t.deps[d]];
+        if (by < 0 || dt.end > ready) { ready = dt.end; by = t.deps[d]; }
+    }
+    for (size_t d = 0; d < t.sdeps.size(); d++) {
+        long long s = g.tasks[t.sdeps[d].task].start + t.sdeps[d].lag;
+        if (by < 0 || s > ready) { ready = s; by = t.sdeps[d].task; }
+    }
+    inst = -1;
+    if (t.pool >= 0) {
+        const PmPool& p = g.pools[t.pool];
+        inst = 0;
+        for (int k = 1; k < p.cap; k++)
+            if (p.free_at[k] < p.free_at[inst]) inst = k;
+        if (p.free_at[inst] > ready) {
+            ready = p.free_at[inst];
+            by = p.holder[inst];
+        }
+    }
+    return ready;
+}
+
+// List scheduling: mỗi bước chọn task (đã đủ producer) bắt đầu được sớm nhất,
+// hoà thì theo thứ tự add (= thứ tự lệnh trong source), lấy instance rảnh
+// sớm nhất của pool. start các task được chọn không giảm dần nên free_at đúng.
+static void pm_schedule(PmGraph& g) {
+    for (size_t p = 0; p < g.pools.size(); p++) {
+        g.pools[p].free_at.assign(g.pools[p].cap, 0);
+        g.pools[p].holder.assign(g.pools[p].cap, -1);
+    }
+    const int n = (int)g.tasks.size();
+    std::vector<char> done(n, 0);
+    for (int step = 0; step < n; step++) {
+        int pick = -1, pick_by = -1, pick_inst = -1;
+        long long pick_at = 0;
+        for (int i = 0; i < n; i++) {
+            if (done[i]) continue;
+            const PmTask& t = g.tasks[i];
+            bool ok = true;
+            for (size_t d = 0; d < t.deps.size() && ok; d++) ok = done[t.deps[d]];
+            for (size_t d = 0; d < t.sdeps.size() && ok; d++) ok = done[t.sdeps[d].task];
+            if (!ok) continue;
+            int by, inst;
+            long long at = pm_ready(g, t, by, inst);
+            if (pick < 0 || at < pick_at) {
+                pick = i;
+                pick_at = at;
+                pick_by = by;
+                pick_inst = inst;
+            }
+        }
+
+        PmTask& t = g.tasks[pick];
+        done[pick] = 1;
+        t.start = pick_at;
+        t.start_by = pick_by;
+        t.end = pick_at + (long long)t.cost.cycles;
+        for (size_t d = 0; d < t.sdeps.size(); d++) {
+            const PmTask& dt = g.tasks[t.sdeps[d].task];
+            if (dt.end + t.sdeps[d].tail > t.end) {
+                t.end = dt.end + t.sdeps[d].tail;
+                t.end_by = t.sdeps[d].task;
+            }
+        }
+        if (pick_inst >= 0) {
+            g.pools[t.pool].free_at[pick_inst] = t.end;
+            g.pools[t.pool].holder[pick_inst] = pick;
+        }
+    }
+}
+
+// perf[] như PERF_MARK trên HW: mỗi process chốt mốc khi đổi phase,
+// phase nhận (end lớn nhất của đoạn) - (mốc trước); perf_collect cộng các process.
+static void pm_collect(const PmGraph& g, PmResult& res) {
+    for (int i = 0; i < PERF_SLOTS; i++) res.work[i] = res.cycles[i] = 0;
+
+    long long makespan = 0;
+    for (size_t i = 0; i < g.tasks.size(); i++) {
+        const PmTask& t = g.tasks[i];
+        if (t.phase >= 0) res.work[t.phase] += t.cost.work;
+        res.work[PERF_TOTAL] += t.cost.work;
+        if (t.end > makespan) makespan = t.end;
+    }
+    res.cycles[PERF_TOTAL] = (unsigned long long)makespan;
+
+    for (int p = 0; p < g.n_proc; p++) {
+        bool open = false;
+        int phase = -1;
+        long long mark = 0, seg_end = 0;
+        for (size_t i = 0; i < g.tasks.size(); i++) {
+            const PmTask& t = g.tasks[i];
+            if (t.proc != p || t.phase < 0) continue;
+            if (!open) {
+                mark = t.start;
+                seg_end = t.end;
+                phase = t.phase;
+                open = true;
+                continue;
+            }
+            if (t.phase != phase) {
+                res.cycles[phase] += (unsigned long long)(seg_end - mark);
+                mark = seg_end;
+                phase = t.phase;
+            }
+            if (t.end > seg_end) seg_end = t.end;
+        }
+        if (open) res.cycles[phase] += (unsigned long long)(seg_end - mark);
+    }
+}
+
+// Critical path: đi ngược từ task kết thúc cuối theo ràng buộc đã quyết định
+// start / end của từng task, cộng thời gian từng đoạn vào loại khối sở hữu nó.
+static void pm_critical(const PmGraph& g, PmResult& res, std::vector<int>* path) {
+    for (int u = 0; u < PM_UNITS; u++) res.crit[u] = 0;
+    int cur = -1;
+    for (size_t i = 0; i < g.tasks.size(); i++)
+        if (cur < 0 || g.tasks[i].end > g.tasks[cur].end) cur = (int)i;
+
+    long long at = (cur >= 0) ? g.tasks[cur].end : 0;
+    while (cur >= 0) {
+        const PmTask& t = g.tasks[cur];
+        if (path) path->push_back(cur);
+        if (at == t.end && t.end_by >= 0) {
+            long long prod_end = g.tasks[t.end_by].end;
+            res.crit[t.unit] += (unsigned long long)(at - prod_end);
+            at = prod_end;
+            cur = t.end_by;
+            continue;
+        }
+        res.crit[t.unit] += (unsigned long long)(at - t.start);
+        at = t.start;
+        cur = t.start_by;
+    }
+
+    res.crit_unit = 0;
+    for (int u = 1; u < PM_UNITS; u++)
+        if (res.crit[u] > res.crit[res.crit_unit]) res.crit_unit = u;
+    res.n_tasks = (int)g.tasks.size();
+}
+
+// =========================================================
+// PHẦN 4: ĐỒ THỊ CỦA TỪNG KERNEL
+// =========================================================
+struct PmSizes {
+    int pk_beats, ct_beats, vec_beats, dk_beats;
+};
+
+static PmSizes pm_sizes(const PmConfig& c) {
+    PmSizes s;
+    int polyvec = c.k * 384;
+    s.pk_beats  = (polyvec + 32) / AXI_BEAT_BYTES;
+    s.ct_beats  = (c.k * c.du * 32 + c.dv * 32) / AXI_BEAT_BYTES;
+    s.vec_beats = polyvec / AXI_BEAT_BYTES;
+    s.dk_beats  = (2 * polyvec + 64) / AXI_BEAT_BYTES; // tới KYBER_SK_Z_OFF
+    return s;
+}
+
+// matvec_At_t (matvec.cpp): feed_vec || PE load, rồi K+1 hàng qua chuỗi K PE
+static PmCost pm_matvec_At_t(const PmConfig& c) {
+    int rows = c.k + 1;
+    PmCost r;
+    r.work = 128 + c.k * 128 + c.k * rows * 128 + rows * 128 + rows * 128;
+    r.cycles = 128 + rows * 128 + c.k * c.bf_depth + 2 * c.loop_ovh;
+    return r;
+}
+
+// Các task của 1 lần SampleNTT cho K hàng / cột song song, mỗi hàng K đa thức
+// nối tiếp (gen_matrix / gen_matrix_col); trả về task cuối của từng hàng.
+static std::vector<int> pm_add_matrix(PmGraph& g, const PmConfig& c, int proc, int phase,
+                                      int rho_task, int pool) {
+    std::vector<int> last;
+    for (int i = 0; i < c.k; i++) {
+        int prev = rho_task;
+        for (int j = 0; j < c.k; j++) {
+            std::vector<int> deps(1, prev);
+            prev = g.add("sample_ntt", proc, phase, PM_SAMPLER, pm_sample_ntt(c), deps, pool);
+        }
+        last.push_back(prev);
+    }
+    return last;
+}
+
+// PRF (keccak) -> CBD của 1 đa thức, trả về task CBD
+static int pm_add_cbd(PmGraph& g, const PmConfig& c, int proc, int phase, int eta,
+                      int dep, int keccak_pool) {
+    int prf = g.add("prf", proc, phase, PM_KECCAK, pm_keccak(c, eta == 3 ? 2 : 1),
+                    std::vector<int>(1, dep), keccak_pool);
+    return g.add("cbd", proc, phase, PM_CBD, pm_cbd_core(c, eta), std::vector<int>(1, prf));
+}
+
+static int pm_add_ntt(PmGraph& g, const PmConfig& c, int proc, int phase, int dep, int ntt_pool) {
+    return g.add("ntt", proc, phase, PM_NTT, pm_ntt(c), std::vector<int>(1, dep), ntt_pool);
+}
+
+// keygen.cpp: keygen_core tuần tự, matvec_keygen là DATAFLOW bên trong
+static void pm_build_keygen(PmGraph& g, const PmConfig& c) {
+    const PmSizes s = pm_sizes(c);
+    int core = g.proc();
+    int keccak = g.pool(c.kg_keccak);
+    int ntt = g.pool(c.kg_ntt);
+
+    int load = g.add("seed_d", core, PERF_LOAD, PM_AXI, pm_cost(4, c.axi_lat + 4), std::vector<int>());
+    int hash = g.add("G", core, PERF_HASH, PM_KECCAK, pm_keccak(c), std::vector<int>(1, load), keccak);
+
+    std::vector<int> noise;
+    for (int i = 0; i < c.k; i++) {
+        int n = pm_add_ntt(g, c, core, PERF_NOISE, pm_add_cbd(g, c, core, PERF_NOISE, c.eta1, hash, keccak), ntt);
+        noise.push_back(g.add("poly_tobytes", core, PERF_NOISE, PM_PACK, pm_pipe(c, 128), std::vector<int>(1, n)));
+    }
+    for (int i = 0; i < c.k; i++)
+        noise.push_back(pm_add_ntt(g, c, core, PERF_NOISE, pm_add_cbd(g, c, core, PERF_NOISE, c.eta1, hash, keccak), ntt));
+
+    // matvec_keygen: split_rho -> K cột SampleNTT -> chuỗi PE -> encode t
+    int split = g.add("split_rho", core, PERF_MATRIX, PM_PACK, pm_pipe(c, 4), noise);
+    std::vector<int> cols;
+    for (int j = 0; j < c.k; j++) {
+        int rho = g.add("rho", core, PERF_MATRIX, PM_PACK, pm_cost(4, 4), std::vector<int>(1, split));
+        int prev = rho;
+        for (int i = 0; i < c.k; i++)
+            prev = g.add("sample_ntt", core, PERF_MATRIX, PM_SAMPLER, pm_sample_ntt(c), std::vector<int>(1, prev), keccak);
+        cols.push_back(prev);
+    }
+    PmCost pe;
+    pe.work = 128 + c.k * 128 + c.k * (128 + c.k * 128) + c.k * 128;
+    pe.cycles = 128 + c.k * 128 + c.k * c.bf_depth + 2 * c.loop_ovh;
+    int mv = g.add("matvec_pe", core, PERF_MATRIX, PM_BASEMUL, pe, std::vector<int>(1, split));
+    // PE hàng i chỉ chạy khi mọi cột đã sample xong hàng i -> xong sau cột chậm nhất
+    for (int j = 0; j < c.k; j++)
+        g.stream(mv, cols[j], 0, 128 + c.k * c.bf_depth + c.loop_ovh);
+    int rho_cp = g.add("rho_copy", core, PERF_MATRIX, PM_PACK, pm_pipe(c, 32), std::vector<int>(1, mv));
+
+    g.add("store", core, PERF_STORE, PM_AXI, pm_axi(c, s.vec_beats + s.pk_beats),
+          std::vector<int>(1, rho_cp));
+}
+
+// encaps.cpp: encaps_core = DATAFLOW ingest || xof || noise -> finish
+static void pm_build_encaps(PmGraph& g, const PmConfig& c) {
+    const PmSizes s = pm_sizes(c);
+    int top = g.proc();
+    int m_in = g.add("m_in", top, -1, PM_AXI, pm_axi(c, 32), std::vector<int>());
+    std::vector<int> root(1, m_in);
+
+    // encaps_ingest: read_ek -> (hash_ek || decode_ek)
+    int ingest = g.proc();
+    int rd = g.add("read_ek", ingest, PERF_LOAD, PM_AXI, pm_axi(c, 4 + s.pk_beats), root);
+    int hk = g.add("hash_ek", ingest, PERF_LOAD, PM_KECCAK, pm_absorb(c, s.pk_beats, 0), root);
+    g.stream(hk, rd, c.axi_lat + 4, 1);
+    int dec = g.add("decode_ek", ingest, PERF_LOAD, PM_PACK, pm_pipe(c, s.vec_beats), root);
+    g.stream(dec, rd, c.axi_lat + 4, 1);
+
+    // encaps_xof: bắt đầu ngay khi rho ra khỏi read_ek
+    int xof = g.proc();
+    int rho = g.add("rho", xof, PERF_XOF, PM_PACK, pm_cost(4, 4), root);
+    g.stream(rho, rd, c.axi_lat, 0);
+    std::vector<int> a_t = pm_add_matrix(g, c, xof, PERF_XOF, rho, g.pool(c.xof_keccak));
+
+    // encaps_noise: h_pk là mảng -> chờ ingest xong
+    int noise = g.proc();
+    int keccak = g.pool(c.kem_keccak), ntt = g.pool(c.kem_ntt);
+    std::vector<int> ing(1, hk);
+    ing.push_back(dec);
+    ing.push_back(rd);
+    int G = g.add("G", noise, PERF_HASH, PM_KECCAK, pm_keccak(c), ing, keccak);
+    std::vector<int> nz;
+    for (int i = 0; i < c.k; i++)
+        nz.push_back(pm_add_ntt(g, c, noise, PERF_NOISE, pm_add_cbd(g, c, noise, PERF_NOISE, c.eta1, G, keccak), ntt));
+    for (int i = 0; i < c.k; i++)
+        nz.push_back(pm_add_cbd(g, c, noise, PERF_NOISE, KYBER_ETA2, G, keccak));
+    nz.push_back(pm_add_cbd(g, c, noise, PERF_NOISE, KYBER_ETA2, G, keccak));
+    nz.push_back(g.add("poly_frommsg", noise, PERF_NOISE, PM_PACK, pm_pipe(c, 256), std::vector<int>(1, G)));
+
+    // encaps_finish: matvec -> K+1 x (inv_ntt_layers -> emit), emit chung 1 cổng ct_out
+    int fin = g.proc();
+    std::vector<int> fdeps(a_t);
+    fdeps.insert(fdeps.end(), ing.begin(), ing.end());
+    fdeps.insert(fdeps.end(), nz.begin(), nz.end());
+    int mv = g.add("matvec_At_t", fin, PERF_MATRIX, PM_BASEMUL, pm_matvec_At_t(c), fdeps);
+    int inv = g.pool(c.kem_ntt), emit = g.pool(1);
+    int last = mv;
+    for (int i = 0; i <= c.k; i++) {
+        int in = g.add("inv_ntt_layers", fin, PERF_COMPRESS, PM_NTT, pm_ntt(c), std::vector<int>(1, mv), inv);
+        last = g.add("emit_poly", fin, PERF_COMPRESS, PM_PACK, pm_pipe(c, 256), std::vector<int>(1, in), emit);
+    }
+    g.add("ct_out", top, -1, PM_AXI, pm_cost(0, c.axi_lat), std::vector<int>(1, last));
+}
+
+// decaps.cpp: decaps_core = DATAFLOW 13 process (xem sơ đồ trước decaps_core)
+static void pm_build_decaps(PmGraph& g, const PmConfig& c) {
+    const PmSizes s = pm_sizes(c);
+    const std::vector<int> none;
+
+    int p_dk = g.proc();
+    int rd = g.add("read_dk", p_dk, PERF_LOAD, PM_AXI, pm_axi(c, 8 + s.dk_beats), none);
+
+    int p_chk = g.proc();
+    int chk = g.add("check_dk", p_chk, -1, PM_KECCAK, pm_absorb(c, s.pk_beats, 0), none);
+    g.stream(chk, rd, c.axi_lat + 8 + s.vec_beats, 1);
+
+    int p_s = g.proc();
+    int ds = g.add("decode_s", p_s, -1, PM_PACK, pm_pipe(c, s.vec_beats), none);
+    g.stream(ds, rd, c.axi_lat + 8, 1);
+    int p_t = g.proc();
+    int dt = g.add("decode_t", p_t, -1, PM_PACK, pm_pipe(c, s.vec_beats), none);
+    g.stream(dt, rd, c.axi_lat + 8 + s.vec_beats, 1);
+
+    int p_xof = g.proc();
+    int rho = g.add("rho", p_xof, PERF_XOF, PM_PACK, pm_cost(4, 4), none);
+    g.stream(rho, rd, c.axi_lat, 0);
+    std::vector<int> a_t = pm_add_matrix(g, c, p_xof, PERF_XOF, rho, g.pool(c.xof_keccak));
+
+    // ct trên cổng gmem1 riêng -> song song với read_dk
+    int p_ct = g.proc();
+    int rc = g.add("read_ct", p_ct, PERF_LOAD, PM_AXI, pm_axi(c, s.ct_beats), none);
+    int p_j = g.proc();
+    int hj = g.add("hash_j", p_j, PERF_HASH, PM_KECCAK, pm_absorb(c, s.ct_beats, 4), none);
+    g.stream(hj, rc, c.axi_lat, 1);
+    g.stream(hj, rd, c.axi_lat + 8, 0);
+
+    // decaps_decrypt: NTT(u) -> basemul_acc -> inv_ntt -> m' -> G
+    int p_dec = g.proc();
+    int dntt = g.pool(c.kem_ntt), dkec = g.pool(c.kem_keccak);
+    std::vector<int> in_dec(1, rc);
+    in_dec.push_back(ds);
+    in_dec.push_back(rd);
+    std::vector<int> u_hat;
+    for (int i = 0; i < c.k; i++)
+        u_hat.push_back(g.add("ntt", p_dec, PERF_MATRIX, PM_NTT, pm_ntt(c), in_dec, dntt));
+    PmCost bm = pm_pipe(c, 128);
+    bm.cycles += c.bf_depth;
+    int acc = g.add("basemul_acc", p_dec, PERF_MATRIX, PM_BASEMUL, bm, u_hat);
+    PmCost inv = pm_ntt(c);
+    inv.work += 256;
+    inv.cycles += 256 + c.loop_ovh;
+    int in = g.add("inv_ntt", p_dec, PERF_INVNTT, PM_NTT, inv, std::vector<int>(1, acc), dntt);
+    int msg = g.add("poly_tomsg", p_dec, PERF_COMPRESS, PM_PACK, pm_pipe(c, 256), std::vector<int>(1, in));
+    int G = g.add("G", p_dec, PERF_HASH, PM_KECCAK, pm_keccak(c), std::vector<int>(1, msg), dkec);
+
+    // decaps_noise: không có ALLOCATION keccak -> K PRF song song
+    int p_nz = g.proc();
+    int nntt = g.pool(c.kem_ntt);
+    std::vector<int> r_hat, e1;
+    for (int i = 0; i < c.k; i++) {
+        r_hat.push_back(pm_add_ntt(g, c, p_nz, PERF_NOISE, pm_add_cbd(g, c, p_nz, PERF_NOISE, c.eta1, G, -1), nntt));
+        e1.push_back(pm_add_cbd(g, c, p_nz, PERF_NOISE, KYBER_ETA2, G, -1));
+    }
+    int e2 = pm_add_cbd(g, c, p_nz, PERF_NOISE, KYBER_ETA2, G, -1);
+    int fm = g.add("poly_frommsg", p_nz, PERF_NOISE, PM_PACK, pm_pipe(c, 256), std::vector<int>(1, G));
+    std::vector<int> ve_in(1, e2);
+    ve_in.push_back(fm);
+    int ve = g.add("poly_add", p_nz, PERF_NOISE, PM_PACK, pm_pipe(c, 256 / c.poly_part), ve_in);
+
+    int p_mat = g.proc();
+    std::vector<int> mdeps(a_t);
+    mdeps.push_back(dt);
+    mdeps.insert(mdeps.end(), r_hat.begin(), r_hat.end());
+    int mv = g.add("matvec_At_t", p_mat, PERF_MATRIX, PM_BASEMUL, pm_matvec_At_t(c), mdeps);
+
+    int p_cu = g.proc();
+    int cntt = g.pool(c.kem_ntt);
+    std::vector<int> cu_in(1, mv);
+    cu_in.insert(cu_in.end(), e1.begin(), e1.end());
+    cu_in.push_back(rc);
+    std::vector<int> sel_in;
+    for (int i = 0; i < c.k; i++) {
+        int ni = g.add("inv_ntt_layers", p_cu, PERF_COMPARE, PM_NTT, pm_ntt(c), cu_in, cntt);
+        sel_in.push_back(g.add("cmp_u", p_cu, PERF_COMPARE, PM_PACK, pm_pipe(c, 256), std::vector<int>(1, ni)));
+    }
+
+    int p_cv = g.proc();
+    std::vector<int> cv_in(1, mv);
+    cv_in.push_back(ve);
+    int nv = g.add("inv_ntt_layers", p_cv, PERF_COMPARE, PM_NTT, pm_ntt(c), cv_in);
+    sel_in.push_back(g.add("cmp_v", p_cv, PERF_COMPARE, PM_PACK, pm_pipe(c, 256), std::vector<int>(1, nv)));
+
+    int p_sel = g.proc();
+    sel_in.push_back(hj);
+    sel_in.push_back(G);
+    g.add("select", p_sel, PERF_STORE, PM_AXI, pm_cost(32 / AXI_BEAT_BYTES, c.axi_lat + 32 / AXI_BEAT_BYTES), sel_in);
+}
+
+// =========================================================
+// PHẦN 5: API
+// =========================================================
+static void pm_build(PmGraph& g, const PmConfig& cfg, PmKernel kernel) {
+    if (kernel == PM_KEYGEN)      pm_build_keygen(g, cfg);
+    else if (kernel == PM_ENCAPS) pm_build_encaps(g, cfg);
+    else                          pm_build_decaps(g, cfg);
+}
+
+void pm_run(const PmConfig& cfg, PmKernel kernel, PmResult& res) {
+    PmGraph g;
+    pm_build(g, cfg, kernel);
+    pm_schedule(g);
+    pm_collect(g, res);
+    pm_critical(g, res, 0);
+}
+
+void pm_print(const PmConfig& cfg, PmKernel kernel, const PmResult& res, bool verbose) {
+    std::cout << "[model] " << PM_KERNEL_NAMES[kernel] << " ML-KEM-" << cfg.level
+              << " (" << res.n_tasks << " tasks)"
+              << (cfg.calibrated ? "" : " [UNCALIBRATED: HW constants are placeholders, cycles are relative only]")
+              << std::endl;
+    std::cout << "  " << std::left << std::setw(10) << "phase" << std::right
+              << std::setw(10) << "c-sim" << std::setw(10) << "cycles" << std::endl;
+    for (int i = 0; i < PERF_SLOTS; i++) {
+        if (res.work[i] == 0 && res.cycles[i] == 0) continue;
+        std::cout << "  " << std::left << std::setw(10) << PM_PHASE_NAMES[i] << std::right
+                  << std::setw(10) << res.work[i] << std::setw(10) << res.cycles[i] << std::endl;
+    }
+    std::cout << "  critical path:";
+    for (int u = 0; u < PM_UNITS; u++) {
+        if (res.crit[u] == 0) continue;
+        std::cout << " " << PM_UNIT_NAMES[u] << "="
+                  << (int)(100.0 * res.crit[u] / res.cycles[PERF_TOTAL] + 0.5) << "%";
+    }
+    std::cout << " -> " << PM_UNIT_NAMES[res.crit_unit] << std::endl;
+
+    if (verbose) {
+        PmGraph g;
+        pm_build(g, cfg, kernel);
+        pm_schedule(g);
+        PmResult tmp;
+        std::vector<int> path;
+        pm_critical(g, tmp, &path);
+        for (int i = (int)path.size() - 1; i >= 0; i--) {
+            const PmTask& t = g.tasks[path[i]];
+            std::cout << "    " << std::setw(8) << t.start << " .. " << std::setw(8) << t.end
+                      << "  " << t.name << " [" << PM_UNIT_NAMES[t.unit] << "]" << std::endl;
+        }
+    }
+}
+
+// Sai số tương đối trung bình trên các phase có số đo (kể cả TOTAL)
+static double pm_error(const PmConfig& cfg, PmKernel kernel, const unsigned long long measured[PERF_SLOTS]) {
+    PmResult r;
+    pm_run(cfg, kernel, r);
+    double err = 0;
+    int n = 0;
+    for (int i = 0; i < PERF_SLOTS; i++) {
+        if (measured[i] == 0) continue;
+        err += fabs((double)r.cycles[i] - (double)measured[i]) / (double)measured[i];
+        n++;
+    }
+    return n ? err / n : 0.0;
+}
+
+// Coordinate descent trên 4 hằng số HW (knob và xof_triples giữ nguyên):
+// mỗi vòng quét từng hằng số trong khoảng hợp lý, giữ giá trị tốt nhất.
+double pm_calibrate(PmConfig& cfg, PmKernel kernel, const unsigned long long measured[PERF_SLOTS]) {
+    int* knobs[4] = { &cfg.keccak_lat, &cfg.bf_depth, &cfg.loop_ovh, &cfg.axi_lat };
+    const int lo[4] = { 24, 1, 0, 0 };
+    const int hi[4] = { 48, 24, 8, 256 };
+
+    double best = pm_error(cfg, kernel, measured);
+    for (int pass = 0; pass < 4; pass++) {
+        bool moved = false;
+        for (int k = 0; k < 4; k++) {
+            int keep = *knobs[k];
+            for (int v = lo[k]; v <= hi[k]; v++) {
+                *knobs[k] = v;
+                double e = pm_error(cfg, kernel, measured);
+                if (e < best) {
+                    best = e;
+                    keep = v;
+                    moved = true;
+                }
+            }
+            *knobs[k] = keep;
+        }
+        if (!moved) break;
+    }
+    cfg.calibrated = true;
+    return best;
+}
+
+#endif
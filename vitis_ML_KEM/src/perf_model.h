@@ -0,0 +1,87 @@
+#ifndef PERF_MODEL_H
+#define PERF_MODEL_H
+
+#include "params.h"
+
+// =========================================================
+// CYCLE-APPROXIMATE PERFORMANCE MODEL (host only)
+// =========================================================
+// Mô hình discrete-event của keygen / encaps / decaps để thử knob hw_config.h
+// mà không cần chạy C-synthesis. Mỗi kernel được dựng thành đồ thị task
+// theo đúng cấu trúc process / DATAFLOW trong keygen.cpp, encaps.cpp,
+// decaps.cpp; mỗi task là 1 khối (Keccak, SampleNTT, CBD, NTT, basemul,
+// packer, m_axi) với:
+//   work   : số iteration PERF_TICK của khối -> so được 1:1 với perf[] C-sim
+//   cycles : latency ước lượng trên HW từ II / depth của khối và các knob
+// Task chiếm 1 instance của pool tài nguyên (ALLOCATION limit) trong lúc chạy.
+//
+// Không dùng trong kernel: perf_model.cpp được bỏ qua khi __SYNTHESIS__.
+//
+// CHƯA CALIBRATE: keccak_lat / bf_depth / loop_ovh / axi_lat mặc định là giá
+// trị ước lượng từ II / latency của khối, chưa fit với perf[] đọc về từ board
+// (repo chưa có bản readback nào). "cycles" chỉ dùng để so sánh tương đối
+// giữa các knob; con số tuyệt đối chỉ có nghĩa sau pm_calibrate trên perf[]
+// đo thật. pm_print ghi rõ trạng thái này (PmConfig::calibrated).
+
+// Loại khối phần cứng, dùng để quy critical path về tài nguyên
+enum PmUnit {
+    PM_AXI = 0,  // burst m_axi in / out
+    PM_KECCAK,   // sponge: H / G / J / PRF, absorb beat
+    PM_SAMPLER,  // SHAKE128 squeeze + parse (SampleNTT)
+    PM_CBD,
+    PM_NTT,      // ntt / inv_ntt
+    PM_BASEMUL,  // matvec engine, poly_basemul_acc
+    PM_PACK,     // decode / encode / compress / msg / poly_add
+    PM_UNITS
+};
+
+enum PmKernel { PM_KEYGEN = 0, PM_ENCAPS, PM_DECAPS, PM_KERNELS };
+
+struct PmConfig {
+    // Bộ tham số (runtime, để 1 binary quét được cả 3 level)
+    int level, k, eta1, du, dv;
+
+    // Knob hw_config.h (mặc định = giá trị lúc compile)
+    int kg_keccak, kem_keccak, xof_keccak;
+    int kg_ntt, kem_ntt;
+    int ntt_butterflies, ntt_ii;
+    int poly_part;
+    int sampler_ii;
+
+    // Hằng số calibrate (cycle), xem pm_calibrate. Mặc định là placeholder
+    // chưa calibrate, không phải số đo.
+    int keccak_lat;  // 1 keccak_f1600: 24 round II=1 + vào / ra
+    int bf_depth;    // depth pipeline butterfly / basemul (3 mul_mod DSP latency=3)
+    int loop_ovh;    // vào / ra 1 loop PIPELINE
+    int axi_lat;     // latency beat đầu của 1 burst m_axi
+    int xof_triples; // số vòng parse trung bình / đa thức: 256 / (2 * 3329/4096) ~ 158
+    bool calibrated; // true sau pm_calibrate, false với hằng số mặc định / pm_set
+};
+
+// Kết quả 1 lần chạy model
+struct PmResult {
+    unsigned long long work[PERF_SLOTS];   // = perf[] của C-sim (PERF_TOTAL = tổng)
+    unsigned long long cycles[PERF_SLOTS]; // dự đoán perf[] trên HW
+    unsigned long long crit[PM_UNITS];     // cycle trên critical path theo loại khối
+    int crit_unit;                         // loại khối chiếm nhiều nhất
+    int n_tasks;
+};
+
+extern const char* PM_UNIT_NAMES[PM_UNITS];
+extern const char* PM_KERNEL_NAMES[PM_KERNELS];
+
+// Cấu hình mặc định: level + knob theo macro lúc compile
+void pm_default_config(PmConfig& cfg);
+// "HW_KEM_NTT=2", "ML_KEM_LEVEL=1024", "KECCAK_LAT=26", ... -> false nếu không nhận ra
+bool pm_set(PmConfig& cfg, const char* assign);
+
+void pm_run(const PmConfig& cfg, PmKernel kernel, PmResult& res);
+// In bảng phase + critical path (verbose: in từng task trên critical path)
+void pm_print(const PmConfig& cfg, PmKernel kernel, const PmResult& res, bool verbose);
+
+// Fit các hằng số calibrate của cfg vào perf[] đo trên board (cùng level / knob),
+// trả về sai số tương đối trung bình trên các phase khác 0 sau khi fit.
+// Đánh dấu cfg.calibrated: chỉ gọi với perf[] đọc từ board, không phải từ pm_run.
+double pm_calibrate(PmConfig& cfg, PmKernel kernel, const unsigned long long measured[PERF_SLOTS]);
+
+#endif
@@ -66,4 +66,38 @@ const int16 EXP_FROM_MSG_OUT[5][256] = {
   {1665, 1665, 1665, 0, 1665, 1665, 1665, 1665, 0, 1665, 1665, 0, 1665, 0, 0, 1665, 0, 0, 1665, 0, 0, 1665, 1665, 1665, 0, 1665, 1665, 0, 0, 1665, 1665, 0, 0, 0, 0, 1665, 0, 0, 1665, 0, 1665, 1665, 0, 0, 0, 0, 1665, 1665, 0, 1665, 1665, 0, 0, 0, 0, 1665, 0, 0, 1665, 0, 0, 1665, 1665, 1665, 0, 0, 1665, 1665, 1665, 0, 1665, 0, 1665, 1665, 1665, 0, 0, 0, 0, 0, 0, 1665, 0, 1665, 0, 1665, 1665, 1665, 0, 1665, 0, 1665, 1665, 1665, 0, 0, 1665, 1665, 1665, 0, 1665, 0, 0, 0, 1665, 1665, 0, 0, 1665, 0, 0, 1665, 0, 0, 1665, 0, 1665, 0, 0, 1665, 1665, 0, 0, 1665, 1665, 0, 0, 0, 1665, 0, 1665, 1665, 0, 1665, 1665, 1665, 0, 0, 0, 1665, 0, 0, 1665, 0, 1665, 1665, 0, 1665, 1665, 0, 0, 0, 1665, 0, 1665, 0, 0, 0, 1665, 0, 0, 0, 1665, 0, 1665, 1665, 1665, 0, 1665, 1665, 1665, 1665, 0, 1665, 0, 0, 0, 0, 1665, 1665, 1665, 1665, 1665, 1665, 0, 0, 1665, 1665, 0, 1665, 1665, 1665, 0, 1665, 1665, 1665, 1665, 1665, 1665, 1665, 0, 0, 0, 0, 1665, 0, 1665, 1665, 0, 1665, 1665, 0, 1665, 1665, 1665, 0, 1665, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1665, 1665, 0, 1665, 1665, 1665, 0, 1665, 0, 1665, 0, 0, 0, 0, 0, 0, 0, 1665, 0, 0, 1665, 1665, 0, 1665, 1665, 1665, 0, 1665, 0, 0},
   {0, 0, 1665, 0, 0, 0, 1665, 1665, 1665, 1665, 0, 1665, 1665, 1665, 0, 1665, 1665, 0, 0, 0, 0, 1665, 0, 0, 0, 1665, 1665, 1665, 0, 1665, 1665, 1665, 1665, 0, 1665, 1665, 0, 1665, 0, 1665, 0, 0, 1665, 1665, 1665, 1665, 1665, 1665, 1665, 1665, 0, 0, 0, 0, 0, 1665, 1665, 1665, 1665, 0, 1665, 1665, 0, 0, 0, 0, 1665, 1665, 1665, 0, 1665, 0, 1665, 0, 1665, 0, 0, 0, 0, 1665, 1665, 0, 1665, 0, 1665, 1665, 1665, 1665, 0, 1665, 0, 1665, 1665, 0, 0, 1665, 0, 1665, 1665, 1665, 1665, 1665, 0, 0, 0, 0, 1665, 0, 1665, 0, 1665, 1665, 1665, 0, 1665, 1665, 1665, 1665, 0, 0, 1665, 1665, 1665, 1665, 1665, 1665, 1665, 0, 1665, 1665, 0, 1665, 1665, 1665, 0, 1665, 0, 1665, 1665, 1665, 0, 1665, 0, 1665, 1665, 1665, 0, 1665, 1665, 1665, 0, 0, 1665, 0, 0, 0, 1665, 0, 0, 0, 1665, 1665, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1665, 1665, 0, 1665, 1665, 0, 1665, 1665, 1665, 1665, 1665, 1665, 0, 1665, 1665, 1665, 1665, 0, 0, 1665, 1665, 0, 1665, 1665, 1665, 1665, 1665, 0, 1665, 1665, 0, 1665, 1665, 0, 1665, 1665, 1665, 1665, 1665, 1665, 1665, 1665, 0, 1665, 0, 0, 0, 1665, 0, 0, 1665, 1665, 1665, 0, 0, 0, 1665, 0, 1665, 1665, 0, 1665, 1665, 0, 1665, 1665, 0, 0, 1665, 1665, 0, 1665, 1665, 0, 1665, 1665, 0, 0, 1665, 0, 1665, 0, 0, 1665, 1665},
 };
+
+// ML-KEM-1024: du = 11, dv = 5
+const uint8 EXP_COMP_U11[5][352] = {
+  {137, 176, 200, 162, 64, 75, 250, 164, 244, 36, 189, 26, 0, 72, 82, 202, 194, 14, 126, 186, 181, 137, 62, 59, 64, 88, 88, 63, 107, 138, 64, 212, 222, 242, 180, 97, 72, 87, 204, 127, 113, 201, 5, 193, 237, 108, 8, 197, 45, 151, 78, 43, 214, 139, 170, 152, 93, 134, 174, 39, 153, 88, 212, 216, 101, 201, 166, 79, 166, 149, 43, 176, 169, 191, 22, 72, 104, 111, 91, 18, 110, 162, 254, 137, 55, 72, 64, 254, 18, 144, 81, 12, 210, 92, 219, 38, 182, 0, 158, 104, 93, 218, 9, 144, 10, 15, 6, 0, 218, 171, 243, 176, 169, 69, 84, 240, 40, 165, 124, 135, 64, 216, 76, 87, 228, 95, 231, 226, 250, 7, 112, 192, 100, 23, 224, 89, 203, 43, 3, 206, 124, 46, 209, 121, 97, 85, 158, 43, 103, 217, 65, 210, 110, 83, 176, 3, 112, 179, 84, 181, 214, 69, 151, 139, 60, 109, 21, 128, 106, 70, 198, 150, 212, 27, 200, 70, 233, 63, 200, 9, 131, 61, 164, 95, 247, 73, 228, 150, 209, 29, 148, 79, 97, 194, 109, 137, 143, 238, 84, 114, 47, 160, 10, 180, 61, 218, 79, 206, 75, 146, 231, 173, 192, 228, 200, 181, 172, 168, 132, 120, 124, 191, 197, 107, 31, 101, 47, 76, 30, 171, 210, 235, 196, 205, 32, 9, 121, 17, 166, 247, 36, 152, 11, 239, 148, 246, 107, 247, 68, 104, 239, 52, 96, 189, 49, 239, 180, 30, 211, 48, 192, 183, 100, 157, 183, 111, 36, 13, 112, 134, 9, 34, 148, 18, 187, 73, 145, 133, 41, 51, 34, 48, 169, 6, 205, 146, 156, 77, 131, 121, 116, 73, 90, 247, 134, 27, 73, 154, 144, 197, 214, 107, 50, 206, 255, 248, 208, 224, 90, 31, 50, 2, 23, 39, 48, 144, 63, 85, 0, 181, 188, 105, 44, 22, 225, 132, 132, 206, 208, 114, 230, 24, 224, 106, 217, 98, 248, 60, 112, 179, 226, 81, 206, 126, 216, 35, 127, 223, 68, 97, 23, 11},
+  {100, 240, 145, 21, 110, 193, 125, 182, 25, 192, 255, 247, 95, 172, 255, 188, 248, 148, 160, 118, 55, 171, 200, 145, 60, 137, 97, 108, 156, 35, 26, 94, 114, 103, 120, 92, 47, 143, 141, 54, 36, 203, 42, 191, 6, 156, 240, 28, 118, 87, 170, 127, 243, 29, 137, 175, 107, 133, 91, 251, 133, 47, 178, 218, 40, 178, 51, 108, 160, 118, 116, 40, 48, 248, 68, 102, 100, 1, 80, 62, 55, 232, 240, 10, 225, 45, 47, 114, 88, 242, 224, 0, 98, 145, 151, 133, 115, 34, 192, 93, 42, 182, 180, 56, 245, 31, 217, 33, 40, 141, 138, 170, 11, 170, 144, 82, 102, 39, 34, 210, 245, 161, 126, 31, 94, 41, 12, 128, 30, 59, 210, 34, 105, 70, 216, 224, 100, 151, 61, 179, 227, 253, 5, 8, 145, 86, 30, 161, 156, 217, 72, 112, 119, 40, 147, 93, 205, 7, 139, 106, 220, 192, 171, 88, 74, 101, 42, 252, 5, 215, 80, 166, 116, 100, 187, 46, 186, 249, 91, 140, 199, 60, 54, 169, 167, 100, 147, 205, 15, 138, 12, 55, 213, 14, 7, 246, 247, 123, 199, 33, 128, 52, 42, 247, 42, 20, 202, 133, 183, 33, 35, 251, 124, 105, 186, 34, 127, 154, 16, 208, 111, 60, 212, 153, 142, 32, 53, 237, 113, 66, 141, 229, 97, 78, 211, 207, 89, 222, 242, 76, 33, 180, 69, 187, 7, 64, 47, 182, 255, 69, 7, 14, 94, 102, 108, 235, 4, 152, 120, 2, 72, 214, 232, 188, 210, 92, 171, 178, 99, 139, 69, 19, 26, 48, 155, 180, 151, 110, 59, 137, 63, 26, 11, 168, 13, 5, 249, 85, 207, 17, 44, 156, 204, 100, 76, 246, 215, 182, 204, 57, 221, 219, 13, 216, 218, 152, 245, 62, 227, 202, 130, 195, 5, 245, 86, 43, 23, 212, 159, 47, 27, 213, 207, 162, 164, 19, 95, 195, 70, 32, 89, 215, 68, 145, 184, 203, 98, 225, 192, 138, 206, 97, 54, 37, 45, 60, 164, 48, 84, 211, 36, 235},
+  {232, 228, 169, 237, 57, 229, 4, 214, 176, 45, 199, 237, 33, 79, 121, 44, 224, 244, 247, 45, 133, 129, 48, 122, 141, 196, 250, 92, 78, 193, 55, 168, 65, 140, 38, 248, 251, 155, 252, 17, 225, 241, 252, 17, 117, 152, 139, 124, 173, 33, 192, 55, 142, 181, 41, 59, 47, 9, 150, 186, 150, 104, 51, 54, 203, 234, 85, 13, 103, 89, 16, 136, 61, 175, 127, 93, 142, 222, 227, 59, 236, 181, 103, 43, 51, 7, 80, 230, 218, 200, 243, 114, 21, 50, 177, 201, 231, 18, 133, 101, 60, 166, 71, 171, 178, 250, 102, 94, 167, 250, 44, 208, 224, 93, 85, 132, 88, 123, 89, 181, 226, 130, 151, 65, 13, 220, 151, 202, 190, 171, 108, 247, 18, 201, 115, 244, 193, 204, 109, 17, 130, 53, 237, 59, 27, 160, 182, 113, 8, 198, 55, 206, 93, 7, 196, 127, 128, 158, 86, 123, 245, 63, 185, 96, 116, 79, 98, 201, 150, 68, 43, 56, 196, 72, 202, 194, 13, 37, 3, 135, 134, 247, 36, 52, 242, 148, 124, 170, 235, 47, 92, 170, 178, 118, 167, 234, 110, 116, 175, 199, 196, 209, 151, 30, 52, 232, 84, 38, 150, 159, 115, 220, 70, 244, 144, 115, 160, 73, 74, 78, 238, 11, 102, 63, 28, 11, 170, 244, 126, 211, 210, 201, 109, 229, 141, 253, 124, 176, 59, 118, 74, 115, 84, 129, 228, 230, 189, 246, 148, 125, 118, 208, 140, 6, 8, 181, 70, 80, 64, 69, 20, 93, 233, 54, 111, 211, 202, 217, 116, 192, 40, 134, 33, 117, 47, 31, 155, 188, 135, 10, 100, 237, 175, 15, 52, 177, 13, 162, 237, 182, 143, 222, 160, 68, 67, 49, 150, 31, 217, 34, 100, 180, 136, 164, 13, 67, 118, 21, 3, 119, 255, 1, 236, 120, 221, 15, 34, 110, 93, 35, 159, 107, 36, 93, 218, 59, 192, 152, 24, 83, 25, 235, 123, 47, 105, 59, 23, 74, 230, 51, 156, 206, 127, 57, 1, 28, 41, 44, 203, 247, 85, 78},
+  {55, 31, 167, 140, 24, 203, 245, 104, 170, 138, 170, 15, 243, 51, 78, 43, 115, 70, 163, 246, 244, 177, 61, 87, 197, 91, 102, 200, 160, 84, 124, 2, 65, 223, 90, 138, 148, 240, 133, 40, 98, 168, 190, 230, 167, 17, 26, 145, 146, 84, 166, 50, 81, 145, 38, 88, 163, 137, 142, 0, 47, 11, 28, 95, 253, 86, 131, 195, 147, 169, 251, 237, 108, 81, 63, 160, 171, 178, 155, 142, 108, 156, 25, 20, 40, 233, 128, 240, 100, 192, 39, 95, 206, 18, 164, 169, 89, 250, 40, 2, 186, 153, 8, 148, 25, 3, 190, 192, 115, 38, 25, 158, 144, 245, 145, 39, 79, 152, 22, 101, 48, 142, 105, 29, 110, 234, 96, 41, 70, 118, 112, 229, 143, 226, 238, 167, 45, 77, 153, 175, 246, 110, 109, 56, 88, 116, 109, 217, 255, 62, 138, 35, 113, 161, 136, 79, 72, 105, 62, 228, 204, 102, 133, 84, 114, 212, 238, 228, 222, 166, 197, 206, 40, 108, 52, 187, 128, 221, 167, 212, 226, 237, 239, 40, 113, 54, 22, 194, 184, 145, 177, 75, 183, 228, 193, 45, 218, 166, 104, 147, 29, 113, 201, 13, 34, 75, 133, 160, 108, 71, 160, 74, 121, 117, 187, 230, 234, 208, 7, 185, 248, 180, 25, 145, 175, 0, 182, 154, 250, 17, 160, 200, 22, 89, 118, 129, 253, 206, 17, 183, 87, 207, 27, 85, 197, 213, 162, 26, 231, 15, 177, 232, 174, 99, 2, 156, 84, 184, 100, 28, 41, 88, 238, 41, 207, 107, 113, 187, 47, 218, 176, 217, 235, 132, 74, 125, 202, 243, 156, 161, 3, 22, 92, 105, 78, 59, 33, 56, 57, 199, 41, 158, 208, 100, 217, 250, 58, 191, 34, 145, 109, 235, 215, 210, 231, 171, 88, 104, 219, 90, 171, 201, 179, 230, 98, 14, 169, 208, 198, 11, 227, 28, 134, 224, 92, 42, 222, 104, 222, 202, 162, 246, 174, 181, 137, 236, 43, 34, 85, 50, 203, 73, 44, 181, 254, 204, 237, 110, 228, 153, 116, 128},
+  {4, 3, 169, 20, 142, 4, 27, 9, 19, 187, 199, 105, 117, 185, 65, 171, 36, 68, 160, 32, 249, 70, 131, 250, 86, 186, 179, 80, 190, 98, 109, 89, 237, 26, 145, 124, 34, 219, 169, 182, 200, 195, 109, 229, 102, 111, 154, 72, 116, 96, 62, 198, 106, 206, 151, 120, 194, 77, 186, 117, 164, 165, 99, 223, 20, 151, 14, 126, 45, 227, 86, 212, 251, 118, 128, 225, 46, 219, 235, 219, 133, 14, 172, 194, 90, 123, 81, 215, 153, 100, 60, 1, 71, 219, 3, 244, 245, 106, 140, 5, 203, 195, 224, 8, 110, 76, 226, 186, 191, 179, 172, 24, 34, 84, 214, 212, 17, 74, 207, 174, 74, 52, 194, 122, 128, 16, 204, 91, 200, 14, 204, 226, 85, 150, 11, 180, 32, 38, 112, 83, 88, 162, 202, 251, 213, 201, 166, 123, 23, 107, 167, 131, 224, 170, 187, 134, 135, 74, 27, 189, 217, 50, 237, 204, 141, 57, 80, 118, 207, 197, 51, 123, 251, 211, 91, 76, 92, 180, 61, 53, 148, 118, 1, 54, 156, 7, 160, 197, 55, 187, 89, 170, 82, 196, 221, 5, 195, 40, 0, 242, 253, 25, 11, 129, 232, 59, 36, 55, 193, 204, 147, 76, 21, 83, 123, 166, 156, 210, 251, 9, 89, 200, 171, 183, 173, 0, 222, 55, 252, 106, 147, 80, 41, 60, 137, 145, 171, 165, 149, 47, 47, 51, 205, 220, 109, 28, 24, 144, 195, 99, 224, 113, 136, 101, 213, 130, 115, 27, 51, 91, 33, 106, 249, 165, 129, 117, 172, 138, 19, 31, 87, 39, 29, 31, 148, 112, 85, 96, 205, 6, 246, 135, 252, 111, 211, 71, 119, 36, 254, 107, 34, 71, 138, 194, 243, 190, 126, 230, 27, 176, 51, 6, 42, 177, 61, 235, 186, 130, 178, 40, 67, 131, 163, 171, 187, 219, 212, 77, 33, 60, 150, 93, 177, 162, 106, 199, 242, 78, 15, 76, 28, 154, 29, 216, 135, 3, 203, 191, 172, 20, 99, 158, 70, 32, 70, 134, 137, 196, 116, 61, 51, 167}
+};
+
+const int16 EXP_DECOMP_U11[5][256] = {
+  {223, 452, 1058, 2341, 3179, 535, 515, 2459, 42, 416, 535, 580, 384, 2074, 2259, 1790, 1349, 11, 574, 3192, 2788, 449, 2107, 2897, 2058, 1752, 2134, 2567, 3322, 1200, 601, 2510, 2050, 437, 2945, 1492, 2043, 1804, 1230, 2217, 2328, 330, 2799, 1903, 2303, 689, 608, 2619, 3183, 1991, 2637, 34, 1084, 2287, 840, 1356, 1429, 954, 715, 3045, 258, 180, 29, 3306, 29, 914, 80, 2667, 2375, 1790, 73, 2055, 2250, 1370, 63, 2198, 390, 20, 2705, 2233, 395, 2168, 452, 68, 1065, 536, 779, 839, 2016, 1211, 3149, 1533, 2572, 3311, 1666, 2502, 3075, 1668, 2248, 2453, 81, 670, 1507, 2719, 613, 1112, 2693, 1491, 2324, 1877, 1541, 1084, 1534, 2497, 1165, 1109, 2255, 2723, 1204, 787, 2258, 3, 692, 1305, 592, 3188, 842, 920, 3292, 428, 1728, 2810, 941, 2807, 1035, 2968, 660, 1551, 2627, 271, 1726, 1188, 1616, 3101, 969, 2467, 1040, 840, 1604, 3205, 1487, 985, 3150, 2386, 1252, 1850, 1398, 561, 484, 1567, 3114, 297, 2365, 1065, 1232, 1912, 1156, 2739, 2046, 715, 1877, 1879, 454, 3036, 515, 1978, 2931, 1087, 3267, 1543, 1793, 2835, 2177, 1250, 723, 2454, 1175, 649, 1270, 3121, 489, 2046, 3210, 1894, 85, 1339, 247, 111, 1933, 2432, 535, 289, 1934, 457, 1252, 2214, 1354, 1908, 2334, 171, 790, 1967, 2347, 2467, 2862, 949, 250, 289, 3061, 502, 2033, 831, 1765, 2923, 3059, 2606, 1678, 1474, 1252, 2965, 2209, 3, 1959, 2170, 288, 226, 127, 2095, 1747, 1492, 374, 1669, 2359, 592, 3131, 197, 2022, 2947, 2628, 3266, 3071, 3149, 2482, 1055, 2432, 143},
+  {163, 933, 140, 297, 3270, 1424, 10, 3326, 3314, 2307, 1661, 1817, 545, 2186, 2440, 2225, 741, 3150, 2555, 2575, 738, 1780, 3131, 1486, 167, 1481, 1972, 2820, 1417, 2614, 1122, 2485, 1674, 2528, 187, 1552, 1100, 2911, 3114, 1782, 1533, 281, 2259, 1243, 1235, 2243, 920, 2316, 1747, 1686, 770, 1759, 1252, 806, 652, 1305, 2, 3241, 358, 189, 284, 1564, 1578, 1484, 975, 1713, 5, 288, 613, 2931, 254, 2498, 983, 2817, 1174, 1086, 831, 1538, 845, 1835, 1057, 606, 1105, 533, 2661, 1791, 1886, 3196, 2758, 1637, 2276, 2529, 0, 2596, 1895, 452, 2667, 1261, 1461, 1538, 1601, 3079, 3108, 76, 429, 1174, 1861, 2627, 2329, 236, 2438, 525, 2320, 694, 1715, 2193, 2402, 3123, 2565, 966, 996, 3129, 1702, 174, 996, 379, 2849, 606, 718, 1455, 2576, 2658, 1409, 3046, 483, 1916, 3246, 522, 1746, 1084, 385, 1687, 2492, 1611, 740, 7, 341, 1491, 1117, 1730, 601, 2386, 1302, 3075, 2476, 2165, 902, 2077, 1726, 2705, 1845, 1052, 1000, 115, 1382, 1603, 254, 1837, 788, 748, 3038, 2040, 2453, 788, 135, 2342, 1361, 401, 2081, 1286, 3321, 2723, 1458, 1222, 1830, 2258, 31, 1788, 63, 1899, 918, 2456, 2006, 2255, 2825, 2368, 1808, 1726, 1674, 2017, 3205, 2422, 2050, 3231, 681, 36, 1421, 65, 2485, 796, 115, 2533, 1991, 327, 2320, 2807, 1960, 3006, 3101, 2882, 2289, 710, 2246, 818, 1201, 145, 2936, 1044, 2261, 2637, 2089, 2077, 1325, 1097, 1351, 964, 510, 2806, 702, 419, 3058, 250, 944, 2438, 2568, 731, 1118, 2685, 2654, 1934, 293, 881, 1265, 2770, 501, 3058},
+  {2042, 2178, 3209, 1086, 127, 696, 1424, 2589, 801, 787, 788, 36, 3040, 1637, 538, 1684, 910, 701, 1278, 2700, 2037, 3124, 853, 853, 2724, 2919, 3301, 2622, 467, 1564, 3010, 232, 190, 603, 2474, 348, 1668, 1845, 2242, 541, 3009, 476, 975, 1400, 2719, 1830, 1165, 3053, 2219, 2030, 580, 1678, 1599, 3066, 3067, 1850, 1609, 3114, 3199, 1603, 1128, 2663, 1666, 2994, 354, 2693, 2411, 432, 1279, 3152, 1965, 1730, 1829, 1988, 2129, 554, 3191, 1998, 766, 3259, 72, 1707, 2274, 901, 2302, 1232, 2220, 2947, 3124, 81, 86, 1635, 1939, 3116, 1317, 3217, 445, 2693, 3253, 2653, 2854, 1720, 2237, 3084, 1344, 1669, 2851, 1756, 1821, 1845, 3100, 94, 3231, 24, 1031, 2359, 3054, 1039, 75, 1513, 961, 488, 980, 2344, 1460, 637, 1070, 2533, 2102, 163, 878, 1565, 961, 1834, 2178, 1619, 1525, 2492, 598, 554, 3087, 2207, 1551, 1513, 3197, 247, 3028, 3035, 1354, 754, 658, 1952, 1507, 1479, 460, 198, 3006, 1352, 1070, 1018, 1635, 1978, 411, 2311, 1092, 2459, 2027, 2741, 2407, 1946, 2586, 2702, 1260, 1858, 1087, 1499, 553, 1899, 3165, 1401, 545, 2072, 1712, 1830, 10, 2758, 458, 65, 1801, 897, 974, 714, 1429, 562, 1416, 94, 1060, 1268, 2198, 616, 1299, 3152, 881, 840, 2845, 3067, 2086, 2303, 853, 2373, 2853, 3028, 853, 2719, 1795, 1952, 467, 1812, 650, 1811, 949, 2541, 2315, 278, 2918, 3300, 11, 1856, 2430, 1715, 1469, 1214, 2970, 2268, 1900, 2155, 1556, 624, 2559, 1079, 1289, 3116, 1972, 2373, 603, 1905, 2069, 2030, 3248, 2989, 7, 1895, 1148, 3157, 2284, 1018},
+  {3002, 2033, 914, 2308, 3062, 2004, 1109, 2217, 1273, 2702, 2172, 658, 1832, 2194, 2180, 2313, 3012, 276, 597, 1747, 852, 275, 258, 845, 1195, 538, 966, 1235, 1053, 319, 3189, 2999, 688, 1356, 943, 951, 996, 996, 1801, 501, 1391, 501, 927, 3121, 289, 2588, 3054, 1130, 1461, 1027, 2767, 2908, 2832, 2760, 24, 2232, 1538, 759, 705, 1999, 522, 962, 94, 3127, 163, 2068, 618, 584, 938, 1383, 2741, 532, 836, 1338, 55, 1993, 80, 618, 2055, 499, 2537, 863, 3261, 1573, 2058, 2159, 528, 629, 647, 1530, 715, 190, 1076, 1892, 1712, 2983, 1065, 2438, 2755, 2741, 657, 2235, 1556, 1422, 91, 2723, 2375, 3296, 1637, 2945, 1782, 2099, 3134, 431, 684, 883, 1999, 1165, 2134, 1486, 2841, 1920, 1448, 1175, 2048, 132, 2125, 2433, 2289, 2072, 1382, 2888, 2910, 964, 2334, 288, 315, 922, 2819, 1517, 2619, 1461, 2723, 2168, 1417, 1538, 2399, 2867, 884, 1076, 54, 1413, 115, 553, 2453, 2383, 2671, 762, 813, 2406, 2068, 1336, 2607, 141, 1404, 2167, 1869, 2081, 2822, 1304, 2433, 2809, 2053, 2554, 2466, 2695, 2125, 276, 1390, 2212, 2680, 883, 904, 2274, 993, 1456, 549, 982, 738, 133, 1492, 545, 1585, 2570, 2882, 2118, 1270, 3204, 510, 969, 1035, 2693, 2684, 754, 572, 1131, 1499, 770, 54, 2976, 2958, 2945, 2095, 1159, 2793, 766, 1143, 891, 2376, 1647, 2154, 3249, 2565, 1356, 1188, 2255, 2975, 1393, 2572, 878, 1733, 2585, 1266, 1502, 871, 2679, 1100, 722, 3163, 2637, 2760, 2441, 2845, 2607, 1141, 943, 1907, 2641, 1783, 2765, 1655, 2871, 2884, 1573, 2142, 1669},
+  {1255, 2133, 133, 948, 702, 2526, 2815, 2596, 2251, 2988, 2090, 970, 1772, 520, 2614, 922, 1045, 1195, 2875, 145, 1621, 1152, 2645, 3085, 458, 3150, 1887, 2050, 1421, 3149, 1430, 2983, 3079, 1374, 471, 94, 1622, 2308, 1499, 1973, 1027, 715, 2875, 927, 979, 2820, 2170, 1964, 2520, 2365, 1476, 902, 3220, 385, 156, 610, 1604, 1452, 870, 2508, 1733, 2791, 1817, 2799, 1913, 3140, 1671, 2346, 99, 1625, 1139, 1825, 1257, 197, 1461, 2919, 1986, 2399, 3300, 2336, 280, 1773, 546, 1006, 463, 2737, 1539, 970, 917, 3056, 834, 2510, 2386, 2315, 1253, 2949, 2635, 601, 1170, 1274, 2916, 270, 244, 2635, 2489, 510, 2749, 1556, 2784, 3040, 52, 2222, 2801, 390, 2149, 2726, 2333, 996, 1344, 1843, 93, 2825, 3012, 783, 3204, 3313, 2893, 992, 1814, 3209, 345, 1369, 37, 176, 792, 2081, 3233, 3079, 582, 554, 1777, 1552, 314, 530, 832, 3222, 1832, 216, 2718, 193, 2407, 2511, 1580, 653, 1803, 2355, 1000, 2173, 2893, 128, 145, 2277, 2858, 140, 2445, 180, 1143, 1916, 546, 3129, 2555, 2406, 979, 2983, 1578, 665, 1998, 2385, 184, 20, 1757, 323, 1860, 1773, 2245, 146, 2415, 645, 2372, 1772, 2643, 2157, 2290, 2311, 2565, 3136, 2264, 959, 3236, 1925, 2263, 1681, 1335, 1253, 206, 3318, 2020, 933, 1858, 3231, 701, 1484, 267, 3129, 3218, 1647, 1622, 2502, 335, 2086, 1278, 2697, 2799, 1699, 289, 164, 2518, 2420, 1551, 714, 1439, 432, 2594, 1538, 1152, 2212, 1856, 2453, 1591, 988, 878, 1539, 3069, 733, 1951, 623, 2151, 1287, 2754, 1678, 455, 1981, 1782, 1211, 2001, 2173}
+};
+
+const uint8 EXP_COMP_V5[5][160] = {
+  {130, 168, 251, 75, 193, 128, 20, 67, 168, 141, 13, 152, 191, 9, 229, 52, 214, 12, 152, 193, 148, 112, 71, 35, 171, 118, 108, 105, 143, 201, 127, 102, 160, 44, 106, 46, 157, 46, 4, 0, 32, 5, 125, 99, 160, 182, 133, 74, 128, 174, 164, 146, 160, 202, 65, 147, 249, 151, 1, 196, 30, 90, 28, 140, 211, 102, 105, 103, 229, 83, 15, 175, 101, 53, 67, 22, 156, 102, 62, 74, 128, 196, 157, 182, 234, 230, 229, 17, 23, 244, 9, 43, 244, 190, 75, 254, 50, 217, 74, 121, 126, 92, 197, 228, 210, 244, 72, 73, 122, 153, 92, 253, 23, 119, 101, 7, 47, 195, 124, 161, 95, 134, 38, 194, 188, 101, 76, 194, 106, 147, 86, 160, 121, 49, 79, 98, 244, 66, 81, 228, 61, 67, 199, 122, 5, 179, 14, 17, 104, 116, 4, 94, 227, 197, 228, 249, 123, 143, 213, 13},
+  {34, 133, 241, 29, 0, 192, 194, 88, 234, 173, 199, 231, 124, 162, 119, 194, 205, 237, 242, 194, 16, 139, 183, 184, 143, 111, 88, 198, 108, 178, 17, 158, 200, 144, 105, 224, 15, 49, 222, 115, 9, 130, 97, 184, 192, 105, 47, 133, 30, 146, 202, 172, 162, 163, 252, 27, 90, 12, 178, 36, 154, 185, 247, 188, 15, 100, 201, 108, 197, 45, 246, 192, 122, 125, 78, 202, 67, 161, 200, 54, 199, 101, 237, 122, 145, 191, 68, 69, 32, 126, 7, 12, 183, 162, 185, 205, 227, 154, 104, 212, 82, 169, 208, 158, 144, 232, 116, 138, 81, 184, 141, 80, 6, 180, 99, 210, 130, 24, 100, 194, 211, 238, 27, 35, 156, 255, 210, 127, 128, 11, 24, 5, 60, 135, 221, 179, 123, 110, 143, 69, 44, 112, 101, 51, 165, 109, 181, 84, 246, 33, 93, 164, 155, 207, 210, 122, 14, 196, 118, 233},
+  {180, 126, 21, 142, 203, 8, 33, 208, 97, 129, 233, 48, 77, 61, 66, 154, 131, 76, 94, 23, 194, 224, 1, 165, 45, 189, 164, 166, 229, 234, 149, 26, 248, 122, 151, 207, 255, 183, 52, 236, 67, 95, 194, 252, 140, 114, 210, 242, 231, 249, 1, 218, 100, 89, 229, 62, 4, 56, 125, 251, 68, 255, 188, 163, 245, 13, 238, 24, 165, 15, 31, 168, 219, 85, 120, 169, 164, 235, 140, 194, 84, 160, 151, 100, 133, 15, 155, 226, 235, 123, 95, 244, 222, 142, 153, 206, 17, 209, 155, 82, 112, 18, 171, 240, 212, 119, 102, 205, 164, 114, 69, 250, 86, 40, 148, 96, 147, 16, 83, 58, 174, 184, 160, 88, 53, 204, 35, 180, 59, 181, 232, 238, 142, 116, 156, 36, 154, 152, 176, 29, 28, 0, 121, 161, 99, 221, 202, 250, 76, 86, 204, 207, 107, 36, 165, 191, 3, 185, 188, 85},
+  {157, 38, 219, 231, 170, 76, 87, 35, 107, 181, 125, 152, 136, 134, 64, 171, 36, 166, 198, 239, 167, 165, 164, 84, 44, 173, 36, 63, 114, 95, 78, 109, 190, 55, 168, 239, 156, 89, 82, 240, 130, 26, 147, 154, 46, 168, 133, 25, 12, 45, 24, 253, 71, 107, 49, 230, 29, 161, 36, 236, 234, 106, 109, 234, 115, 65, 95, 0, 121, 164, 158, 28, 52, 87, 117, 91, 186, 69, 3, 189, 150, 54, 206, 147, 29, 35, 237, 151, 157, 174, 238, 93, 142, 84, 112, 161, 224, 171, 15, 186, 180, 229, 224, 170, 164, 187, 221, 77, 51, 214, 116, 180, 170, 81, 178, 202, 149, 116, 130, 43, 47, 115, 202, 126, 73, 74, 235, 83, 150, 59, 161, 115, 78, 215, 62, 43, 93, 88, 127, 110, 203, 246, 150, 81, 204, 204, 33, 189, 142, 207, 251, 238, 188, 146, 204, 113, 67, 206, 95, 133},
+  {140, 134, 116, 240, 206, 182, 211, 20, 75, 78, 106, 241, 0, 87, 246, 196, 75, 234, 188, 235, 190, 149, 0, 173, 155, 234, 240, 148, 118, 157, 248, 186, 244, 73, 48, 207, 33, 28, 119, 220, 210, 195, 27, 224, 146, 76, 56, 62, 47, 176, 35, 22, 69, 244, 75, 169, 35, 124, 45, 227, 217, 44, 198, 135, 200, 184, 232, 183, 59, 168, 155, 84, 109, 85, 147, 97, 119, 244, 1, 87, 241, 143, 6, 4, 162, 223, 155, 18, 223, 40, 232, 75, 161, 197, 197, 207, 196, 171, 42, 15, 193, 238, 128, 197, 146, 197, 231, 155, 250, 51, 243, 10, 16, 135, 140, 54, 92, 115, 99, 174, 214, 102, 111, 211, 151, 22, 54, 38, 192, 76, 242, 31, 55, 252, 135, 16, 15, 202, 244, 134, 67, 224, 251, 142, 35, 249, 173, 42, 241, 83, 232, 249, 51, 77, 101, 26, 146, 25, 217, 172}
+};
+
+const int16 EXP_DECOMP_V5[5][256] = {
+  {208, 416, 1040, 2393, 3225, 520, 520, 2497, 0, 416, 520, 624, 416, 2081, 2289, 1769, 1352, 0, 624, 3225, 2809, 416, 2081, 2913, 2081, 1769, 2185, 2601, 0, 1248, 624, 2497, 2081, 416, 2913, 1456, 2081, 1769, 1248, 2185, 2289, 312, 2809, 1873, 2289, 728, 624, 2601, 3225, 1977, 2601, 0, 1040, 2289, 832, 1352, 1456, 936, 728, 3017, 208, 208, 0, 0, 0, 936, 104, 2705, 2393, 1769, 104, 2081, 2289, 1352, 104, 2185, 416, 0, 2705, 2185, 416, 2185, 416, 104, 1040, 520, 728, 832, 1977, 1248, 3121, 1560, 2601, 0, 1665, 2497, 3121, 1665, 2289, 2497, 104, 624, 1456, 2705, 624, 1144, 2705, 1456, 2289, 1873, 1560, 1040, 1560, 2497, 1144, 1144, 2289, 2705, 1248, 832, 2289, 0, 728, 1352, 624, 3225, 832, 936, 0, 416, 1769, 2809, 936, 2809, 1040, 3017, 624, 1560, 2601, 312, 1769, 1144, 1665, 3121, 936, 2497, 1040, 832, 1560, 3225, 1456, 936, 3121, 2393, 1248, 1873, 1352, 520, 520, 1560, 3121, 312, 2393, 1040, 1248, 1873, 1144, 2705, 2081, 728, 1873, 1873, 416, 3017, 520, 1977, 2913, 1040, 3225, 1560, 1769, 2809, 2185, 1248, 728, 2497, 1144, 624, 1248, 3121, 520, 2081, 3225, 1873, 104, 1352, 208, 104, 1977, 2393, 520, 312, 1977, 416, 1248, 2185, 1352, 1873, 2289, 208, 832, 1977, 2393, 2497, 2913, 936, 208, 312, 3017, 520, 2081, 832, 1769, 2913, 3017, 2601, 1665, 1456, 1248, 3017, 2185, 0, 1977, 2185, 312, 208, 104, 2081, 1769, 1456, 416, 1665, 2393, 624, 3121, 208, 1977, 2913, 2601, 3225, 3121, 3121, 2497, 1040, 2393, 104},
+  {208, 936, 104, 312, 3225, 1456, 0, 0, 0, 2289, 1665, 1769, 520, 2185, 2393, 2185, 728, 3121, 2601, 2601, 728, 1769, 3121, 1456, 208, 1456, 1977, 2809, 1456, 2601, 1144, 2497, 1665, 2497, 208, 1560, 1144, 2913, 3121, 1769, 1560, 312, 2289, 1248, 1248, 2289, 936, 2289, 1769, 1665, 728, 1769, 1248, 832, 624, 1352, 0, 3225, 312, 208, 312, 1560, 1560, 1456, 936, 1665, 0, 312, 624, 2913, 208, 2497, 936, 2809, 1144, 1040, 832, 1560, 832, 1873, 1040, 624, 1144, 520, 2705, 1769, 1873, 3225, 2809, 1665, 2289, 2497, 0, 2601, 1873, 416, 2705, 1248, 1456, 1560, 1560, 3121, 3121, 104, 416, 1144, 1873, 2601, 2289, 208, 2393, 520, 2289, 728, 1665, 2185, 2393, 3121, 2601, 936, 1040, 3121, 1665, 208, 1040, 416, 2809, 624, 728, 1456, 2601, 2705, 1456, 3017, 520, 1873, 3225, 520, 1769, 1040, 416, 1665, 2497, 1560, 728, 0, 312, 1456, 1144, 1769, 624, 2393, 1352, 3121, 2497, 2185, 936, 2081, 1769, 2705, 1873, 1040, 1040, 104, 1352, 1560, 208, 1873, 832, 728, 3017, 2081, 2497, 832, 104, 2393, 1352, 416, 2081, 1248, 0, 2705, 1456, 1248, 1873, 2289, 0, 1769, 104, 1873, 936, 2497, 1977, 2289, 2809, 2393, 1769, 1769, 1665, 1977, 3225, 2393, 2081, 3225, 728, 0, 1456, 104, 2497, 832, 104, 2497, 1977, 312, 2289, 2809, 1977, 3017, 3121, 2913, 2289, 728, 2289, 832, 1248, 104, 2913, 1040, 2289, 2601, 2081, 2081, 1352, 1144, 1352, 936, 520, 2809, 728, 416, 3017, 208, 936, 2393, 2601, 728, 1144, 2705, 2705, 1977, 312, 832, 1248, 2809, 520, 3017},
+  {2081, 2185, 3225, 1040, 104, 728, 1456, 2601, 832, 832, 832, 0, 3017, 1665, 520, 1665, 936, 728, 1248, 2705, 2081, 3121, 832, 832, 2705, 2913, 0, 2601, 416, 1560, 3017, 208, 208, 624, 2497, 312, 1665, 1873, 2289, 520, 3017, 520, 936, 1352, 2705, 1873, 1144, 3017, 2185, 2081, 624, 1665, 1560, 3017, 3017, 1873, 1560, 3121, 3225, 1560, 1144, 2705, 1665, 3017, 312, 2705, 2393, 416, 1248, 3121, 1977, 1769, 1873, 1977, 2081, 520, 3225, 1977, 728, 3225, 104, 1665, 2289, 936, 2289, 1248, 2185, 2913, 3121, 104, 104, 1665, 1977, 3121, 1352, 3225, 416, 2705, 3225, 2601, 2809, 1769, 2289, 3121, 1352, 1665, 2809, 1769, 1769, 1873, 3121, 104, 3225, 0, 1040, 2393, 3017, 1040, 104, 1560, 936, 520, 936, 2393, 1456, 624, 1040, 2497, 2081, 208, 832, 1560, 936, 1873, 2185, 1665, 1560, 2497, 624, 520, 3121, 2185, 1560, 1560, 3225, 208, 3017, 3017, 1352, 728, 624, 1977, 1456, 1456, 416, 208, 3017, 1352, 1040, 1040, 1665, 1977, 416, 2289, 1040, 2497, 1977, 2705, 2393, 1977, 2601, 2705, 1248, 1873, 1040, 1456, 520, 1873, 3121, 1352, 520, 2081, 1665, 1873, 0, 2809, 416, 104, 1769, 936, 936, 728, 1456, 520, 1456, 104, 1040, 1248, 2185, 624, 1248, 3121, 832, 832, 2809, 3017, 2081, 2289, 832, 2393, 2809, 3017, 832, 2705, 1769, 1977, 416, 1769, 624, 1769, 936, 2497, 2289, 312, 2913, 0, 0, 1873, 2393, 1665, 1456, 1248, 3017, 2289, 1873, 2185, 1560, 624, 2601, 1040, 1248, 3121, 1977, 2393, 624, 1873, 2081, 2081, 3225, 3017, 0, 1873, 1144, 3121, 2289, 1040},
+  {3017, 2081, 936, 2289, 3017, 1977, 1144, 2185, 1248, 2705, 2185, 624, 1873, 2185, 2185, 2289, 3017, 312, 624, 1769, 832, 312, 208, 832, 1144, 520, 936, 1248, 1040, 312, 3225, 3017, 728, 1352, 936, 936, 1040, 1040, 1769, 520, 1352, 520, 936, 3121, 312, 2601, 3017, 1144, 1456, 1040, 2809, 2913, 2809, 2809, 0, 2185, 1560, 728, 728, 1977, 520, 936, 104, 3121, 208, 2081, 624, 624, 936, 1352, 2705, 520, 832, 1352, 104, 1977, 104, 624, 2081, 520, 2497, 832, 3225, 1560, 2081, 2185, 520, 624, 624, 1560, 728, 208, 1040, 1873, 1665, 3017, 1040, 2393, 2705, 2705, 624, 2185, 1560, 1456, 104, 2705, 2393, 0, 1665, 2913, 1769, 2081, 3121, 416, 728, 832, 1977, 1144, 2185, 1456, 2809, 1873, 1456, 1144, 2081, 104, 2081, 2393, 2289, 2081, 1352, 2913, 2913, 936, 2289, 312, 312, 936, 2809, 1560, 2601, 1456, 2705, 2185, 1456, 1560, 2393, 2913, 832, 1040, 104, 1456, 104, 520, 2497, 2393, 2705, 728, 832, 2393, 2081, 1352, 2601, 104, 1456, 2185, 1873, 2081, 2809, 1352, 2393, 2809, 2081, 2601, 2497, 2705, 2081, 312, 1352, 2185, 2705, 832, 936, 2289, 1040, 1456, 520, 936, 728, 104, 1456, 520, 1560, 2601, 2913, 2081, 1248, 3225, 520, 936, 1040, 2705, 2705, 728, 520, 1144, 1456, 728, 104, 3017, 2913, 2913, 2081, 1144, 2809, 728, 1144, 936, 2393, 1665, 2185, 3225, 2601, 1352, 1144, 2289, 3017, 1352, 2601, 832, 1769, 2601, 1248, 1456, 832, 2705, 1144, 728, 3121, 2601, 2809, 2393, 2809, 2601, 1144, 936, 1873, 2601, 1769, 2809, 1665, 2913, 2913, 1560, 2185, 1665},
+  {1248, 2081, 104, 936, 728, 2497, 2809, 2601, 2289, 3017, 2081, 936, 1769, 520, 2601, 936, 1040, 1144, 2913, 104, 1665, 1144, 2601, 3121, 416, 3121, 1873, 2081, 1456, 3121, 1456, 3017, 3121, 1352, 520, 104, 1665, 2289, 1456, 1977, 1040, 728, 2913, 936, 936, 2809, 2185, 1977, 2497, 2393, 1456, 936, 3225, 416, 104, 624, 1560, 1456, 832, 2497, 1769, 2809, 1769, 2809, 1873, 3121, 1665, 2393, 104, 1665, 1144, 1873, 1248, 208, 1456, 2913, 1977, 2393, 0, 2289, 312, 1769, 520, 1040, 416, 2705, 1560, 936, 936, 3017, 832, 2497, 2393, 2289, 1248, 2913, 2601, 624, 1144, 1248, 2913, 312, 208, 2601, 2497, 520, 2705, 1560, 2809, 3017, 0, 2185, 2809, 416, 2185, 2705, 2289, 1040, 1352, 1873, 104, 2809, 3017, 832, 3225, 0, 2913, 1040, 1769, 3225, 312, 1352, 0, 208, 832, 2081, 3225, 3121, 624, 520, 1769, 1560, 312, 520, 832, 3225, 1873, 208, 2705, 208, 2393, 2497, 1560, 624, 1769, 2393, 1040, 2185, 2913, 104, 104, 2289, 2809, 104, 2497, 208, 1144, 1873, 520, 3121, 2601, 2393, 936, 3017, 1560, 624, 1977, 2393, 208, 0, 1769, 312, 1873, 1769, 2289, 104, 2393, 624, 2393, 1769, 2601, 2185, 2289, 2289, 2601, 3121, 2289, 936, 3225, 1873, 2289, 1665, 1352, 1248, 208, 0, 1977, 936, 1873, 3225, 728, 1456, 312, 3121, 3225, 1665, 1665, 2497, 312, 2081, 1248, 2705, 2809, 1665, 312, 208, 2497, 2393, 1560, 728, 1456, 416, 2601, 1560, 1144, 2185, 1873, 2497, 1560, 1040, 832, 1560, 3121, 728, 1977, 624, 2185, 1248, 2705, 1665, 416, 1977, 1769, 1248, 1977, 2185}
+};
+
 #endif
@@ -0,0 +1,136 @@
+#ifndef POLY_OPS_H
+#define POLY_OPS_H
+
+#include "params.h"
+#include "hls_vector.h"
+
+// =========================================================
+// POLY OPS: CỘNG / TRỪ / CỘNG DỒN / CHUẨN HOÁ THEO LANE
+// =========================================================
+// L hệ số / vòng (hls::vector L lane), II=1, latency cố định: mọi phép
+// dùng chung 1 lần Barrett + 1 lần trừ có điều kiện, không còn vòng while.
+// L nên bằng cyclic factor của mảng (HW_POLY_PART): mỗi bank 1 đọc + 1 ghi
+// / chu kỳ nên gọi in-place (r trùng a) vẫn giữ II=1.
+//
+// Đầu vào: int16 bất kỳ có |tổng các toán hạng| < 2^16 (hệ số [0, Q),
+// nhiễu CBD âm, ...). Đầu ra luôn ở [0, Q).
+
+typedef ap_int<18> poly_wide_t;   // tổng tối đa 5 toán hạng int16 chưa reduce
+
+template <int L>
+struct poly_lane {
+    typedef hls::vector<poly_wide_t, L> type;
+};
+
+// Đọc / ghi L hệ số liên tiếp (cùng 1 hàng của L bank)
+template <int L>
+typename poly_lane<L>::type poly_load(const int16 a[KYBER_N], int i) {
+    #pragma HLS INLINE
+    typename poly_lane<L>::type v;
+    for (int l = 0; l < L; l++) {
+        #pragma HLS UNROLL
+        v[l] = (poly_wide_t)a[i * L + l];
+    }
+    return v;
+}
+
+// x thuộc (-20Q, 2^18 - 20Q) -> [0, Q)
+// Cộng 20Q cho x >= 0, Barrett 2^26/Q với x < 2^18 sai tối đa 1 lần Q
+inline int16 poly_reduce_wide(poly_wide_t x) {
+    #pragma HLS INLINE
+    ap_uint<18> xp = (ap_uint<18>)(x + 20 * KYBER_Q);
+    ap_uint<15> t = (ap_uint<15>)(((ap_uint<34>)xp * 20158) >> 26);
+    ap_uint<13> r = (ap_uint<13>)(xp - (ap_uint<18>)(t * KYBER_Q));
+    if (r >= KYBER_Q) r -= KYBER_Q;
+    return (int16)r;
+}
+
+template <int L>
+void poly_store(int16 r[KYBER_N], int i, const typename poly_lane<L>::type& v) {
+    #pragma HLS INLINE
+    for (int l = 0; l < L; l++) {
+        #pragma HLS UNROLL
+        r[i * L + l] = poly_reduce_wide(v[l]);
+    }
+}
+
+// r = a + b mod Q
+template <int L>
+void poly_add(const int16 a[KYBER_N], const int16 b[KYBER_N], int16 r[KYBER_N]) {
+    #pragma HLS INLINE
+    static_assert(KYBER_N % L == 0, "L must divide 256");
+    Poly_Add_Loop: for (int i = 0; i < KYBER_N / L; i++) {
+        #pragma HLS PIPELINE II=1
+        poly_store<L>(r, i, poly_load<L>(a, i) + poly_load<L>(b, i));
+    }
+}
+
+// r = a - b mod Q
+template <int L>
+void poly_sub(const int16 a[KYBER_N], const int16 b[KYBER_N], int16 r[KYBER_N]) {
+    #pragma HLS INLINE
+    static_assert(KYBER_N % L == 0, "L must divide 256");
+    Poly_Sub_Loop: for (int i = 0; i < KYBER_N / L; i++) {
+        #pragma HLS PIPELINE II=1
+        poly_store<L>(r, i, poly_load<L>(a, i) - poly_load<L>(b, i));
+    }
+}
+
+// r = a + b + c mod Q (vd v + e2 + m), 1 lần reduce
+template <int L>
+void poly_add3(const int16 a[KYBER_N], const int16 b[KYBER_N], const int16 c[KYBER_N],
+               int16 r[KYBER_N]) {
+    #pragma HLS INLINE
+    static_assert(KYBER_N % L == 0, "L must divide 256");
+    Poly_Add3_Loop: for (int i = 0; i < KYBER_N / L; i++) {
+        #pragma HLS PIPELINE II=1
+        poly_store<L>(r, i, poly_load<L>(a, i) + poly_load<L>(b, i) + poly_load<L>(c, i));
+    }
+}
+
+// r = init + sum_j src[j] mod Q (cộng dồn M tích basemul), 1 lần reduce
+template <int L, int M>
+void poly_acc(const int16 src[M][KYBER_N], const int16 init[KYBER_N], int16 r[KYBER_N]) {
+    #pragma HLS INLINE
+    static_assert(KYBER_N % L == 0, "L must divide 256");
+    static_assert(M <= 4, "poly_wide_t holds at most 5 operands");
+    Poly_Acc_Loop: for (int i = 0; i < KYBER_N / L; i++) {
+        #pragma HLS PIPELINE II=1
+        typename poly_lane<L>::type s = poly_load<L>(init, i);
+        for (int j = 0; j < M; j++) {
+            #pragma HLS UNROLL
+            s += poly_load<L>(src[j], i);
+        }
+        poly_store<L>(r, i, s);
+    }
+}
+
+// r = sum_j src[j] mod Q
+template <int L, int M>
+void poly_acc(const int16 src[M][KYBER_N], int16 r[KYBER_N]) {
+    #pragma HLS INLINE
+    static_assert(KYBER_N % L == 0, "L must divide 256");
+    static_assert(M <= 5, "poly_wide_t holds at most 5 operands");
+    Poly_Acc_Loop: for (int i = 0; i < KYBER_N / L; i++) {
+        #pragma HLS PIPELINE II=1
+        typename poly_lane<L>::type s = poly_load<L>(src[0], i);
+        for (int j = 1; j < M; j++) {
+            #pragma HLS UNROLL
+            s += poly_load<L>(src[j], i);
+        }
+        poly_store<L>(r, i, s);
+    }
+}
+
+// a về [0, Q) in-place (int16 bất kỳ, vd output CBD âm)
+template <int L>
+void poly_reduce(int16 a[KYBER_N]) {
+    #pragma HLS INLINE
+    static_assert(KYBER_N % L == 0, "L must divide 256");
+    Poly_Reduce_Loop: for (int i = 0; i < KYBER_N / L; i++) {
+        #pragma HLS PIPELINE II=1
+        poly_store<L>(a, i, poly_load<L>(a, i));
+    }
+}
+
+#endif
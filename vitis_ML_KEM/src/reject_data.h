@@ -0,0 +1,33 @@
+#ifndef REJECT_DATA_H
+#define REJECT_DATA_H
+
+#include "params.h"
+
+// Implicit rejection: 4 case đầu của KAT_<level>.txt với ct[0] ^= 0x01
+// REJECT_SS[i] = SHAKE256(z || ct', 32), z = 32 byte cuối của sk (sinh bằng hashlib)
+#define REJECT_CASES 4
+
+#if ML_KEM_LEVEL == 512
+const unsigned char REJECT_SS[REJECT_CASES][32] = {
+    {0xee, 0xd0, 0xaf, 0xf6, 0xe8, 0x72, 0xe9, 0x78, 0x5c, 0x50, 0x05, 0xa4, 0x39, 0xd8, 0x67, 0x70, 0xd1, 0x3e, 0xe2, 0x66, 0x2f, 0x46, 0x9c, 0x95, 0xde, 0xcf, 0x5b, 0x39, 0xe8, 0x28, 0x84, 0x55},
+    {0xa4, 0xda, 0xc6, 0x7f, 0x00, 0xa9, 0x85, 0xa4, 0x0d, 0x3a, 0x4e, 0xfe, 0x6f, 0xab, 0xcf, 0x34, 0x4f, 0x2b, 0x82, 0x89, 0xa8, 0x0c, 0x98, 0xc9, 0xfc, 0x64, 0x8a, 0x37, 0xee, 0xfa, 0x40, 0xa2},
+    {0x18, 0x38, 0x6c, 0x97, 0xca, 0x98, 0xe7, 0xb7, 0x94, 0x08, 0xdc, 0x58, 0xf2, 0xc5, 0x30, 0x71, 0xaa, 0xfc, 0xf9, 0x1d, 0x2f, 0xb5, 0x0f, 0xc9, 0xf7, 0x02, 0xbf, 0x84, 0xc8, 0x33, 0xd1, 0x0a},
+    {0x89, 0xcd, 0x2d, 0x8f, 0x3d, 0x55, 0x84, 0x39, 0x4c, 0xe3, 0x7c, 0x91, 0x9c, 0xeb, 0x59, 0x76, 0x5a, 0xdb, 0x91, 0xd8, 0x9e, 0x58, 0xa5, 0x5a, 0x1e, 0x35, 0x64, 0x8f, 0xd1, 0xb4, 0x73, 0x6e}
+};
+#elif ML_KEM_LEVEL == 768
+const unsigned char REJECT_SS[REJECT_CASES][32] = {
+    {0x08, 0x8b, 0x65, 0x54, 0xdd, 0xf5, 0x88, 0x7a, 0xdf, 0xe8, 0xd4, 0xe8, 0x2f, 0xf6, 0x80, 0x9c, 0xa0, 0xcd, 0x56, 0xae, 0xe9, 0x6a, 0xea, 0x3a, 0x0c, 0xc0, 0xd2, 0x9b, 0xd5, 0xf8, 0x7b, 0xb0},
+    {0x5d, 0x9e, 0x14, 0x64, 0x9d, 0xaa, 0xdb, 0x19, 0x30, 0x8c, 0xf9, 0x6e, 0x5b, 0x32, 0x35, 0xb1, 0xc1, 0x64, 0x21, 0x43, 0xec, 0xea, 0x19, 0x9c, 0x1a, 0x3c, 0x35, 0xaa, 0xbb, 0xec, 0x00, 0xcd},
+    {0x97, 0xd1, 0x6c, 0x18, 0xe7, 0x1b, 0xf5, 0xf2, 0xef, 0x57, 0x42, 0xc0, 0x87, 0x2e, 0x7e, 0x5d, 0x35, 0xe8, 0xba, 0x21, 0x11, 0xba, 0xb1, 0x7c, 0x5a, 0xc1, 0x27, 0x6c, 0x2a, 0x0c, 0xfe, 0x8a},
+    {0x2c, 0xbb, 0x90, 0x75, 0x83, 0x43, 0xfb, 0xdb, 0x9f, 0x4f, 0xfa, 0x20, 0x92, 0x10, 0x3d, 0xcd, 0xca, 0xe3, 0xfa, 0x1e, 0xe9, 0x2b, 0x29, 0xf2, 0xe0, 0x15, 0xfe, 0xb6, 0x2e, 0x71, 0x29, 0x4d}
+};
+#else
+const unsigned char REJECT_SS[REJECT_CASES][32] = {
+    {0x69, 0x5f, 0x45, 0x70, 0x66, 0x17, 0x18, 0xf1, 0x28, 0xdd, 0xc5, 0x2a, 0x69, 0x61, 0x3f, 0x4e, 0x6e, 0xf0, 0xce, 0xb8, 0xe0, 0xff, 0x20, 0x5f, 0x18, 0x23, 0xa1, 0x18, 0x6d, 0x4f, 0xf6, 0x83},
+    {0x88, 0x03, 0xe2, 0x42, 0xe8, 0x83, 0x3d, 0xce, 0xb9, 0x92, 0x96, 0xb6, 0xb6, 0xf4, 0x63, 0x81, 0xdd, 0x5c, 0xad, 0x8d, 0x38, 0x89, 0x7e, 0x8e, 0xb1, 0x96, 0x17, 0x98, 0xda, 0xb5, 0xe0, 0x2d},
+    {0x19, 0x9c, 0x1d, 0x6c, 0x18, 0xb1, 0x61, 0x18, 0x15, 0xe2, 0xfd, 0x73, 0x5c, 0x27, 0xf9, 0xa7, 0xc1, 0xd8, 0x77, 0xc3, 0x06, 0x47, 0x95, 0xb9, 0x1c, 0x6a, 0x74, 0x27, 0x67, 0x2f, 0x07, 0x2b},
+    {0xbf, 0xa0, 0x0e, 0xd1, 0xa9, 0xd0, 0xb0, 0x1a, 0x87, 0x6b, 0x1f, 0x4a, 0xbc, 0x9d, 0x34, 0x81, 0xa6, 0x1f, 0x08, 0x01, 0xca, 0x5f, 0xba, 0x4c, 0xaf, 0xa4, 0x72, 0x96, 0xc4, 0x38, 0x10, 0x09}
+};
+#endif
+
+#endif
@@ -22,7 +22,7 @@ void parse_ntt(
     // Parse Loop: Duyệt cho đến khi đủ 256 hệ số
     // II=3 là giới hạn thấp nhất vì mỗi vòng lặp cần đọc 3 byte từ stream 8-bit
     Parse_Loop: while(j < KYBER_N) {
-        #pragma HLS PIPELINE II=3 
+        DO_PRAGMA(HLS PIPELINE II=HW_SAMPLER_II)
         
         // Đọc 3 byte từ XOF stream để tạo ra 2 ứng viên d1, d2
         uint8 b0 = in_bytes.read();
@@ -70,12 +70,131 @@ void sampling_top(
     #pragma HLS DATAFLOW
 
     // Mảng coeffs_out trong hệ thống được partition factor=2
-    #pragma HLS ARRAY_PARTITION variable=coeffs_out cyclic factor=2
+    DO_PRAGMA(HLS ARRAY_PARTITION variable=coeffs_out cyclic factor=HW_POLY_PART)
 
     hls::stream<uint8> byte_stream;
     // Buffer stream 256 byte là đủ cho luồng xử lý
-    #pragma HLS STREAM variable=byte_stream depth=256 
+    DO_PRAGMA(HLS STREAM variable=byte_stream depth=HW_XOF_DEPTH)
 
     xof_absorb_squeeze(input_B, byte_stream);
     parse_ntt(byte_stream, coeffs_out);
-}
\ No newline at end of file
+}
+
+// =========================================================
+// Gen Matrix: expand toàn bộ A_hat (hoặc A_hat^T) từ rho
+// =========================================================
+// rho đến qua stream (4 words) để hàm có thể chạy như một process DATAFLOW
+// bắt đầu ngay khi rho được đọc, không chờ phần còn lại của input.
+// transposed = 0: A[i][j] = SampleNTT(rho || j || i)   (KeyGen)
+// transposed = 1: A[i][j] = A_hat[j][i]                (Encaps / Decaps)
+void gen_matrix(
+    hls::stream<ap_uint<64> >& rho_strm,
+    int16 A[KYBER_K][KYBER_K][KYBER_N],
+    int transposed
+) {
+    #pragma HLS INLINE off
+    DO_PRAGMA(HLS ALLOCATION function instances=keccak_f1600 limit=HW_XOF_KECCAK)
+
+    ap_uint<64> rho_words[4];
+    #pragma HLS ARRAY_PARTITION variable=rho_words complete
+    for(int w=0; w<4; w++) {
+        #pragma HLS PIPELINE II=1
+        rho_words[w] = rho_strm.read();
+    }
+
+    // 3 hàng song song (3 Keccak), các cột chạy tuần tự
+    Gen_Matrix_Loop: for(int i=0; i<KYBER_K; i++) {
+        #pragma HLS UNROLL
+        for(int j=0; j<KYBER_K; j++) {
+            ap_uint<64> xof_in[5];
+            #pragma HLS ARRAY_PARTITION variable=xof_in complete
+            for(int w=0; w<4; w++) {
+                #pragma HLS UNROLL
+                xof_in[w] = rho_words[w];
+            }
+            xof_in[4] = transposed ? ((uint64_t)i | ((uint64_t)j << 8))
+                                   : ((uint64_t)j | ((uint64_t)i << 8));
+
+            hls::stream<uint8> strm;
+            DO_PRAGMA(HLS STREAM variable=strm depth=HW_XOF_DEPTH)
+
+            xof_absorb_squeeze(xof_in, strm);
+            parse_ntt(strm, A[i][j]);
+        }
+    }
+}
+
+// =========================================================
+// SampleNTT ra stream cặp hệ số (cho matvec engine)
+// =========================================================
+// Giống parse_ntt nhưng không ghi mảng: mỗi 2 hệ số được chấp nhận
+// thành 1 coef_pair_t, PE basemul tiêu thụ trực tiếp.
+void parse_ntt_pairs(
+    hls::stream<uint8>& in_bytes,
+    hls::stream<coef_pair_t>& out_pairs
+) {
+    #pragma HLS INLINE off
+
+    unsigned int j = 0;
+    ap_uint<12> pending = 0; // hệ số chẵn đang chờ cặp
+
+    Parse_Pairs_Loop: while(j < KYBER_N) {
+        DO_PRAGMA(HLS PIPELINE II=HW_SAMPLER_II)
+
+        uint8 b0 = in_bytes.read();
+        uint8 b1 = in_bytes.read();
+        uint8 b2 = in_bytes.read();
+
+        ap_uint<12> d1 = (ap_uint<12>)b0 | ((ap_uint<12>)(b1 & 0x0F) << 8);
+        ap_uint<12> d2 = (ap_uint<12>)(b1 >> 4) | ((ap_uint<12>)b2 << 4);
+
+        if(d1 < (ap_uint<12>)KYBER_Q) {
+            if(j & 1) out_pairs.write(((coef_pair_t)d1 << 16) | pending);
+            else pending = d1;
+            j++;
+        }
+        if(j < KYBER_N && d2 < (ap_uint<12>)KYBER_Q) {
+            if(j & 1) out_pairs.write(((coef_pair_t)d2 << 16) | pending);
+            else pending = d2;
+            j++;
+        }
+    }
+
+    Flush_Pairs_Loop: while(!in_bytes.empty()) {
+        #pragma HLS PIPELINE II=1
+        in_bytes.read();
+    }
+}
+
+// Cột j của A_hat (KeyGen, A[i][j] = SampleNTT(rho || j || i)), i = 0..K-1,
+// stream ra theo thứ tự hàng. Mỗi cột = 1 process DATAFLOW với Keccak riêng.
+void gen_matrix_col(
+    hls::stream<ap_uint<64> >& rho_strm,
+    int j,
+    hls::stream<coef_pair_t>& a_col
+) {
+    #pragma HLS INLINE off
+
+    ap_uint<64> rho_words[4];
+    #pragma HLS ARRAY_PARTITION variable=rho_words complete
+    for(int w=0; w<4; w++) {
+        #pragma HLS PIPELINE II=1
+        rho_words[w] = rho_strm.read();
+    }
+
+    Gen_Col_Loop: for(int i=0; i<KYBER_K; i++) {
+        ap_uint<64> xof_in[5];
+        #pragma HLS ARRAY_PARTITION variable=xof_in complete
+        for(int w=0; w<4; w++) {
+            #pragma HLS UNROLL
+            xof_in[w] = rho_words[w];
+        }
+        xof_in[4] = (uint64_t)j | ((uint64_t)i << 8);
+
+        hls::stream<uint8> strm;
+        DO_PRAGMA(HLS STREAM variable=strm depth=HW_XOF_DEPTH)
+
+        xof_absorb_squeeze(xof_in, strm);
+        parse_ntt_pairs(strm, a_col);
+    }
+}
@@ -3,8 +3,6 @@
 
 // Định nghĩa kiểu dữ liệu
 typedef ap_uint<12> u12_t;
-typedef ap_uint<10> u10_t;
-typedef ap_uint<4>  u4_t;
 typedef ap_uint<1>  u1_t;
 
 // =========================================================
@@ -72,114 +70,62 @@ void poly_tomsg(int16 coeffs[KYBER_N], uint8 output[32]) {
 }
 
 // =========================================================
-// 4. Compress U (d=10) - Output 320 bytes [FIXED CASTS]
+// 4. Compress_d + ByteEncode_d (d = du hoặc dv) - Output 32*d bytes
 // =========================================================
-void poly_compress_u(int16 coeffs[KYBER_N], uint8 output[320]) {
+// 8 hệ số d-bit = đúng d byte, nên mỗi nhóm 8 hệ số được gom vào 1 thanh ghi
+// 8*d bit rồi ghi ra d byte. d = 10/4 (512, 768), 11/5 (1024).
+template <int D>
+void poly_compress(int16 coeffs[KYBER_N], uint8 output[D * KYBER_N / 8]) {
     #pragma HLS INLINE
-    for(int i=0; i<KYBER_N/4; i++) {
-        u10_t u[4];
-        #pragma HLS ARRAY_PARTITION variable=u complete
+    for(int i=0; i<KYBER_N/8; i++) {
+        ap_uint<8*D> acc = 0;
 
-        for(int k=0; k<4; k++) {
-            #pragma HLS PIPELINE II=1 
-            int16 val = coeffs[4*i+k];
+        for(int k=0; k<8; k++) {
+            #pragma HLS PIPELINE II=1
+            int16 val = coeffs[8*i+k];
             while(val < 0) val += KYBER_Q;
             while(val >= KYBER_Q) val -= KYBER_Q;
 
-            ap_uint<32> t = (ap_uint<32>)val * 1024 + 1664;
-            u[k] = (u10_t)((t / KYBER_Q) & 0x3FF);
+            // round(2^d * x / q) mod 2^d
+            ap_uint<32> t = (ap_uint<32>)val * (1 << D) + 1664;
+            ap_uint<D> c = (ap_uint<D>)((t / KYBER_Q) & ((1 << D) - 1));
+            acc |= (ap_uint<8*D>)c << (D*k);
         }
 
-        int base_idx = 5 * i;
-        // Ép kiểu tường minh từng thành phần sang uint8 trước khi shift/or
-        // u[k] là 10 bit.
-        // Byte 0: u0[7:0]
-        output[base_idx + 0] = (uint8)(u[0] & 0xFF);
-        
-        // Byte 1: u1[5:0] | u0[9:8]
-        output[base_idx + 1] = (uint8)((u[0] >> 8) | ((u[1] & 0x3F) << 2));
-        
-        // Byte 2: u2[3:0] | u1[9:6]
-        output[base_idx + 2] = (uint8)((u[1] >> 6) | ((u[2] & 0x0F) << 4));
-        
-        // Byte 3: u3[1:0] | u2[9:4]
-        output[base_idx + 3] = (uint8)((u[2] >> 4) | ((u[3] & 0x03) << 6));
-        
-        // Byte 4: u3[9:2]
-        output[base_idx + 4] = (uint8)(u[3] >> 2);
-    }
-}
-
-// =========================================================
-// 5. Decompress U (d=10)
-// =========================================================
-void poly_decompress_u(uint8 input[320], int16 coeffs[KYBER_N]) {
-    #pragma HLS INLINE
-    for(int i=0; i<KYBER_N/4; i++) {
-        uint8 t[5];
-        #pragma HLS ARRAY_PARTITION variable=t complete
-        int base_idx = 5 * i;
-        for(int k=0; k<5; k++) t[k] = input[base_idx + k];
-
-        u10_t u[4];
-        #pragma HLS ARRAY_PARTITION variable=u complete
-        
-        u[0] = (u10_t)t[0] | ((u10_t)(t[1] & 0x03) << 8);
-        u[1] = (u10_t)(t[1] >> 2) | ((u10_t)(t[2] & 0x0F) << 6);
-        u[2] = (u10_t)(t[2] >> 4) | ((u10_t)(t[3] & 0x3F) << 4);
-        u[3] = (u10_t)(t[3] >> 6) | ((u10_t)t[4] << 2);
-
-        for(int k=0; k<4; k++) {
-            #pragma HLS PIPELINE II=1
-            ap_uint<32> val = (ap_uint<32>)u[k] * KYBER_Q;
-            val = (val + 512) >> 10; // div 1024
-            coeffs[4*i+k] = (int16)val;
+        for(int b=0; b<D; b++) {
+            #pragma HLS UNROLL
+            output[D*i + b] = (uint8)acc.range(8*b + 7, 8*b);
         }
     }
 }
 
 // =========================================================
-// 6. Compress V (d=4) - Output 128 bytes [FIXED BUG HERE]
+// 5. ByteDecode_d + Decompress_d
 // =========================================================
-void poly_compress_v(int16 coeffs[KYBER_N], uint8 output[128]) {
+template <int D>
+void poly_decompress(uint8 input[D * KYBER_N / 8], int16 coeffs[KYBER_N]) {
     #pragma HLS INLINE
-    for(int i=0; i<KYBER_N/2; i++) {
-        #pragma HLS PIPELINE II=1
-        
-        u4_t u[2];
-        for(int k=0; k<2; k++) {
-            #pragma HLS UNROLL 
-            int16 val = coeffs[2*i+k];
-            while(val < 0) val += KYBER_Q;
-            while(val >= KYBER_Q) val -= KYBER_Q;
-
-            // d=4 -> mul 16
-            ap_uint<32> t = (ap_uint<32>)val * 16 + 1664;
-            u[k] = (u4_t)((t / KYBER_Q) & 0x0F);
+    for(int i=0; i<KYBER_N/8; i++) {
+        ap_uint<8*D> acc = 0;
+        for(int b=0; b<D; b++) {
+            #pragma HLS UNROLL
+            acc |= (ap_uint<8*D>)input[D*i + b] << (8*b);
         }
 
-        // LỖI CŨ: (u[1] << 4) với u[1] là 4-bit sẽ bị tràn thành 0
-        // FIX: Ép kiểu uint8 trước khi shift
-        output[i] = (uint8)u[0] | ((uint8)u[1] << 4);
+        for(int k=0; k<8; k++) {
+            #pragma HLS PIPELINE II=1
+            // round(q * x / 2^d)
+            ap_uint<32> val = (ap_uint<32>)acc.range(D*k + D - 1, D*k) * KYBER_Q;
+            coeffs[8*i+k] = (int16)((val + (1 << (D - 1))) >> D);
+        }
     }
 }
 
-// =========================================================
-// 7. Decompress V (d=4)
-// =========================================================
-void poly_decompress_v(uint8 input[128], int16 coeffs[KYBER_N]) {
-    #pragma HLS INLINE
-    for(int i=0; i<KYBER_N/2; i++) {
-        #pragma HLS PIPELINE II=1
-        
-        uint8 byte = input[i];
-        u4_t v0 = (u4_t)(byte & 0x0F);
-        u4_t v1 = (u4_t)(byte >> 4);
-
-        ap_uint<32> val0 = (ap_uint<32>)v0 * KYBER_Q;
-        coeffs[2*i] = (int16)((val0 + 8) >> 4); // div 16
-
-        ap_uint<32> val1 = (ap_uint<32>)v1 * KYBER_Q;
-        coeffs[2*i+1] = (int16)((val1 + 8) >> 4);
-    }
-}
\ No newline at end of file
+template void poly_compress<4>(int16 coeffs[KYBER_N], uint8 output[128]);
+template void poly_compress<5>(int16 coeffs[KYBER_N], uint8 output[160]);
+template void poly_compress<10>(int16 coeffs[KYBER_N], uint8 output[320]);
+template void poly_compress<11>(int16 coeffs[KYBER_N], uint8 output[352]);
+template void poly_decompress<4>(uint8 input[128], int16 coeffs[KYBER_N]);
+template void poly_decompress<5>(uint8 input[160], int16 coeffs[KYBER_N]);
+template void poly_decompress<10>(uint8 input[320], int16 coeffs[KYBER_N]);
+template void poly_decompress<11>(uint8 input[352], int16 coeffs[KYBER_N]);
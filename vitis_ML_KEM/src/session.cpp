@@ -0,0 +1,252 @@
+#include "params.h"
+#include "hls_stream.h"
+#include "ap_int.h"
+
+#define PK_SIZE KYBER_PK_BYTES
+#define SK_SIZE KYBER_SK_BYTES
+#define CT_SIZE KYBER_CT_BYTES
+#define SS_SIZE 32
+#define AES_FRAME_BEATS (AES_FRAME_MAX / AES_BLOCK_BYTES)
+
+// --- EXTERN DECLARATIONS ---
+extern void encaps_core(uint8 pk_in[PK_SIZE], uint8 randomness_m[32], uint8 ct_out[CT_SIZE], uint8 ss_out[32],
+                        int& status, perf_t perf[PERF_SLOTS]);
+extern void decaps_core(uint8 sk_in[SK_SIZE], uint8 ct_in[CT_SIZE], uint8 ss_out[SS_SIZE],
+                        int& status, perf_t perf[PERF_SLOTS]);
+extern void aes256_ctr_core(uint8 key[32], ap_uint<64> nonce, ap_uint<64> ctr0, int n_bytes,
+                            beat_t* in, beat_t* out);
+template <int WORDS> void shake256_prf_n(uint8 input[33], uint64_t output_64[WORDS]);
+extern void drbg_generate(ap_uint<64> seed[4], ap_uint<64> ctr, uint8 domain, uint8 out[DRBG_OUT_BYTES]);
+extern void keccak_duplex_core(uint8 key[32], ap_uint<128> nonce, int decrypt, int n_bytes,
+                               beat_t* in, beat_t* out, beat_t* tag_out);
+
+// =========================================================
+// SESSION KERNELS: ML-KEM -> AES-256-CTR, ss không rời fabric
+// =========================================================
+// ss của encaps (client) / decaps (server) được ghi thẳng vào 1 trong
+// HW_SESSION_SLOTS slot key on-chip của engine mã hóa frame.
+// Host chỉ thấy ct và chỉ số slot; rekey = 1 lần gọi SESSION_OP_KEM,
+// không có ss_out trên DDR và không cần bản sao key ở host.
+//   SESSION_OP_KEM    : tính ss vào slot (ek / dk lỗi -> slot bị vô hiệu)
+//   SESSION_OP_CRYPT  : mã hóa frame_in -> frame_out bằng key của slot
+//   SESSION_OP_DECRYPT: giải mã
+//   SESSION_OP_CLEAR  : xóa key của slot
+//   SESSION_OP_RATCHET: key mới = SHAKE256(key || 0xFF)[0..32), ghi đè key cũ
+//                       (forward secrecy giữa các epoch frame). 1 permutation
+//                       trên keccak_f1600 dùng chung, không chạm DDR; 2 phía
+//                       ratchet cùng số lần thì vẫn cùng key. KEM đầy đủ chỉ
+//                       cần khi muốn key mới độc lập với ss cũ.
+// Engine theo HW_SESSION_CIPHER:
+//   SESSION_CIPHER_AES_CTR: AES-256-CTR (aes_ctr.cpp), counter nonce || ctr0,
+//                           tag_out không dùng
+//   SESSION_CIPHER_DUPLEX : keccak duplex (duplex_cipher.cpp), nonce 128 bit =
+//                           nonce || ctr0 (ctr0 ở bit [127:64]), tag -> tag_out
+// ap_return = KEY_STATUS_* (NO_KEY: CRYPT trên slot chưa có key).
+// Slot là static: giữ giữa các lần gọi như các kernel resident.
+// m của encaps sinh bằng drbg_generate on-chip (domain DRBG_DOMAIN_ENCAPS),
+// không có buffer m trên DDR: xem ml_kem_session_encaps.
+
+// ss -> slot, chỉ nạp khi KEM không báo lỗi input
+static void session_store(
+    uint8 keys[HW_SESSION_SLOTS][SS_SIZE],
+    bool valid[HW_SESSION_SLOTS],
+    int slot,
+    uint8 ss[SS_SIZE],
+    int status
+) {
+    #pragma HLS INLINE
+    bool ok = (status == KEY_STATUS_OK);
+    for(int i=0; i<SS_SIZE; i++) {
+        #pragma HLS UNROLL
+        keys[slot][i] = ok ? ss[i] : (uint8)0;
+    }
+    valid[slot] = ok;
+}
+
+// CRYPT / DECRYPT / CLEAR / RATCHET, dùng chung cho 2 kernel
+static int session_key_op(
+    uint8 keys[HW_SESSION_SLOTS][SS_SIZE],
+    bool valid[HW_SESSION_SLOTS],
+    int op,
+    int slot,
+    ap_uint<64> nonce,
+    ap_uint<64> ctr0,
+    int n_bytes,
+    beat_t* frame_in,
+    beat_t* frame_out,
+    beat_t* tag_out
+) {
+    #pragma HLS INLINE
+    if (op == SESSION_OP_CLEAR) {
+        for(int i=0; i<SS_SIZE; i++) {
+            #pragma HLS UNROLL
+            keys[slot][i] = 0;
+        }
+        valid[slot] = false;
+        return KEY_STATUS_OK;
+    }
+
+    if (!valid[slot]) return KEY_STATUS_NO_KEY;
+
+    uint8 key[SS_SIZE];
+    #pragma HLS ARRAY_PARTITION variable=key complete
+    for(int i=0; i<SS_SIZE; i++) {
+        #pragma HLS UNROLL
+        key[i] = keys[slot][i];
+    }
+
+    if (op == SESSION_OP_RATCHET) {
+        uint8 prf_in[SS_SIZE + 1];
+        #pragma HLS ARRAY_PARTITION variable=prf_in complete
+        uint64_t prf_out[4];
+        for(int i=0; i<SS_SIZE; i++) {
+            #pragma HLS UNROLL
+            prf_in[i] = key[i];
+        }
+        prf_in[SS_SIZE] = SESSION_RATCHET_DS;
+        shake256_prf_n<4>(prf_in, prf_out);
+        for(int i=0; i<SS_SIZE; i++) {
+            #pragma HLS UNROLL
+            keys[slot][i] = (uint8)(prf_out[i / 8] >> (8 * (i % 8)));
+        }
+        return KEY_STATUS_OK;
+    }
+
+#if HW_SESSION_CIPHER == SESSION_CIPHER_DUPLEX
+    ap_uint<128> dx_nonce = ((ap_uint<128>)ctr0 << 64) | (ap_uint<128>)nonce;
+    keccak_duplex_core(key, dx_nonce, op == SESSION_OP_DECRYPT, n_bytes, frame_in, frame_out, tag_out);
+#else
+    (void)tag_out; // AES-CTR không có tag
+    aes256_ctr_core(key, nonce, ctr0, n_bytes, frame_in, frame_out);
+#endif
+    return KEY_STATUS_OK;
+}
+
+// Client: encaps theo ek của server, ct -> host, ss -> slot
+// SESSION_OP_KEM lấy m từ DRBG on-chip: out = drbg_generate(state ^ drbg_seed,
+// ctr, DRBG_DOMAIN_ENCAPS), m = out[0..31], state <- out[32..63], ctr++.
+// state / ctr là static, không bao giờ ra AXI; drbg_seed (AXI-lite) chỉ là
+// entropy host trộn thêm, nên host biết drbg_seed của 1 lần gọi vẫn không tính
+// lại được m / ss (state = 0 sau reset: lần LIVE đầu chỉ bí mật nhờ drbg_seed).
+// mode = DRBG_MODE_REPLAY: m = drbg_seed (32 bytes LE, KAT),
+// state không đổi; mọi giá trị mode khác là DRBG_MODE_LIVE.
+int ml_kem_session_encaps(
+    int op,
+    int slot,
+    ap_uint<64> drbg_seed[4],
+    int mode,
+    uint8 pk_in[PK_SIZE],
+    uint8 ct_out[CT_SIZE],
+    ap_uint<64> nonce,
+    ap_uint<64> ctr0,
+    int n_bytes,
+    beat_t* frame_in,
+    beat_t* frame_out,
+    beat_t* tag_out
+) {
+    #pragma HLS INTERFACE s_axilite port=op
+    #pragma HLS INTERFACE s_axilite port=slot
+    #pragma HLS INTERFACE s_axilite port=drbg_seed
+    #pragma HLS INTERFACE s_axilite port=mode
+    #pragma HLS INTERFACE m_axi port=pk_in bundle=gmem0 depth=PK_SIZE max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=ct_out bundle=gmem1 depth=CT_SIZE max_widen_bitwidth=128
+    #pragma HLS INTERFACE s_axilite port=nonce
+    #pragma HLS INTERFACE s_axilite port=ctr0
+    #pragma HLS INTERFACE s_axilite port=n_bytes
+    #pragma HLS INTERFACE m_axi port=frame_in bundle=gmem0 depth=AES_FRAME_BEATS max_read_burst_length=256
+    #pragma HLS INTERFACE m_axi port=frame_out bundle=gmem1 depth=AES_FRAME_BEATS max_write_burst_length=256
+    #pragma HLS INTERFACE m_axi port=tag_out bundle=gmem1 depth=1
+    #pragma HLS INTERFACE s_axilite port=return
+
+    // Trạng thái giữ lại giữa các lần gọi kernel
+    static uint8 slot_key[HW_SESSION_SLOTS][SS_SIZE];
+    #pragma HLS ARRAY_PARTITION variable=slot_key dim=0 type=complete
+    static bool slot_valid[HW_SESSION_SLOTS] = {false};
+    #pragma HLS ARRAY_PARTITION variable=slot_valid type=complete
+    static ap_uint<64> drbg_state[4] = {0, 0, 0, 0};
+    #pragma HLS ARRAY_PARTITION variable=drbg_state complete
+    static ap_uint<64> drbg_ctr = 0;
+
+    if (slot < 0 || slot >= HW_SESSION_SLOTS) return KEY_STATUS_BAD_SLOT;
+
+    if (op == SESSION_OP_KEM) {
+        // Session không xuất perf
+        perf_t perf_off[PERF_SLOTS];
+
+        uint8 rnd[DRBG_OUT_BYTES];
+        #pragma HLS ARRAY_PARTITION variable=rnd complete
+        if (mode == DRBG_MODE_REPLAY) {
+            for(int i=0; i<32; i++) {
+                #pragma HLS UNROLL
+                rnd[i] = (uint8)(drbg_seed[i / 8] >> (8 * (i % 8)));
+            }
+        } else {
+            ap_uint<64> seed_mix[4];
+            #pragma HLS ARRAY_PARTITION variable=seed_mix complete
+            for(int i=0; i<4; i++) {
+                #pragma HLS UNROLL
+                seed_mix[i] = drbg_state[i] ^ drbg_seed[i];
+            }
+            drbg_generate(seed_mix, drbg_ctr, DRBG_DOMAIN_ENCAPS, rnd);
+            drbg_ctr++;
+            for(int i=0; i<4; i++) {
+                #pragma HLS UNROLL
+                uint64_t w = 0;
+                for(int j=0; j<8; j++) w |= (uint64_t)rnd[32 + i*8 + j] << (8*j);
+                drbg_state[i] = w;
+            }
+        }
+        uint8 ss[SS_SIZE];
+        #pragma HLS ARRAY_PARTITION variable=ss complete
+        int status;
+        encaps_core(pk_in, rnd, ct_out, ss, status, perf_off);
+        session_store(slot_key, slot_valid, slot, ss, status);
+        return status;
+    }
+    return session_key_op(slot_key, slot_valid, op, slot, nonce, ctr0, n_bytes, frame_in, frame_out, tag_out);
+}
+
+// Server: decaps ct của client bằng dk, ss -> slot
+int ml_kem_session_decaps(
+    int op,
+    int slot,
+    uint8 sk_in[SK_SIZE],
+    uint8 ct_in[CT_SIZE],
+    ap_uint<64> nonce,
+    ap_uint<64> ctr0,
+    int n_bytes,
+    beat_t* frame_in,
+    beat_t* frame_out,
+    beat_t* tag_out
+) {
+    #pragma HLS INTERFACE s_axilite port=op
+    #pragma HLS INTERFACE s_axilite port=slot
+    #pragma HLS INTERFACE m_axi port=sk_in bundle=gmem0 depth=SK_SIZE max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=ct_in bundle=gmem1 depth=CT_SIZE max_widen_bitwidth=128
+    #pragma HLS INTERFACE s_axilite port=nonce
+    #pragma HLS INTERFACE s_axilite port=ctr0
+    #pragma HLS INTERFACE s_axilite port=n_bytes
+    #pragma HLS INTERFACE m_axi port=frame_in bundle=gmem0 depth=AES_FRAME_BEATS max_read_burst_length=256
+    #pragma HLS INTERFACE m_axi port=frame_out bundle=gmem1 depth=AES_FRAME_BEATS max_write_burst_length=256
+    #pragma HLS INTERFACE m_axi port=tag_out bundle=gmem1 depth=1
+    #pragma HLS INTERFACE s_axilite port=return
+
+    static uint8 slot_key[HW_SESSION_SLOTS][SS_SIZE];
+    #pragma HLS ARRAY_PARTITION variable=slot_key dim=0 type=complete
+    static bool slot_valid[HW_SESSION_SLOTS] = {false};
+    #pragma HLS ARRAY_PARTITION variable=slot_valid type=complete
+
+    if (slot < 0 || slot >= HW_SESSION_SLOTS) return KEY_STATUS_BAD_SLOT;
+
+    if (op == SESSION_OP_KEM) {
+        perf_t perf_off[PERF_SLOTS];
+
+        uint8 ss[SS_SIZE];
+        #pragma HLS ARRAY_PARTITION variable=ss complete
+        int status;
+        decaps_core(sk_in, ct_in, ss, status, perf_off);
+        session_store(slot_key, slot_valid, slot, ss, status);
+        return status;
+    }
+    return session_key_op(slot_key, slot_valid, op, slot, nonce, ctr0, n_bytes, frame_in, frame_out, tag_out);
+}
@@ -175,7 +175,10 @@ void sha3_512_hash(uint8 input[33], uint8 output[64]) {
     }
 }
 
-void shake256_prf(uint8 input[33], uint64_t output_64[16]) {
+// PRF_eta(s, b) = SHAKE256(s || b, 64*eta): WORDS = 8*eta
+// eta=2 -> 16 words (1 lần squeeze), eta=3 -> 24 words (> rate 17 -> permute thêm 1 lần)
+template <int WORDS>
+void shake256_prf_n(uint8 input[33], uint64_t output_64[WORDS]) {
     #pragma HLS INLINE
     uint64_t state[25];
     #pragma HLS ARRAY_PARTITION variable=state type=complete
@@ -194,10 +197,27 @@ void shake256_prf(uint8 input[33], uint64_t output_64[16]) {
 
     keccak_f1600(state);
 
-    for(int i=0; i<16; i++) {
+    const int FIRST = (WORDS < 17) ? WORDS : 17;
+    for(int i=0; i<FIRST; i++) {
         #pragma HLS UNROLL
         output_64[i] = state[i];
     }
+    if (WORDS > 17) {
+        keccak_f1600(state);
+        for(int i=17; i<WORDS; i++) {
+            #pragma HLS UNROLL
+            output_64[i] = state[i - 17];
+        }
+    }
+}
+
+template void shake256_prf_n<16>(uint8 input[33], uint64_t output_64[16]);
+template void shake256_prf_n<24>(uint8 input[33], uint64_t output_64[24]);
+template void shake256_prf_n<4>(uint8 input[33], uint64_t output_64[4]); // session ratchet
+
+void shake256_prf(uint8 input[33], uint64_t output_64[16]) {
+    #pragma HLS INLINE
+    shake256_prf_n<16>(input, output_64);
 }
 
 #define SHAKE128_RATE_WORDS 21
@@ -0,0 +1,96 @@
+#include <iostream>
+#include <cstring>
+#include "aes_data.h"
+#include "params.h"
+#include "ap_int.h"
+
+// --- DUT ---
+void aes256_ctr(uint8 key[32], ap_uint<64> nonce, ap_uint<64> ctr0, int n_bytes, beat_t* in, beat_t* out);
+
+#define MAX_BEATS ((FRAME_BYTES + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES)
+
+static beat_t buf_in[MAX_BEATS], buf_out[MAX_BEATS];
+
+// byte -> beat (byte 0 ở bit [7:0]), phần đệm của beat cuối = 0
+static void to_beats(const uint8* src, int n, beat_t* dst) {
+    int beats = (n + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES;
+    for (int i = 0; i < beats; i++) {
+        beat_t w = 0;
+        for (int b = 0; b < AES_BLOCK_BYTES && i * AES_BLOCK_BYTES + b < n; b++)
+            w |= (beat_t)src[i * AES_BLOCK_BYTES + b] << (8 * b);
+        dst[i] = w;
+    }
+}
+
+static uint8 beat_byte(const beat_t* src, int idx) {
+    return (uint8)(src[idx / AES_BLOCK_BYTES] >> (8 * (idx % AES_BLOCK_BYTES)));
+}
+
+// nonce 8 byte theo thứ tự prefix -> thanh ghi s_axilite (byte 0 ở bit [7:0])
+static ap_uint<64> nonce_reg(const uint8 nonce[8]) {
+    uint64_t v = 0;
+    for (int b = 0; b < 8; b++) v |= (uint64_t)nonce[b] << (8 * b);
+    return v;
+}
+
+// So out[0 .. n) với exp, in lỗi đầu tiên
+static int check(const beat_t* out, const uint8* exp, int n, const char* name) {
+    for (int i = 0; i < n; i++) {
+        if (beat_byte(out, i) != exp[i]) {
+            std::cout << "[FAIL " << name << "] idx=" << i << " HW=" << (int)beat_byte(out, i)
+                      << " Exp=" << (int)exp[i] << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "[PASS] " << name << std::endl;
+    return 0;
+}
+
+int main() {
+    std::cout << "--- STARTING AES-256-CTR TEST ---" << std::endl;
+    int fails = 0;
+    uint8 key[32];
+
+    // 1. SP 800-38A: counter bắt đầu giữa chừng (ctr0 != 0)
+    memcpy(key, SP800_KEY, 32);
+    to_beats(SP800_PT, sizeof(SP800_PT), buf_in);
+    aes256_ctr(key, nonce_reg(SP800_NONCE), SP800_CTR0, sizeof(SP800_PT), buf_in, buf_out);
+    fails += check(buf_out, SP800_CT, sizeof(SP800_CT), "SP 800-38A F.5.5");
+
+    // 2. Frame trọn vẹn, so với AES_Software.encrypt_image
+    memcpy(key, FRAME_KEY, 32);
+    ap_uint<64> nonce = nonce_reg(FRAME_NONCE);
+    to_beats(FRAME_PT, FRAME_BYTES, buf_in);
+    aes256_ctr(key, nonce, 0, FRAME_BYTES, buf_in, buf_out);
+    fails += check(buf_out, FRAME_CT, FRAME_BYTES, "frame (encrypt_image)");
+
+    // 3. Cùng frame chia 2 lần gọi: lần 2 bắt đầu ở ctr0 = số block đã mã hóa
+    int half = (MAX_BEATS / 2) * AES_BLOCK_BYTES;
+    aes256_ctr(key, nonce, 0, half, buf_in, buf_out);
+    aes256_ctr(key, nonce, half / AES_BLOCK_BYTES, FRAME_BYTES - half,
+               &buf_in[half / AES_BLOCK_BYTES], &buf_out[half / AES_BLOCK_BYTES]);
+    fails += check(buf_out, FRAME_CT, FRAME_BYTES, "frame split at ctr0");
+
+    // 4. Giải mã = mã hóa lại
+    to_beats(FRAME_CT, FRAME_BYTES, buf_in);
+    aes256_ctr(key, nonce, 0, FRAME_BYTES, buf_in, buf_out);
+    fails += check(buf_out, FRAME_PT, FRAME_BYTES, "frame decrypt");
+
+    // 5. Độ dài lẻ: block cuối 8 byte, phần đệm của beat cuối phải = 0
+    memcpy(key, ODD_KEY, 32);
+    to_beats(ODD_PT, ODD_BYTES, buf_in);
+    aes256_ctr(key, nonce_reg(ODD_NONCE), 0, ODD_BYTES, buf_in, buf_out);
+    fails += check(buf_out, ODD_CT, ODD_BYTES, "odd length");
+    for (int i = ODD_BYTES; i < (ODD_BYTES / AES_BLOCK_BYTES + 1) * AES_BLOCK_BYTES; i++) {
+        if (beat_byte(buf_out, i) != 0) {
+            std::cout << "[FAIL odd length] tail byte " << i << " not cleared" << std::endl;
+            fails++;
+            break;
+        }
+    }
+
+    std::cout << "---------------------------------" << std::endl;
+    if (fails == 0) std::cout << "ALL AES-256-CTR TESTS PASSED!" << std::endl;
+    else std::cout << "AES-256-CTR TESTS FAILED: " << fails << " errors." << std::endl;
+    return fails;
+}
@@ -0,0 +1,100 @@
+#include <iostream>
+#include <cstring>
+#include "aes_data.h"
+#include "params.h"
+#include "ap_int.h"
+
+// --- DUT ---
+void aes256_gcm(uint8 key[32], ap_uint<96> iv, int decrypt, int aad_bytes, beat_t* aad,
+                int n_bytes, beat_t* in, beat_t* out, beat_t* tag_out);
+
+#define MAX_BEATS ((FRAME_BYTES + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES)
+
+static beat_t buf_aad[4], buf_in[MAX_BEATS], buf_out[MAX_BEATS], tag[1];
+
+// byte -> beat (byte 0 ở bit [7:0]), phần đệm của beat cuối = 0
+static void to_beats(const uint8* src, int n, beat_t* dst) {
+    int beats = (n + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES;
+    for (int i = 0; i < beats; i++) {
+        beat_t w = 0;
+        for (int b = 0; b < AES_BLOCK_BYTES && i * AES_BLOCK_BYTES + b < n; b++)
+            w |= (beat_t)src[i * AES_BLOCK_BYTES + b] << (8 * b);
+        dst[i] = w;
+    }
+}
+
+static uint8 beat_byte(const beat_t* src, int idx) {
+    return (uint8)(src[idx / AES_BLOCK_BYTES] >> (8 * (idx % AES_BLOCK_BYTES)));
+}
+
+// IV 12 byte -> thanh ghi s_axilite (byte 0 ở bit [7:0])
+static ap_uint<96> iv_reg(const uint8 iv[12]) {
+    ap_uint<96> v = 0;
+    for (int b = 0; b < 12; b++) v |= (ap_uint<96>)iv[b] << (8 * b);
+    return v;
+}
+
+// So out[0 .. n) với exp, in lỗi đầu tiên
+static int check(const beat_t* out, const uint8* exp, int n, const char* name) {
+    for (int i = 0; i < n; i++) {
+        if (beat_byte(out, i) != exp[i]) {
+            std::cout << "[FAIL " << name << "] idx=" << i << " HW=" << (int)beat_byte(out, i)
+                      << " Exp=" << (int)exp[i] << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "[PASS] " << name << std::endl;
+    return 0;
+}
+
+int main() {
+    std::cout << "--- STARTING AES-256-GCM TEST (" << HW_GHASH_WAYS << "-way GHASH) ---" << std::endl;
+    int fails = 0;
+    uint8 key[32];
+
+    // 1. GCM spec Test Case 16: AAD và pt đều có block cuối lẻ
+    memcpy(key, GCM16_KEY, 32);
+    to_beats(GCM16_AAD, sizeof(GCM16_AAD), buf_aad);
+    to_beats(GCM16_PT, sizeof(GCM16_PT), buf_in);
+    aes256_gcm(key, iv_reg(GCM16_IV), 0, sizeof(GCM16_AAD), buf_aad, sizeof(GCM16_PT), buf_in, buf_out, tag);
+    fails += check(buf_out, GCM16_CT, sizeof(GCM16_CT), "Test Case 16 ct");
+    fails += check(tag, GCM16_TAG, 16, "Test Case 16 tag");
+
+    // 2. Frame 32x32x3 + header AAD, so với pycryptodome
+    memcpy(key, FRAME_KEY, 32);
+    to_beats(GCM_FRAME_AAD, sizeof(GCM_FRAME_AAD), buf_aad);
+    to_beats(FRAME_PT, FRAME_BYTES, buf_in);
+    aes256_gcm(key, iv_reg(GCM_FRAME_IV), 0, sizeof(GCM_FRAME_AAD), buf_aad, FRAME_BYTES, buf_in, buf_out, tag);
+    fails += check(buf_out, GCM_FRAME_CT, FRAME_BYTES, "frame ct");
+    fails += check(tag, GCM_FRAME_TAG, 16, "frame tag");
+
+    // 3. Giải mã: out = pt, tag vẫn tính trên ciphertext
+    to_beats(GCM_FRAME_CT, FRAME_BYTES, buf_in);
+    aes256_gcm(key, iv_reg(GCM_FRAME_IV), 1, sizeof(GCM_FRAME_AAD), buf_aad, FRAME_BYTES, buf_in, buf_out, tag);
+    fails += check(buf_out, FRAME_PT, FRAME_BYTES, "frame decrypt");
+    fails += check(tag, GCM_FRAME_TAG, 16, "frame decrypt tag");
+
+    // 4. Sửa 1 bit ciphertext -> tag khác
+    buf_in[5] ^= (beat_t)1;
+    aes256_gcm(key, iv_reg(GCM_FRAME_IV), 1, sizeof(GCM_FRAME_AAD), buf_aad, FRAME_BYTES, buf_in, buf_out, tag);
+    bool same = true;
+    for (int i = 0; i < 16; i++) if (beat_byte(tag, i) != GCM_FRAME_TAG[i]) same = false;
+    if (same) {
+        std::cout << "[FAIL tamper] tag unchanged" << std::endl;
+        fails++;
+    } else {
+        std::cout << "[PASS] tamper detected" << std::endl;
+    }
+
+    // 5. Không có AAD, độ dài lẻ
+    memcpy(key, ODD_KEY, 32);
+    to_beats(ODD_PT, ODD_BYTES, buf_in);
+    aes256_gcm(key, iv_reg(GCM_ODD_IV), 0, 0, buf_aad, ODD_BYTES, buf_in, buf_out, tag);
+    fails += check(buf_out, GCM_ODD_CT, ODD_BYTES, "odd length ct");
+    fails += check(tag, GCM_ODD_TAG, 16, "odd length tag");
+
+    std::cout << "---------------------------------" << std::endl;
+    if (fails == 0) std::cout << "ALL AES-256-GCM TESTS PASSED!" << std::endl;
+    else std::cout << "AES-256-GCM TESTS FAILED: " << fails << " errors." << std::endl;
+    return fails;
+}
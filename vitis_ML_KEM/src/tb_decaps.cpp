@@ -5,21 +5,36 @@
 #include <iomanip>
 #include <cstring>
 #include "params.h"
+#include "reject_data.h" // File sinh ra từ Python (hashlib)
 
-// Kích thước chuẩn cho Kyber-768
-#define SK_SIZE 2400 // s_hat + pk + H(pk) + z
-#define CT_SIZE 1088 // u + v
+// Kích thước theo bộ tham số đang build (params.h, ML_KEM_LEVEL)
+#define SK_SIZE KYBER_SK_BYTES // s_hat + pk + H(pk) + z
+#define CT_SIZE KYBER_CT_BYTES // u + v
 #define SS_SIZE 32
 
 // Khai báo DUT (Device Under Test)
-void ml_kem_decaps(
+int ml_kem_decaps(
     uint8 sk_in[SK_SIZE],
     uint8 ct_in[CT_SIZE],
-    uint8 ss_out[SS_SIZE]
+    uint8 ss_out[SS_SIZE],
+    perf_t perf[PERF_SLOTS]
 );
 
 // --- HÀM HỖ TRỢ ---
 
+// In số cycle theo phase (C-sim: số iteration pipeline, xem PERF_TICK)
+const char* PERF_NAMES[PERF_SLOTS] = {
+    "LOAD", "HASH", "XOF", "NOISE", "MATRIX", "INVNTT", "COMPRESS", "STORE", "COMPARE", "TOTAL"
+};
+
+void print_perf(perf_t perf[PERF_SLOTS]) {
+    std::cout << "Phase cycles (case #1):" << std::endl;
+    for(int i=0; i<PERF_SLOTS; i++) {
+        if(perf[i] == 0) continue;
+        std::cout << "  " << PERF_NAMES[i] << ": " << (unsigned long long)perf[i] << std::endl;
+    }
+}
+
 // Chuyển Hex String -> Vector Byte
 std::vector<uint8_t> hex2bin(const std::string &hex) {
     std::vector<uint8_t> bytes;
@@ -46,13 +61,15 @@ bool verify_bytes(uint8* hw, std::vector<uint8_t>& ref, int len, std::string nam
 }
 
 // --- MAIN ---
-int main() {
+// argv[1]: file KAT (mặc định theo ML_KEM_LEVEL)
+int main(int argc, char** argv) {
     std::cout << "--- STARTING KAT DECAPSULATION TEST ---" << std::endl;
 
     // Mở file KAT
-    std::ifstream file("KAT_768.txt");
+    const char* kat_file = (argc > 1) ? argv[1] : KYBER_KAT_FILE;
+    std::ifstream file(kat_file);
     if (!file.is_open()) {
-        std::cerr << "Error: Could not open KAT_768.txt" << std::endl;
+        std::cerr << "Error: Could not open " << kat_file << std::endl;
         return 1;
     }
 
@@ -63,6 +80,10 @@ int main() {
     
     int count = 0;
     int pass_count = 0;
+    int case_idx = 0;
+    int case_total = 0;
+    int rej_pass = 0;
+    bool check_ok = false;
     
     // Cờ đánh dấu
     bool has_sk = false, has_ct = false, has_ss = false;
@@ -91,6 +112,7 @@ int main() {
 
         // KHI ĐỦ DỮ LIỆU INPUT VÀ OUTPUT
         if (has_sk && has_ct && has_ss) {
+            case_total++;
             
             // 1. Prepare Hardware Buffers
             uint8 sk_in[SK_SIZE];
@@ -104,16 +126,39 @@ int main() {
                 memcpy(ct_in, ct_vec.data(), CT_SIZE);
 
                 // 2. Call Hardware (DUT)
-                ml_kem_decaps(sk_in, ct_in, ss_hw);
+                perf_t perf[PERF_SLOTS];
+                int status = ml_kem_decaps(sk_in, ct_in, ss_hw, perf);
+                if (case_idx == 0) print_perf(perf);
 
                 // 3. Verify
-                if (verify_bytes(ss_hw, ss_vec, SS_SIZE, "SharedSecret")) {
+                if (status != KEY_STATUS_OK) {
+                    std::cout << "FAIL" << std::endl;
+                    std::cout << "   -> Status " << status << " on valid dk" << std::endl;
+                } else if (verify_bytes(ss_hw, ss_vec, SS_SIZE, "SharedSecret")) {
                     std::cout << "PASS" << std::endl;
                     pass_count++;
                 } else {
                     std::cout << "FAIL" << std::endl;
                     std::cout << "   -> Shared Secret Mismatch" << std::endl;
                 }
+
+                // 4. Implicit rejection: sửa 1 bit ct -> ss phải là J(z || ct')
+                if (case_idx < REJECT_CASES) {
+                    ct_in[0] ^= 0x01;
+                    ml_kem_decaps(sk_in, ct_in, ss_hw, perf);
+                    bool rej_ok = true;
+                    for(int i=0; i<SS_SIZE; i++) if(ss_hw[i] != REJECT_SS[case_idx][i]) rej_ok = false;
+                    if (rej_ok) rej_pass++;
+                    else std::cout << "   -> Implicit Rejection Mismatch" << std::endl;
+                }
+
+                // 5. Hash check: sửa 1 bit ek nhúng trong dk -> KEY_STATUS_BAD_DK
+                if (case_idx == 0) {
+                    sk_in[KYBER_SK_EK_OFF] ^= 0x01;
+                    if (ml_kem_decaps(sk_in, ct_in, ss_hw, perf) == KEY_STATUS_BAD_DK) check_ok = true;
+                    else std::cout << "   -> Hash check: invalid dk not flagged" << std::endl;
+                }
+                case_idx++;
             } else {
                 std::cout << "SKIP (Data size mismatch)" << std::endl;
                 std::cout << "   Expected SK: " << SK_SIZE << ", Got: " << sk_vec.size() << std::endl;
@@ -126,8 +171,10 @@ int main() {
     }
 
     std::cout << "---------------------------------" << std::endl;
-    std::cout << "Summary: Passed " << pass_count << " test cases." << std::endl;
+    std::cout << "Implicit rejection: Passed " << rej_pass << " / " << REJECT_CASES << std::endl;
+    std::cout << "Hash check: " << (check_ok ? "OK" : "FAIL") << std::endl;
+    std::cout << "Summary: Passed " << pass_count << " / " << case_total << " test cases." << std::endl;
     
     file.close();
-    return 0;
+    return (case_total > 0 && pass_count == case_total && rej_pass == REJECT_CASES && check_ok) ? 0 : 1;
 }
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include "params.h"
+
+#define SK_SIZE KYBER_SK_BYTES
+#define CT_SIZE KYBER_CT_BYTES
+#define SS_SIZE 32
+#define N_CT 2
+
+// --- DUT ---
+int ml_kem_decaps_resident(int op, int n_ct, uint8 sk_in[SK_SIZE], uint8 ct_in[], uint8 ss_out[]);
+// Reference: kernel decaps thường
+int ml_kem_decaps(uint8 sk_in[SK_SIZE], uint8 ct_in[CT_SIZE], uint8 ss_out[SS_SIZE],
+                   perf_t perf[PERF_SLOTS]);
+
+std::vector<uint8_t> hex2bin(const std::string &hex) {
+    std::vector<uint8_t> bytes;
+    for (unsigned int i = 0; i < hex.length(); i += 2) {
+        std::string byteString = hex.substr(i, 2);
+        bytes.push_back((uint8_t)strtol(byteString.c_str(), NULL, 16));
+    }
+    return bytes;
+}
+
+// argv[1]: file KAT (mặc định theo ML_KEM_LEVEL)
+int main(int argc, char** argv) {
+    std::cout << "--- STARTING DK-RESIDENT DECAPS TEST ---" << std::endl;
+
+    uint8 sk_in[SK_SIZE], ct_in[N_CT * CT_SIZE], ss_hw[N_CT * SS_SIZE];
+    memset(sk_in, 0, sizeof(sk_in));
+    memset(ct_in, 0, sizeof(ct_in));
+
+    // Chưa nạp dk -> phải báo lỗi
+    if (ml_kem_decaps_resident(KEY_OP_RUN, 1, sk_in, ct_in, ss_hw) != KEY_STATUS_NO_KEY) {
+        std::cout << "FAIL: RUN before LOAD not rejected" << std::endl;
+        return 1;
+    }
+
+    // dk toàn 0: H(ek) != hash lưu trong dk -> LOAD báo lỗi và key không được nạp
+    if (ml_kem_decaps_resident(KEY_OP_LOAD, 1, sk_in, ct_in, ss_hw) != KEY_STATUS_BAD_DK ||
+        ml_kem_decaps_resident(KEY_OP_RUN, 1, sk_in, ct_in, ss_hw) != KEY_STATUS_NO_KEY) {
+        std::cout << "FAIL: invalid dk accepted by LOAD" << std::endl;
+        return 1;
+    }
+
+    const char* kat_file = (argc > 1) ? argv[1] : KYBER_KAT_FILE;
+    std::ifstream file(kat_file);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open " << kat_file << std::endl;
+        return 1;
+    }
+
+    std::string token, eq, hex_str;
+    std::vector<uint8_t> sk_vec, ct_vec, ss_vec;
+    bool has_sk = false, has_ct = false, has_ss = false;
+    int count = 0, pass_count = 0, fails = 0;
+
+    while (file >> token) {
+        if (token == "sk") { file >> eq >> hex_str; sk_vec = hex2bin(hex_str); has_sk = true; }
+        else if (token == "ct") { file >> eq >> hex_str; ct_vec = hex2bin(hex_str); has_ct = true; }
+        else if (token == "ss") { file >> eq >> hex_str; ss_vec = hex2bin(hex_str); has_ss = true; }
+
+        if (has_sk && has_ct && has_ss) {
+            memcpy(sk_in, sk_vec.data(), SK_SIZE);
+            ml_kem_decaps_resident(KEY_OP_LOAD, 0, sk_in, ct_in, ss_hw);
+            memset(sk_in, 0, SK_SIZE); // RUN không được đọc lại dk
+
+            // ct #0: ciphertext KAT, ct #1: ciphertext bị sửa 1 bit (implicit rejection)
+            memcpy(&ct_in[0], ct_vec.data(), CT_SIZE);
+            memcpy(&ct_in[CT_SIZE], ct_vec.data(), CT_SIZE);
+            ct_in[CT_SIZE] ^= 0x01;
+
+            int st = ml_kem_decaps_resident(KEY_OP_RUN, N_CT, sk_in, ct_in, ss_hw);
+            bool ok = (st == KEY_STATUS_OK);
+            for(int i=0; i<SS_SIZE; i++) if(ss_hw[i] != ss_vec[i]) ok = false;
+
+            uint8 ss_ref[SS_SIZE];
+            memcpy(sk_in, sk_vec.data(), SK_SIZE);
+            perf_t perf[PERF_SLOTS];
+            ml_kem_decaps(sk_in, &ct_in[CT_SIZE], ss_ref, perf);
+            if (memcmp(&ss_hw[SS_SIZE], ss_ref, sizeof(ss_ref)) != 0) ok = false;
+
+            count++;
+            if (ok) pass_count++;
+            else { std::cout << "Case #" << count << " FAIL" << std::endl; fails++; }
+
+            has_sk = has_ct = has_ss = false;
+        }
+    }
+    file.close();
+
+    // CLEAR: dk bị xoá, RUN sau đó phải báo NO_KEY
+    if (ml_kem_decaps_resident(KEY_OP_CLEAR, 0, sk_in, ct_in, ss_hw) != KEY_STATUS_OK ||
+        ml_kem_decaps_resident(KEY_OP_RUN, 1, sk_in, ct_in, ss_hw) != KEY_STATUS_NO_KEY) {
+        std::cout << "FAIL: RUN after CLEAR not rejected" << std::endl;
+        fails++;
+    }
+
+    std::cout << "---------------------------------" << std::endl;
+    std::cout << "Summary: Passed " << pass_count << " / " << count << " cases." << std::endl;
+    return fails;
+}
@@ -0,0 +1,176 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include "params.h"
+
+#define PK_SIZE KYBER_PK_BYTES
+#define SK_HW_SIZE KYBER_POLYVECBYTES
+#define CT_SIZE KYBER_CT_BYTES
+#define N_BATCH 3
+
+// --- DUT ---
+void drbg_generate(ap_uint<64> seed[4], ap_uint<64> ctr, uint8 domain, uint8 out[DRBG_OUT_BYTES]);
+void ml_kem_keygen(ap_uint<64> seed_d[4], ap_uint<64> seed_z[4], uint8 pk_out[PK_SIZE], uint8 sk_out[SK_HW_SIZE],
+                   perf_t perf[PERF_SLOTS]);
+void ml_kem_keygen_batch(ap_uint<64> drbg_seed[4], ap_uint<64> drbg_ctr, int mode, int n_ops,
+                         ap_uint<64> seeds_in[], uint8 pk_out[], uint8 sk_out[], uint8 z_out[]);
+int ml_kem_encaps_batch(ap_uint<64> drbg_seed[4], ap_uint<64> drbg_ctr, int mode, int n_ops,
+                         uint8 pk_in[], uint8 m_in[], uint8 ct_out[], uint8 ss_out[]);
+
+// SHAKE256(seed || ctr_le64 || domain), seed = 00 01 .. 1f (sinh bằng hashlib)
+const char* DRBG_EXP[4] = {
+    "3831631638a897df95d4571702f72f30a568f37851b6d00dc4f8bc88ee9966ed005a4661c2bbf71f6d70335849f36ed720aad57376b1c85c17cc6dacc2c0d4ca",
+    "da3401a3149ef35b0210c337c0c2e2e39299010e23c77be616d25facf7f564ce73ba7d7511c23289fa0874cb369c85b6d919ca44520ebf7958b7430e15d40b13",
+    "695dfb9daf4ed230a95aa83f0a9a7dc4a84a0e10a60329a1e80454b806cdef8f",
+    "52975c9f1da4226552de8b8959317947c54526bba11dc0ee1cd21bc7f8dba3d0"
+};
+const uint64_t DRBG_CTR[4] = {0, 1, 0, 0x0123456789abcdefULL};
+const int DRBG_DOM[4] = {DRBG_DOMAIN_KEYGEN, DRBG_DOMAIN_KEYGEN, DRBG_DOMAIN_ENCAPS, DRBG_DOMAIN_ENCAPS};
+
+std::vector<uint8_t> hex2bin(const std::string &hex) {
+    std::vector<uint8_t> bytes;
+    for (unsigned int i = 0; i < hex.length(); i += 2) {
+        std::string byteString = hex.substr(i, 2);
+        bytes.push_back((uint8_t)strtol(byteString.c_str(), NULL, 16));
+    }
+    return bytes;
+}
+
+bool same(uint8* hw, const uint8_t* ref, int len) {
+    for(int i=0; i<len; i++) if((uint8_t)hw[i] != ref[i]) return false;
+    return true;
+}
+
+// argv[1]: file KAT (mặc định theo ML_KEM_LEVEL)
+int main(int argc, char** argv) {
+    std::cout << "--- STARTING DRBG / BATCH TEST ---" << std::endl;
+    int fails = 0;
+
+    ap_uint<64> seed[4];
+    for(int i=0; i<4; i++) {
+        uint64_t w = 0;
+        for(int j=0; j<8; j++) w |= (uint64_t)(i*8+j) << (8*j);
+        seed[i] = w;
+    }
+
+    // --- TEST 1: DRBG output ---
+    for(int t=0; t<4; t++) {
+        uint8 out[DRBG_OUT_BYTES];
+        drbg_generate(seed, DRBG_CTR[t], DRBG_DOM[t], out);
+        std::vector<uint8_t> ref = hex2bin(DRBG_EXP[t]);
+        if(!same(out, ref.data(), ref.size())) {
+            std::cout << "[FAIL DRBG] vector " << t << std::endl;
+            fails++;
+        }
+    }
+
+    // --- Đọc N_BATCH case đầu của KAT ---
+    const char* kat_file = (argc > 1) ? argv[1] : KYBER_KAT_FILE;
+    std::ifstream file(kat_file);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open " << kat_file << std::endl;
+        return 1;
+    }
+    std::vector<uint8_t> d[N_BATCH], z[N_BATCH], pk[N_BATCH], sk[N_BATCH], m[N_BATCH], ct[N_BATCH], ss[N_BATCH];
+    std::string token, eq, hex_str;
+    int idx = -1;
+    while (file >> token && idx < N_BATCH) {
+        if (token == "d") { if (++idx >= N_BATCH) break; }
+        if (token == "d" || token == "z" || token == "pk" || token == "sk" ||
+            token == "m" || token == "ct" || token == "ss") {
+            file >> eq >> hex_str;
+            std::vector<uint8_t> v = hex2bin(hex_str);
+            if (token == "d") d[idx] = v;
+            else if (token == "z") z[idx] = v;
+            else if (token == "pk") pk[idx] = v;
+            else if (token == "sk") sk[idx] = v;
+            else if (token == "m") m[idx] = v;
+            else if (token == "ct") ct[idx] = v;
+            else ss[idx] = v;
+        }
+    }
+    file.close();
+
+    static uint8 pk_hw[N_BATCH * PK_SIZE], sk_hw[N_BATCH * SK_HW_SIZE], z_hw[N_BATCH * 32];
+
+    // --- TEST 2: Keygen batch, replay mode = KAT ---
+    ap_uint<64> seeds_in[N_BATCH * 8];
+    for(int op=0; op<N_BATCH; op++) {
+        for(int i=0; i<8; i++) {
+            uint64_t w = 0;
+            for(int j=0; j<8; j++) w |= (uint64_t)(i < 4 ? d[op][i*8+j] : z[op][(i-4)*8+j]) << (8*j);
+            seeds_in[op*8 + i] = w;
+        }
+    }
+    ml_kem_keygen_batch(seed, 0, DRBG_MODE_REPLAY, N_BATCH, seeds_in, pk_hw, sk_hw, z_hw);
+    for(int op=0; op<N_BATCH; op++) {
+        if(!same(&pk_hw[op*PK_SIZE], pk[op].data(), PK_SIZE) ||
+           !same(&sk_hw[op*SK_HW_SIZE], sk[op].data(), SK_HW_SIZE) ||
+           !same(&z_hw[op*32], z[op].data(), 32)) {
+            std::cout << "[FAIL KEYGEN REPLAY] op " << op << std::endl;
+            fails++;
+        }
+    }
+
+    // --- TEST 3: Keygen batch, live mode == keygen đơn với d từ DRBG ---
+    const uint64_t ctr0 = 100;
+    ml_kem_keygen_batch(seed, ctr0, DRBG_MODE_LIVE, N_BATCH, seeds_in, pk_hw, sk_hw, z_hw);
+    for(int op=0; op<N_BATCH; op++) {
+        uint8 dz[DRBG_OUT_BYTES];
+        drbg_generate(seed, ctr0 + op, DRBG_DOMAIN_KEYGEN, dz);
+        ap_uint<64> seed_d[4], seed_z[4];
+        for(int i=0; i<4; i++) {
+            uint64_t wd = 0, wz = 0;
+            for(int j=0; j<8; j++) {
+                wd |= (uint64_t)dz[i*8+j] << (8*j);
+                wz |= (uint64_t)dz[32+i*8+j] << (8*j);
+            }
+            seed_d[i] = wd; seed_z[i] = wz;
+        }
+        uint8 pk_ref[PK_SIZE], sk_ref[SK_HW_SIZE];
+        perf_t perf[PERF_SLOTS];
+        ml_kem_keygen(seed_d, seed_z, pk_ref, sk_ref, perf);
+        bool ok = true;
+        for(int i=0; i<PK_SIZE; i++) if(pk_hw[op*PK_SIZE+i] != pk_ref[i]) ok = false;
+        for(int i=0; i<SK_HW_SIZE; i++) if(sk_hw[op*SK_HW_SIZE+i] != sk_ref[i]) ok = false;
+        for(int i=0; i<32; i++) if(z_hw[op*32+i] != dz[32+i]) ok = false;
+        if(!ok) {
+            std::cout << "[FAIL KEYGEN LIVE] op " << op << std::endl;
+            fails++;
+        }
+    }
+
+    // --- TEST 4: Encaps batch, replay mode = KAT ---
+    static uint8 pk_in[N_BATCH * PK_SIZE], m_in[N_BATCH * 32], ct_hw[N_BATCH * CT_SIZE], ss_hw[N_BATCH * 32];
+    for(int op=0; op<N_BATCH; op++) {
+        memcpy(&pk_in[op*PK_SIZE], pk[op].data(), PK_SIZE);
+        memcpy(&m_in[op*32], m[op].data(), 32);
+    }
+    ml_kem_encaps_batch(seed, 0, DRBG_MODE_REPLAY, N_BATCH, pk_in, m_in, ct_hw, ss_hw);
+    for(int op=0; op<N_BATCH; op++) {
+        if(!same(&ct_hw[op*CT_SIZE], ct[op].data(), CT_SIZE) || !same(&ss_hw[op*32], ss[op].data(), 32)) {
+            std::cout << "[FAIL ENCAPS REPLAY] op " << op << std::endl;
+            fails++;
+        }
+    }
+
+    // --- TEST 5: Encaps batch, live mode phải tất định; mode khác REPLAY (vd thanh
+    //     ghi rác) cũng là live, không được đọc m_in ---
+    static uint8 ct_hw2[N_BATCH * CT_SIZE], ss_hw2[N_BATCH * 32];
+    ml_kem_encaps_batch(seed, 7, DRBG_MODE_LIVE, N_BATCH, pk_in, m_in, ct_hw, ss_hw);
+    ml_kem_encaps_batch(seed, 7, 0x5A, N_BATCH, pk_in, m_in, ct_hw2, ss_hw2);
+    if(memcmp(ct_hw, ct_hw2, sizeof(ct_hw)) != 0 || memcmp(ss_hw, ss_hw2, sizeof(ss_hw)) != 0) {
+        std::cout << "[FAIL ENCAPS LIVE] not deterministic / mode != REPLAY not live" << std::endl;
+        fails++;
+    }
+    if(same(ss_hw, ss[0].data(), 32)) {
+        std::cout << "[FAIL ENCAPS LIVE] m taken from m_in" << std::endl;
+        fails++;
+    }
+
+    if (fails == 0) std::cout << "ALL DRBG TESTS PASSED!" << std::endl;
+    else std::cout << "DRBG TESTS FAILED: " << fails << " errors." << std::endl;
+    return fails;
+}
@@ -0,0 +1,98 @@
+#include <iostream>
+#include <cstring>
+#include "aes_data.h"
+#include "params.h"
+#include "ap_int.h"
+
+// --- DUT ---
+void keccak_duplex_crypt(uint8 key[32], ap_uint<128> nonce, int decrypt, int n_bytes, beat_t* in, beat_t* out,
+                         beat_t* tag_out);
+
+#define MAX_BEATS ((FRAME_BYTES + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES)
+
+static beat_t buf_in[MAX_BEATS], buf_out[MAX_BEATS], tag[1];
+
+// byte -> beat (byte 0 ở bit [7:0]), phần đệm của beat cuối = 0
+static void to_beats(const uint8* src, int n, beat_t* dst) {
+    int beats = (n + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES;
+    for (int i = 0; i < beats; i++) {
+        beat_t w = 0;
+        for (int b = 0; b < AES_BLOCK_BYTES && i * AES_BLOCK_BYTES + b < n; b++)
+            w |= (beat_t)src[i * AES_BLOCK_BYTES + b] << (8 * b);
+        dst[i] = w;
+    }
+}
+
+static uint8 beat_byte(const beat_t* src, int idx) {
+    return (uint8)(src[idx / AES_BLOCK_BYTES] >> (8 * (idx % AES_BLOCK_BYTES)));
+}
+
+// Nonce 16 byte -> thanh ghi s_axilite (byte 0 ở bit [7:0])
+static ap_uint<128> nonce_reg(const uint8 nonce[16]) {
+    ap_uint<128> v = 0;
+    for (int b = 0; b < 16; b++) v |= (ap_uint<128>)nonce[b] << (8 * b);
+    return v;
+}
+
+// So out[0 .. n) với exp, in lỗi đầu tiên
+static int check(const beat_t* out, const uint8* exp, int n, const char* name) {
+    for (int i = 0; i < n; i++) {
+        if (beat_byte(out, i) != exp[i]) {
+            std::cout << "[FAIL " << name << "] idx=" << i << " HW=" << (int)beat_byte(out, i)
+                      << " Exp=" << (int)exp[i] << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "[PASS] " << name << std::endl;
+    return 0;
+}
+
+int main() {
+    std::cout << "--- STARTING KECCAK DUPLEX CIPHER TEST ---" << std::endl;
+    int fails = 0;
+    uint8 key[32];
+
+    // 1. Frame 32x32x3, so với Duplex_Lib.py
+    memcpy(key, FRAME_KEY, 32);
+    to_beats(FRAME_PT, FRAME_BYTES, buf_in);
+    keccak_duplex_crypt(key, nonce_reg(DX_FRAME_NONCE), 0, FRAME_BYTES, buf_in, buf_out, tag);
+    fails += check(buf_out, DX_FRAME_CT, FRAME_BYTES, "frame ct");
+    fails += check(tag, DX_FRAME_TAG, 16, "frame tag");
+
+    // 2. Giải mã: out = pt, tag tính lại khớp tag của bên mã hóa
+    to_beats(DX_FRAME_CT, FRAME_BYTES, buf_in);
+    keccak_duplex_crypt(key, nonce_reg(DX_FRAME_NONCE), 1, FRAME_BYTES, buf_in, buf_out, tag);
+    fails += check(buf_out, FRAME_PT, FRAME_BYTES, "frame decrypt");
+    fails += check(tag, DX_FRAME_TAG, 16, "frame decrypt tag");
+
+    // 3. Sửa 1 bit ciphertext -> tag khác
+    buf_in[5] ^= (beat_t)1;
+    keccak_duplex_crypt(key, nonce_reg(DX_FRAME_NONCE), 1, FRAME_BYTES, buf_in, buf_out, tag);
+    bool same = true;
+    for (int i = 0; i < 16; i++) if (beat_byte(tag, i) != DX_FRAME_TAG[i]) same = false;
+    if (same) {
+        std::cout << "[FAIL tamper] tag unchanged" << std::endl;
+        fails++;
+    } else {
+        std::cout << "[PASS] tamper detected" << std::endl;
+    }
+
+    // 4. Độ dài lẻ, đúng bội của rate, frame rỗng
+    memcpy(key, ODD_KEY, 32);
+    to_beats(ODD_PT, ODD_BYTES, buf_in);
+    keccak_duplex_crypt(key, nonce_reg(DX_ODD_NONCE), 0, ODD_BYTES, buf_in, buf_out, tag);
+    fails += check(buf_out, DX_ODD_CT, ODD_BYTES, "odd length ct");
+    fails += check(tag, DX_ODD_TAG, 16, "odd length tag");
+
+    keccak_duplex_crypt(key, nonce_reg(DX_ODD_NONCE), 0, DX_FULL_BYTES, buf_in, buf_out, tag);
+    fails += check(buf_out, DX_FULL_CT, DX_FULL_BYTES, "full blocks ct");
+    fails += check(tag, DX_FULL_TAG, 16, "full blocks tag");
+
+    keccak_duplex_crypt(key, nonce_reg(DX_ODD_NONCE), 0, 0, buf_in, buf_out, tag);
+    fails += check(tag, DX_EMPTY_TAG, 16, "empty frame tag");
+
+    std::cout << "---------------------------------" << std::endl;
+    if (fails == 0) std::cout << "ALL KECCAK DUPLEX TESTS PASSED!" << std::endl;
+    else std::cout << "KECCAK DUPLEX TESTS FAILED: " << fails << " errors." << std::endl;
+    return fails;
+}
@@ -6,22 +6,36 @@
 #include <cstring>
 #include "params.h"
 
-// Kích thước chuẩn cho Kyber-768
-#define PK_SIZE 1184
-#define CT_SIZE 1088
+// Kích thước theo bộ tham số đang build (params.h, ML_KEM_LEVEL)
+#define PK_SIZE KYBER_PK_BYTES
+#define CT_SIZE KYBER_CT_BYTES
 #define SS_SIZE 32
 #define MSG_SIZE 32
 
 // Khai báo DUT (Device Under Test)
-void ml_kem_encaps(
+int ml_kem_encaps(
     uint8 pk_in[PK_SIZE],
     uint8 randomness_m[32],
     uint8 ct_out[CT_SIZE],
-    uint8 ss_out[SS_SIZE]
+    uint8 ss_out[SS_SIZE],
+    perf_t perf[PERF_SLOTS]
 );
 
 // --- CÁC HÀM HỖ TRỢ ---
 
+// In số cycle theo phase (C-sim: số iteration pipeline, xem PERF_TICK)
+const char* PERF_NAMES[PERF_SLOTS] = {
+    "LOAD", "HASH", "XOF", "NOISE", "MATRIX", "INVNTT", "COMPRESS", "STORE", "COMPARE", "TOTAL"
+};
+
+void print_perf(perf_t perf[PERF_SLOTS]) {
+    std::cout << "Phase cycles (case #1):" << std::endl;
+    for(int i=0; i<PERF_SLOTS; i++) {
+        if(perf[i] == 0) continue;
+        std::cout << "  " << PERF_NAMES[i] << ": " << (unsigned long long)perf[i] << std::endl;
+    }
+}
+
 // Chuyển Hex String -> Vector Byte
 std::vector<uint8_t> hex2bin(const std::string &hex) {
     std::vector<uint8_t> bytes;
@@ -48,13 +62,14 @@ bool verify_bytes(uint8* hw, std::vector<uint8_t>& ref, int len, std::string nam
 }
 
 // --- MAIN ---
-int main() {
+// argv[1]: file KAT (mặc định theo ML_KEM_LEVEL)
+int main(int argc, char** argv) {
     std::cout << "--- STARTING KAT ENCAPSULATION TEST ---" << std::endl;
 
-    // Mở file KAT_768.txt
-    std::ifstream file("KAT_768.txt");
+    const char* kat_file = (argc > 1) ? argv[1] : KYBER_KAT_FILE;
+    std::ifstream file(kat_file);
     if (!file.is_open()) {
-        std::cerr << "Error: Could not open KAT_768.txt" << std::endl;
+        std::cerr << "Error: Could not open " << kat_file << std::endl;
         return 1;
     }
 
@@ -65,6 +80,9 @@ int main() {
     
     int count = 0;
     int pass_count = 0;
+    int case_total = 0;
+    bool first_case = true;
+    bool check_ok = true;
     
     // Cờ đánh dấu đã đọc đủ dữ liệu cho 1 case chưa
     bool has_pk = false, has_msg = false, has_ct = false, has_ss = false;
@@ -100,6 +118,7 @@ int main() {
 
         // KHI ĐÃ ĐỦ DỮ LIỆU -> CHẠY TEST NGAY
         if (has_pk && has_msg && has_ct && has_ss) {
+            case_total++;
             
             // 1. Prepare Buffers
             uint8 pk_in[PK_SIZE];
@@ -113,19 +132,34 @@ int main() {
                 memcpy(m_in, msg_vec.data(), MSG_SIZE);
 
                 // 2. Call Hardware
-                ml_kem_encaps(pk_in, m_in, ct_hw, ss_hw);
+                perf_t perf[PERF_SLOTS];
+                int status = ml_kem_encaps(pk_in, m_in, ct_hw, ss_hw, perf);
+                if (first_case) print_perf(perf);
 
                 // 3. Verify
                 bool p1 = verify_bytes(ct_hw, ct_vec, CT_SIZE, "Ciphertext");
                 bool p2 = verify_bytes(ss_hw, ss_vec, SS_SIZE, "SharedSecret");
+                bool p3 = (status == KEY_STATUS_OK);
 
-                if (p1 && p2) {
+                if (p1 && p2 && p3) {
                     std::cout << "PASS" << std::endl;
                     pass_count++;
                 } else {
                     std::cout << "FAIL" << std::endl;
                     if(!p1) std::cout << "   -> Ciphertext Mismatch" << std::endl;
                     if(!p2) std::cout << "   -> Shared Secret Mismatch" << std::endl;
+                    if(!p3) std::cout << "   -> Status " << status << " on valid ek" << std::endl;
+                }
+
+                // 4. Modulus check: hệ số đầu của t = 0xFFF >= q -> KEY_STATUS_BAD_EK
+                if (first_case) {
+                    pk_in[0] = 0xFF;
+                    pk_in[1] |= 0x0F;
+                    if (ml_kem_encaps(pk_in, m_in, ct_hw, ss_hw, perf) != KEY_STATUS_BAD_EK) {
+                        std::cout << "   -> Modulus check: invalid ek not flagged" << std::endl;
+                        check_ok = false;
+                    }
+                    first_case = false;
                 }
             } else {
                 std::cout << "SKIP (Data size mismatch)" << std::endl;
@@ -137,8 +171,9 @@ int main() {
     }
 
     std::cout << "---------------------------------" << std::endl;
-    std::cout << "Summary: Passed " << pass_count << " test cases." << std::endl;
+    std::cout << "Modulus check: " << (check_ok ? "OK" : "FAIL") << std::endl;
+    std::cout << "Summary: Passed " << pass_count << " / " << case_total << " test cases." << std::endl;
     
     file.close();
-    return 0;
+    return (case_total > 0 && pass_count == case_total && check_ok) ? 0 : 1;
 }
\ No newline at end of file
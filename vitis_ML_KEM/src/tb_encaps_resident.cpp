@@ -0,0 +1,106 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include "params.h"
+
+#define PK_SIZE KYBER_PK_BYTES
+#define CT_SIZE KYBER_CT_BYTES
+#define SS_SIZE 32
+#define MSG_SIZE 32
+
+// --- DUT ---
+int ml_kem_encaps_resident(int op, uint8 pk_in[PK_SIZE], uint8 randomness_m[32],
+                           uint8 ct_out[CT_SIZE], uint8 ss_out[SS_SIZE]);
+// Reference: kernel encaps thường
+int ml_kem_encaps(uint8 pk_in[PK_SIZE], uint8 randomness_m[32], uint8 ct_out[CT_SIZE], uint8 ss_out[SS_SIZE],
+                   perf_t perf[PERF_SLOTS]);
+
+std::vector<uint8_t> hex2bin(const std::string &hex) {
+    std::vector<uint8_t> bytes;
+    for (unsigned int i = 0; i < hex.length(); i += 2) {
+        std::string byteString = hex.substr(i, 2);
+        bytes.push_back((uint8_t)strtol(byteString.c_str(), NULL, 16));
+    }
+    return bytes;
+}
+
+bool verify_bytes(uint8* hw, std::vector<uint8_t>& ref, int len) {
+    for(int i=0; i<len; i++) if(hw[i] != ref[i]) return false;
+    return true;
+}
+
+// argv[1]: file KAT (mặc định theo ML_KEM_LEVEL)
+int main(int argc, char** argv) {
+    std::cout << "--- STARTING EK-RESIDENT ENCAPS TEST ---" << std::endl;
+
+    uint8 pk_in[PK_SIZE], m_in[MSG_SIZE], ct_hw[CT_SIZE], ss_hw[SS_SIZE];
+    memset(m_in, 0, sizeof(m_in));
+
+    // Chưa nạp ek -> phải báo lỗi
+    if (ml_kem_encaps_resident(KEY_OP_RUN, pk_in, m_in, ct_hw, ss_hw) != KEY_STATUS_NO_KEY) {
+        std::cout << "FAIL: RUN before LOAD not rejected" << std::endl;
+        return 1;
+    }
+
+    // ek có hệ số 0xFFF >= q -> LOAD báo lỗi và key không được nạp
+    memset(pk_in, 0xFF, sizeof(pk_in));
+    if (ml_kem_encaps_resident(KEY_OP_LOAD, pk_in, m_in, ct_hw, ss_hw) != KEY_STATUS_BAD_EK ||
+        ml_kem_encaps_resident(KEY_OP_RUN, pk_in, m_in, ct_hw, ss_hw) != KEY_STATUS_NO_KEY) {
+        std::cout << "FAIL: invalid ek accepted by LOAD" << std::endl;
+        return 1;
+    }
+
+    const char* kat_file = (argc > 1) ? argv[1] : KYBER_KAT_FILE;
+    std::ifstream file(kat_file);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open " << kat_file << std::endl;
+        return 1;
+    }
+
+    std::string token, eq, hex_str;
+    std::vector<uint8_t> pk_vec, msg_vec, ct_vec, ss_vec;
+    bool has_pk = false, has_msg = false, has_ct = false, has_ss = false;
+    int count = 0, pass_count = 0, fails = 0;
+
+    while (file >> token) {
+        if (token == "pk") { file >> eq >> hex_str; pk_vec = hex2bin(hex_str); has_pk = true; }
+        else if (token == "m") { file >> eq >> hex_str; msg_vec = hex2bin(hex_str); has_msg = true; }
+        else if (token == "ct") { file >> eq >> hex_str; ct_vec = hex2bin(hex_str); has_ct = true; }
+        else if (token == "ss") { file >> eq >> hex_str; ss_vec = hex2bin(hex_str); has_ss = true; }
+
+        if (has_pk && has_msg && has_ct && has_ss) {
+            // Encaps lần 1 với m của KAT (key vừa nạp)
+            memcpy(pk_in, pk_vec.data(), PK_SIZE);
+            memcpy(m_in, msg_vec.data(), MSG_SIZE);
+            ml_kem_encaps_resident(KEY_OP_LOAD, pk_in, m_in, ct_hw, ss_hw);
+
+            // Xoá pk_in: RUN không được đọc lại ek
+            memset(pk_in, 0, PK_SIZE);
+            int st = ml_kem_encaps_resident(KEY_OP_RUN, pk_in, m_in, ct_hw, ss_hw);
+            bool ok = (st == KEY_STATUS_OK) &&
+                      verify_bytes(ct_hw, ct_vec, CT_SIZE) && verify_bytes(ss_hw, ss_vec, SS_SIZE);
+
+            // Encaps lần 2 trên cùng ek với m khác -> so với kernel thường
+            uint8 m2[MSG_SIZE], ct_ref[CT_SIZE], ss_ref[SS_SIZE];
+            for(int i=0; i<MSG_SIZE; i++) m2[i] = (uint8)(msg_vec[i] ^ 0xA5);
+            ml_kem_encaps_resident(KEY_OP_RUN, pk_in, m2, ct_hw, ss_hw);
+            memcpy(pk_in, pk_vec.data(), PK_SIZE);
+            perf_t perf[PERF_SLOTS];
+            ml_kem_encaps(pk_in, m2, ct_ref, ss_ref, perf);
+            if (memcmp(ct_hw, ct_ref, sizeof(ct_ref)) != 0 || memcmp(ss_hw, ss_ref, sizeof(ss_ref)) != 0) ok = false;
+
+            count++;
+            if (ok) pass_count++;
+            else { std::cout << "Case #" << count << " FAIL" << std::endl; fails++; }
+
+            has_pk = has_msg = has_ct = has_ss = false;
+        }
+    }
+    file.close();
+
+    std::cout << "---------------------------------" << std::endl;
+    std::cout << "Summary: Passed " << pass_count << " / " << count << " cases." << std::endl;
+    return fails;
+}
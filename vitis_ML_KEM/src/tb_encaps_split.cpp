@@ -0,0 +1,94 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include "params.h"
+#include "hls_stream.h"
+
+#define PK_SIZE KYBER_PK_BYTES
+#define CT_SIZE KYBER_CT_BYTES
+#define SS_SIZE 32
+#define MSG_SIZE 32
+#define N_OPS 5 // không chia hết cho HW_XOF_ENGINES -> engine nhận số op khác nhau
+
+// --- DUT: HW_XOF_ENGINES kernel XOF + 1 kernel arith, nối bằng hls::stream ---
+void ml_kem_encaps_xof(int first, int stride, int n_ops, uint8 pk_in[], uint8 m_in[], uint8 ss_out[],
+                       hls::stream<xof_link_t>& poly_out);
+int ml_kem_encaps_arith(int n_ops, uint8 pk_in[], uint8 m_in[], hls::stream<xof_link_t> poly_in[HW_XOF_ENGINES],
+                        uint8 ct_out[]);
+
+std::vector<uint8_t> hex2bin(const std::string &hex) {
+    std::vector<uint8_t> bytes;
+    for (unsigned int i = 0; i < hex.length(); i += 2) {
+        std::string byteString = hex.substr(i, 2);
+        bytes.push_back((uint8_t)strtol(byteString.c_str(), NULL, 16));
+    }
+    return bytes;
+}
+
+// argv[1]: file KAT (mặc định theo ML_KEM_LEVEL)
+int main(int argc, char** argv) {
+    std::cout << "--- STARTING SPLIT XOF/ARITH ENCAPS TEST (" << HW_XOF_ENGINES
+              << " XOF engines) ---" << std::endl;
+
+    const char* kat_file = (argc > 1) ? argv[1] : KYBER_KAT_FILE;
+    std::ifstream file(kat_file);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open " << kat_file << std::endl;
+        return 1;
+    }
+
+    static uint8 pk_in[N_OPS * PK_SIZE], m_in[N_OPS * MSG_SIZE];
+    static uint8 ct_hw[N_OPS * CT_SIZE], ss_hw[N_OPS * SS_SIZE];
+    std::vector<uint8_t> ct_ref[N_OPS], ss_ref[N_OPS];
+
+    std::string token, eq, hex_str;
+    std::vector<uint8_t> pk_vec, msg_vec, ct_vec, ss_vec;
+    bool has_pk = false, has_msg = false, has_ct = false, has_ss = false;
+    int n = 0;
+
+    while (n < N_OPS && file >> token) {
+        if (token == "pk") { file >> eq >> hex_str; pk_vec = hex2bin(hex_str); has_pk = true; }
+        else if (token == "m") { file >> eq >> hex_str; msg_vec = hex2bin(hex_str); has_msg = true; }
+        else if (token == "ct") { file >> eq >> hex_str; ct_vec = hex2bin(hex_str); has_ct = true; }
+        else if (token == "ss") { file >> eq >> hex_str; ss_vec = hex2bin(hex_str); has_ss = true; }
+
+        if (has_pk && has_msg && has_ct && has_ss) {
+            memcpy(&pk_in[n * PK_SIZE], pk_vec.data(), PK_SIZE);
+            memcpy(&m_in[n * MSG_SIZE], msg_vec.data(), MSG_SIZE);
+            ct_ref[n] = ct_vec;
+            ss_ref[n] = ss_vec;
+            n++;
+            has_pk = has_msg = has_ct = has_ss = false;
+        }
+    }
+    file.close();
+    if (n < N_OPS) {
+        std::cerr << "Error: KAT has only " << n << " cases" << std::endl;
+        return 1;
+    }
+
+    // C-sim: các engine chạy trước, stream giữ toàn bộ đa thức cho kernel arith
+    hls::stream<xof_link_t> link[HW_XOF_ENGINES];
+    for(int e=0; e<HW_XOF_ENGINES; e++)
+        ml_kem_encaps_xof(e, HW_XOF_ENGINES, N_OPS, pk_in, m_in, ss_hw, link[e]);
+    int status = ml_kem_encaps_arith(N_OPS, pk_in, m_in, link, ct_hw);
+
+    int pass_count = 0;
+    for(int k=0; k<N_OPS; k++) {
+        bool ok = memcmp(&ct_hw[k * CT_SIZE], ct_ref[k].data(), CT_SIZE) == 0 &&
+                  memcmp(&ss_hw[k * SS_SIZE], ss_ref[k].data(), SS_SIZE) == 0;
+        std::cout << "Op #" << k << " (engine " << k % HW_XOF_ENGINES << "): " << (ok ? "PASS" : "FAIL") << std::endl;
+        if (ok) pass_count++;
+    }
+
+    bool drained = true;
+    for(int e=0; e<HW_XOF_ENGINES; e++) if (!link[e].empty()) drained = false;
+    if (!drained) std::cout << "FAIL: link not drained" << std::endl;
+    if (status != KEY_STATUS_OK) std::cout << "FAIL: status " << status << std::endl;
+
+    std::cout << "---------------------------------" << std::endl;
+    std::cout << "Summary: Passed " << pass_count << " / " << N_OPS << " ops." << std::endl;
+    return (pass_count == N_OPS && drained && status == KEY_STATUS_OK) ? 0 : 1;
+}
@@ -5,20 +5,34 @@
 #include <iomanip>
 #include "params.h"
 
-// Kích thước chuẩn cho Kyber-768
-#define PK_SIZE 1184 // 384*3 + 32
-#define SK_HW_SIZE 1152 // 384*3 (Chỉ phần s_hat encoded)
+// Kích thước theo bộ tham số đang build (params.h, ML_KEM_LEVEL)
+#define PK_SIZE KYBER_PK_BYTES // 384*k + 32
+#define SK_HW_SIZE KYBER_POLYVECBYTES // 384*k (Chỉ phần s_hat encoded)
 
 // Khai báo DUT
 void ml_kem_keygen(
     ap_uint<64> seed_d[4],
     ap_uint<64> seed_z[4],
     uint8 pk_out[PK_SIZE],
-    uint8 sk_out[SK_HW_SIZE]
+    uint8 sk_out[SK_HW_SIZE],
+    perf_t perf[PERF_SLOTS]
 );
 
 // --- HELPER FUNCTIONS ---
 
+// In số cycle theo phase (C-sim: số iteration pipeline, xem PERF_TICK)
+const char* PERF_NAMES[PERF_SLOTS] = {
+    "LOAD", "HASH", "XOF", "NOISE", "MATRIX", "INVNTT", "COMPRESS", "STORE", "COMPARE", "TOTAL"
+};
+
+void print_perf(perf_t perf[PERF_SLOTS]) {
+    std::cout << "Phase cycles (case #1):" << std::endl;
+    for(int i=0; i<PERF_SLOTS; i++) {
+        if(perf[i] == 0) continue;
+        std::cout << "  " << PERF_NAMES[i] << ": " << (unsigned long long)perf[i] << std::endl;
+    }
+}
+
 // 1. Hex String -> Vector Bytes
 std::vector<uint8_t> hex2bin(const std::string &hex) {
     std::vector<uint8_t> bytes;
@@ -43,18 +57,21 @@ void bytes_to_words(const std::vector<uint8_t>& bytes, ap_uint<64> words[4]) {
 }
 
 // --- MAIN ---
-int main() {
+// argv[1]: file KAT (mặc định theo ML_KEM_LEVEL)
+int main(int argc, char** argv) {
     std::cout << "--- STARTING KAT KEYGEN TEST (BYTE-LEVEL) ---" << std::endl;
 
-    std::ifstream file("KAT_768.txt");
+    const char* kat_file = (argc > 1) ? argv[1] : KYBER_KAT_FILE;
+    std::ifstream file(kat_file);
     if (!file.is_open()) {
-        std::cerr << "Error: Could not open KAT_768.txt" << std::endl;
+        std::cerr << "Error: Could not open " << kat_file << std::endl;
         return 1;
     }
 
     std::string line, token, eq, hex_str;
     std::vector<uint8_t> d_bytes, z_bytes, pk_ref, sk_ref;
-    int count = 0, pass_count = 0;
+    int count = 0, pass_count = 0, case_total = 0;
+    bool perf_shown = false;
 
     while (file >> token) {
         if (token == "count") {
@@ -76,6 +93,7 @@ int main() {
         else if (token == "sk") {
             file >> eq >> hex_str;
             sk_ref = hex2bin(hex_str);
+            case_total++;
 
             // --- CHẠY TEST KHI ĐỦ DỮ LIỆU ---
 
@@ -89,9 +107,11 @@ int main() {
             uint8 sk_hw[SK_HW_SIZE];
 
             // 3. Call Hardware
-            ml_kem_keygen(seed_d, seed_z, pk_hw, sk_hw);
+            perf_t perf[PERF_SLOTS];
+            ml_kem_keygen(seed_d, seed_z, pk_hw, sk_hw, perf);
+            if (!perf_shown) { print_perf(perf); perf_shown = true; }
 
-            // 4. Verify Public Key (PK) - So khớp 100% (1184 bytes)
+            // 4. Verify Public Key (PK) - So khớp 100% (PK_SIZE bytes)
             bool pk_pass = true;
             for(int i=0; i<PK_SIZE; i++) {
                 if((uint8_t)pk_hw[i] != pk_ref[i]) {
@@ -103,7 +123,7 @@ int main() {
                 }
             }
 
-            // 5. Verify Secret Key (SK) - So khớp phần đầu (1152 bytes)
+            // 5. Verify Secret Key (SK) - So khớp phần đầu (SK_HW_SIZE bytes)
             bool sk_pass = true;
             for(int i=0; i<SK_HW_SIZE; i++) {
                 if((uint8_t)sk_hw[i] != sk_ref[i]) {
@@ -128,7 +148,7 @@ int main() {
     }
 
     std::cout << "---------------------------------" << std::endl;
-    std::cout << "Summary: Passed " << pass_count << " / " << count+1 << " cases." << std::endl;
+    std::cout << "Summary: Passed " << pass_count << " / " << case_total << " cases." << std::endl;
     file.close();
-    return 0;
+    return (case_total > 0 && pass_count == case_total) ? 0 : 1;
 }
\ No newline at end of file
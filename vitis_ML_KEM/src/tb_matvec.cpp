@@ -0,0 +1,71 @@
+#include <iostream>
+#include "params.h"
+#include "poly_ops.h"
+
+#define NUM_TESTS 20
+
+extern void poly_pointwise(int16 a[256], int16 b[256], int16 r[256]);
+extern void matvec_At_t(int16 A_T[KYBER_K][KYBER_K][KYBER_N], int16 t_hat[KYBER_K][KYBER_N],
+                        int16 r_hat[KYBER_K][KYBER_N], int16 u[KYBER_K][KYBER_N], int16 v[KYBER_N]);
+extern void poly_basemul_acc(int16 acc[256], int16 a[KYBER_K][256], int16 b[KYBER_K][256]);
+
+static unsigned int rng_state = 2024;
+static int16 rnd_coeff() {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return (int16)((rng_state >> 8) % KYBER_Q);
+}
+
+// Tham chiếu: sum_j pointwise(M[j], x[j])
+static void ref_row(int16 M[KYBER_K][KYBER_N], int16 x[KYBER_K][KYBER_N], int16 out[KYBER_N]) {
+    int16 prod[KYBER_N];
+    for (int k = 0; k < KYBER_N; k++) out[k] = 0;
+    for (int j = 0; j < KYBER_K; j++) {
+        poly_pointwise(M[j], x[j], prod);
+        poly_add<1>(out, prod, out);
+    }
+}
+
+static int check(const int16 got[KYBER_N], const int16 exp[KYBER_N], const char* name, int t) {
+    for (int k = 0; k < KYBER_N; k++) {
+        if (got[k] != exp[k]) {
+            std::cout << "ERROR [" << name << "] test " << t << " index " << k
+                      << " got " << got[k] << " expected " << exp[k] << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main() {
+    std::cout << "--- STARTING MATVEC TEST (K=" << KYBER_K << ") ---" << std::endl;
+
+    static int16 A_T[KYBER_K][KYBER_K][KYBER_N];
+    static int16 t_hat[KYBER_K][KYBER_N], r_hat[KYBER_K][KYBER_N];
+    static int16 u[KYBER_K][KYBER_N], v[KYBER_N], exp_row[KYBER_N];
+
+    for (int t = 0; t < NUM_TESTS; t++) {
+        for (int i = 0; i < KYBER_K; i++)
+            for (int k = 0; k < KYBER_N; k++) {
+                t_hat[i][k] = rnd_coeff();
+                r_hat[i][k] = rnd_coeff();
+                for (int j = 0; j < KYBER_K; j++) A_T[i][j][k] = rnd_coeff();
+            }
+
+        matvec_At_t(A_T, t_hat, r_hat, u, v);
+
+        for (int i = 0; i < KYBER_K; i++) {
+            ref_row(A_T[i], r_hat, exp_row);
+            if (check(u[i], exp_row, "u", t)) return 1;
+        }
+        ref_row(t_hat, r_hat, exp_row);
+        if (check(v, exp_row, "v", t)) return 1;
+
+        // s^T o u của decaps
+        poly_basemul_acc(v, t_hat, r_hat);
+        if (check(v, exp_row, "basemul_acc", t)) return 1;
+    }
+
+    std::cout << "---------------------------------" << std::endl;
+    std::cout << "ALL MATVEC TESTS PASSED!" << std::endl;
+    return 0;
+}
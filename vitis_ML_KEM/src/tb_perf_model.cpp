@@ -0,0 +1,147 @@
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+#include "params.h"
+#include "perf_model.h"
+
+#define PK_SIZE KYBER_PK_BYTES
+#define SK_HW_SIZE KYBER_POLYVECBYTES
+#define SK_SIZE KYBER_SK_BYTES
+#define CT_SIZE KYBER_CT_BYTES
+#define SS_SIZE 32
+
+// --- DUT ---
+void ml_kem_keygen(ap_uint<64> seed_d[4], ap_uint<64> seed_z[4], uint8 pk_out[PK_SIZE],
+                   uint8 sk_out[SK_HW_SIZE], perf_t perf[PERF_SLOTS]);
+int ml_kem_encaps(uint8 pk_in[PK_SIZE], uint8 randomness_m[32], uint8 ct_out[CT_SIZE],
+                  uint8 ss_out[SS_SIZE], perf_t perf[PERF_SLOTS]);
+int ml_kem_decaps(uint8 sk_in[SK_SIZE], uint8 ct_in[CT_SIZE], uint8 ss_out[SS_SIZE],
+                  perf_t perf[PERF_SLOTS]);
+
+static const char* PERF_NAMES[PERF_SLOTS] = {
+    "LOAD", "HASH", "XOF", "NOISE", "MATRIX", "INVNTT", "COMPRESS", "STORE", "COMPARE", "TOTAL"
+};
+
+static unsigned int rng_state = 2025;
+static uint8 rnd_byte() {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return (uint8)(rng_state >> 16);
+}
+
+// work của model phải bằng perf[] C-sim tuyệt đối: SampleNTT trong C-sim cũng
+// đếm theo PERF_XOF_TRIPLES (PERF_ITERS_SAMPLE_NTT), không theo dữ liệu
+static int check_work(PmKernel kernel, const PmResult& r, perf_t perf[PERF_SLOTS]) {
+    int errors = 0;
+    for (int i = 0; i < PERF_SLOTS; i++) {
+        unsigned long long sim = (unsigned long long)perf[i];
+        if (r.work[i] != sim) {
+            std::cout << "ERROR [" << PM_KERNEL_NAMES[kernel] << "] " << PERF_NAMES[i]
+                      << ": model " << r.work[i] << " c-sim " << sim << std::endl;
+            errors++;
+        }
+    }
+    return errors;
+}
+
+// argv: KNOB=value ghi đè cấu hình dự đoán (vd HW_KEM_NTT=2 ML_KEM_LEVEL=1024), -v in critical path
+int main(int argc, char** argv) {
+    std::cout << "--- STARTING PERF MODEL TEST (ML-KEM-" << ML_KEM_LEVEL << ") ---" << std::endl;
+    int errors = 0;
+
+    // 1. Cấu trúc model so với C-sim (cùng level / knob lúc compile)
+    static uint8 pk[PK_SIZE], sk_s[SK_HW_SIZE], dk[SK_SIZE], ct[CT_SIZE], ss[SS_SIZE], m[32];
+    ap_uint<64> seed_d[4], seed_z[4];
+    for (int i = 0; i < 4; i++) {
+        uint64_t d = 0, z = 0;
+        for (int b = 0; b < 8; b++) {
+            d |= (uint64_t)rnd_byte() << (8 * b);
+            z |= (uint64_t)rnd_byte() << (8 * b);
+        }
+        seed_d[i] = d;
+        seed_z[i] = z;
+    }
+    for (int i = 0; i < 32; i++) m[i] = rnd_byte();
+
+    PmConfig base;
+    pm_default_config(base);
+    PmResult r;
+    perf_t perf[PERF_SLOTS];
+
+    ml_kem_keygen(seed_d, seed_z, pk, sk_s, perf);
+    pm_run(base, PM_KEYGEN, r);
+    errors += check_work(PM_KEYGEN, r, perf);
+
+    ml_kem_encaps(pk, m, ct, ss, perf);
+    pm_run(base, PM_ENCAPS, r);
+    errors += check_work(PM_ENCAPS, r, perf);
+
+    // dk = s || ek || H(ek) || z, H để 0 -> BAD_DK nhưng luồng tính toán như nhau
+    memcpy(dk, sk_s, SK_HW_SIZE);
+    memcpy(&dk[KYBER_SK_EK_OFF], pk, PK_SIZE);
+    ml_kem_decaps(dk, ct, ss, perf);
+    pm_run(base, PM_DECAPS, r);
+    errors += check_work(PM_DECAPS, r, perf);
+    std::cout << "Model work vs C-sim perf[]: " << (errors ? "FAIL" : "PASS") << std::endl;
+
+    // 2. Bớt tài nguyên không bao giờ làm kernel nhanh hơn
+    PmResult ref, less;
+    for (int k = 0; k < PM_KERNELS; k++) {
+        PmKernel kernel = (PmKernel)k;
+        pm_run(base, kernel, ref);
+        const char* cuts[] = { "HW_KEM_NTT=1", "HW_KG_NTT=1", "HW_KEM_KECCAK=1",
+                               "HW_KG_KECCAK=1", "HW_XOF_KECCAK=1", "HW_SAMPLER_II=6" };
+        for (int c = 0; c < 6; c++) {
+            PmConfig cfg = base;
+            pm_set(cfg, cuts[c]);
+            pm_run(cfg, kernel, less);
+            if (less.cycles[PERF_TOTAL] < ref.cycles[PERF_TOTAL]) {
+                std::cout << "ERROR [" << PM_KERNEL_NAMES[k] << "] " << cuts[c] << " faster: "
+                          << less.cycles[PERF_TOTAL] << " < " << ref.cycles[PERF_TOTAL] << std::endl;
+                errors++;
+            }
+        }
+    }
+
+    // 3. Bộ fit của pm_calibrate: perf[] sinh từ bộ hằng số đã biết phải được fit
+    //    lại gần đúng. Chỉ kiểm tra bộ fit hội tụ, KHÔNG phải độ chính xác model
+    //    (chưa có perf[] đo trên board, hằng số mặc định vẫn là placeholder).
+    {
+        PmConfig truth = base;
+        truth.keccak_lat = 30;
+        truth.bf_depth = 14;
+        truth.axi_lat = 120;
+        pm_run(truth, PM_DECAPS, r);
+        PmConfig fit = base;
+        double err = pm_calibrate(fit, PM_DECAPS, r.cycles);
+        std::cout << "Calibrate (synthetic perf[], fitter check): keccak_lat=" << fit.keccak_lat << " bf_depth=" << fit.bf_depth
+                  << " loop_ovh=" << fit.loop_ovh << " axi_lat=" << fit.axi_lat
+                  << " err=" << err << std::endl;
+        if (err > 0.005) {
+            std::cout << "ERROR: calibration residual " << err << std::endl;
+            errors++;
+        }
+    }
+
+    // 4. Dự đoán HW cho cấu hình yêu cầu (chưa calibrate -> pm_print gắn nhãn)
+    PmConfig cfg = base;
+    bool verbose = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0) verbose = true;
+        else if (!pm_set(cfg, argv[i])) {
+            std::cerr << "Error: bad knob " << argv[i] << std::endl;
+            return 1;
+        }
+    }
+    for (int k = 0; k < PM_KERNELS; k++) {
+        pm_run(cfg, (PmKernel)k, r);
+        pm_print(cfg, (PmKernel)k, r, verbose);
+    }
+
+    std::cout << "---------------------------------" << std::endl;
+    if (errors) {
+        std::cout << "PERF MODEL TEST FAILED (" << errors << " errors)" << std::endl;
+        return 1;
+    }
+    std::cout << "ALL PERF MODEL TESTS PASSED!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include <iostream>
+#include "params.h"
+#include "poly_ops.h"
+
+#define NUM_TESTS 50
+
+// LCG đơn giản để sinh input, không cần file data
+static unsigned int rng_state = 12345;
+static int rnd(int lo, int hi) {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return lo + (int)((rng_state >> 8) % (unsigned int)(hi - lo + 1));
+}
+
+static int mod_q(int x) {
+    x %= KYBER_Q;
+    return x < 0 ? x + KYBER_Q : x;
+}
+
+static int check(const int16 r[KYBER_N], const int ref[KYBER_N], const char* name, int lanes) {
+    for (int i = 0; i < KYBER_N; i++) {
+        if ((int)r[i] != ref[i]) {
+            std::cout << "ERROR [" << name << " L=" << lanes << "]: index " << i
+                      << " got " << (int)r[i] << " expected " << ref[i] << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+template <int L>
+int run_lanes() {
+    int err = 0;
+    for (int t = 0; t < NUM_TESTS; t++) {
+        int16 a[KYBER_N], b[KYBER_N], c[KYBER_N], r[KYBER_N];
+        int16 src[KYBER_K][KYBER_N];
+        int ref[KYBER_N];
+
+        // a: hệ số chuẩn [0, Q), b: nhiễu CBD có dấu, c: hệ số chuẩn
+        for (int i = 0; i < KYBER_N; i++) {
+            a[i] = rnd(0, KYBER_Q - 1);
+            b[i] = rnd(-3, 3);
+            c[i] = rnd(0, KYBER_Q - 1);
+            for (int j = 0; j < KYBER_K; j++) src[j][i] = rnd(0, KYBER_Q - 1);
+        }
+
+        poly_add<L>(a, c, r);
+        for (int i = 0; i < KYBER_N; i++) ref[i] = mod_q(a[i] + c[i]);
+        err |= check(r, ref, "poly_add", L);
+
+        poly_add<L>(a, b, r);
+        for (int i = 0; i < KYBER_N; i++) ref[i] = mod_q(a[i] + b[i]);
+        err |= check(r, ref, "poly_add signed", L);
+
+        poly_sub<L>(b, c, r);
+        for (int i = 0; i < KYBER_N; i++) ref[i] = mod_q(b[i] - c[i]);
+        err |= check(r, ref, "poly_sub", L);
+
+        poly_add3<L>(a, b, c, r);
+        for (int i = 0; i < KYBER_N; i++) ref[i] = mod_q(a[i] + b[i] + c[i]);
+        err |= check(r, ref, "poly_add3", L);
+
+        poly_acc<L, KYBER_K>(src, b, r);
+        for (int i = 0; i < KYBER_N; i++) {
+            int s = b[i];
+            for (int j = 0; j < KYBER_K; j++) s += src[j][i];
+            ref[i] = mod_q(s);
+        }
+        err |= check(r, ref, "poly_acc init", L);
+
+        poly_acc<L, KYBER_K>(src, r);
+        for (int i = 0; i < KYBER_N; i++) {
+            int s = 0;
+            for (int j = 0; j < KYBER_K; j++) s += src[j][i];
+            ref[i] = mod_q(s);
+        }
+        err |= check(r, ref, "poly_acc", L);
+
+        // Chuẩn hoá in-place trên toàn dải int16
+        for (int i = 0; i < KYBER_N; i++) {
+            r[i] = rnd(-32768, 32767);
+            ref[i] = mod_q(r[i]);
+        }
+        poly_reduce<L>(r);
+        err |= check(r, ref, "poly_reduce", L);
+
+        if (err) return err;
+    }
+    return 0;
+}
+
+int main() {
+    std::cout << "--- STARTING POLY_OPS TEST ---" << std::endl;
+    if (run_lanes<1>() || run_lanes<2>() || run_lanes<4>() || run_lanes<8>()) {
+        std::cout << ">> FAIL" << std::endl;
+        return 1;
+    }
+    std::cout << "---------------------------------" << std::endl;
+    std::cout << "ALL POLY_OPS TESTS PASSED!" << std::endl;
+    return 0;
+}
@@ -5,10 +5,8 @@
 #include "ap_int.h"
 
 // --- DECLARATIONS ---
-extern void poly_compress_u(int16 coeffs[256], uint8 output[320]);
-extern void poly_decompress_u(uint8 input[320], int16 coeffs[256]);
-extern void poly_compress_v(int16 coeffs[256], uint8 output[128]);
-extern void poly_decompress_v(uint8 input[128], int16 coeffs[256]);
+template <int D> void poly_compress(int16 coeffs[256], uint8 output[D * 32]);
+template <int D> void poly_decompress(uint8 input[D * 32], int16 coeffs[256]);
 extern void poly_tomsg(int16 coeffs[256], uint8 output[32]);
 extern void poly_frommsg(uint8 msg[32], int16 coeffs[256]);
 
@@ -43,25 +41,37 @@ int main() {
         int16 poly_in[256];
         for(int i=0; i<256; i++) poly_in[i] = INPUT_POLY[t][i];
         
-        // 1. Test Compress U
+        // 1. Test Compress U (d=10)
         uint8 comp_u_out[320];
-        poly_compress_u(poly_in, comp_u_out);
+        poly_compress<10>(poly_in, comp_u_out);
         if(check_bytes(comp_u_out, EXP_COMP_U[t], 320, "Compress U")) fails++;
         
         // 2. Test Decompress U
         int16 decomp_u_out[256];
-        poly_decompress_u(comp_u_out, decomp_u_out);
+        poly_decompress<10>(comp_u_out, decomp_u_out);
         if(check_coeffs(decomp_u_out, EXP_DECOMP_U[t], "Decompress U")) fails++;
         
-        // 3. Test Compress V
+        // 3. Test Compress V (d=4)
         uint8 comp_v_out[128];
-        poly_compress_v(poly_in, comp_v_out);
+        poly_compress<4>(poly_in, comp_v_out);
         if(check_bytes(comp_v_out, EXP_COMP_V[t], 128, "Compress V")) fails++;
         
         // 4. Test Decompress V
         int16 decomp_v_out[256];
-        poly_decompress_v(comp_v_out, decomp_v_out);
+        poly_decompress<4>(comp_v_out, decomp_v_out);
         if(check_coeffs(decomp_v_out, EXP_DECOMP_V[t], "Decompress V")) fails++;
+
+        // 4b. ML-KEM-1024: du=11, dv=5
+        uint8 comp_u11_out[352], comp_v5_out[160];
+        int16 decomp_u11_out[256], decomp_v5_out[256];
+        poly_compress<11>(poly_in, comp_u11_out);
+        if(check_bytes(comp_u11_out, EXP_COMP_U11[t], 352, "Compress U11")) fails++;
+        poly_decompress<11>(comp_u11_out, decomp_u11_out);
+        if(check_coeffs(decomp_u11_out, EXP_DECOMP_U11[t], "Decompress U11")) fails++;
+        poly_compress<5>(poly_in, comp_v5_out);
+        if(check_bytes(comp_v5_out, EXP_COMP_V5[t], 160, "Compress V5")) fails++;
+        poly_decompress<5>(comp_v5_out, decomp_v5_out);
+        if(check_coeffs(decomp_v5_out, EXP_DECOMP_V5[t], "Decompress V5")) fails++;
         
         // 5. Test ToMsg
         uint8 msg_out[32];
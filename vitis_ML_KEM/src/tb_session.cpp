@@ -0,0 +1,264 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include "params.h"
+
+#define PK_SIZE KYBER_PK_BYTES
+#define SK_SIZE KYBER_SK_BYTES
+#define CT_SIZE KYBER_CT_BYTES
+#define SS_SIZE 32
+#define N_SESS 2
+#define FRAME_BYTES 1000 // block cuối lẻ
+#define FRAME_BEATS ((FRAME_BYTES + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES)
+
+// --- DUT ---
+int ml_kem_session_encaps(int op, int slot, ap_uint<64> drbg_seed[4], int mode, uint8 pk_in[PK_SIZE],
+                          uint8 ct_out[CT_SIZE], ap_uint<64> nonce, ap_uint<64> ctr0, int n_bytes, beat_t* frame_in, beat_t* frame_out,
+                          beat_t* tag_out);
+int ml_kem_session_decaps(int op, int slot, uint8 sk_in[SK_SIZE], uint8 ct_in[CT_SIZE],
+                          ap_uint<64> nonce, ap_uint<64> ctr0, int n_bytes, beat_t* frame_in, beat_t* frame_out,
+                          beat_t* tag_out);
+// Reference: kernel cipher độc lập với ss của KAT làm key (tb_aes_ctr / tb_duplex kiểm tra riêng)
+void aes256_ctr(uint8 key[32], ap_uint<64> nonce, ap_uint<64> ctr0, int n_bytes, beat_t* in, beat_t* out);
+void keccak_duplex_crypt(uint8 key[32], ap_uint<128> nonce, int decrypt, int n_bytes, beat_t* in, beat_t* out,
+                         beat_t* tag_out);
+// Reference ratchet: SHAKE256 của shake_stream.cpp (tb_shake kiểm tra riêng)
+extern void shake256_prf(uint8 input[33], uint64_t output_64[16]);
+// Phía host đoán m: DRBG / encaps thường (tb_drbg / tb_encaps kiểm tra riêng)
+void drbg_generate(ap_uint<64> seed[4], ap_uint<64> ctr, uint8 domain, uint8 out[DRBG_OUT_BYTES]);
+int ml_kem_encaps(uint8 pk_in[PK_SIZE], uint8 randomness_m[32], uint8 ct_out[CT_SIZE], uint8 ss_out[SS_SIZE],
+                  perf_t perf[PERF_SLOTS]);
+
+std::vector<uint8_t> hex2bin(const std::string &hex) {
+    std::vector<uint8_t> bytes;
+    for (unsigned int i = 0; i < hex.length(); i += 2) {
+        std::string byteString = hex.substr(i, 2);
+        bytes.push_back((uint8_t)strtol(byteString.c_str(), NULL, 16));
+    }
+    return bytes;
+}
+
+static unsigned int rng_state = 2025;
+static uint8 rnd_byte() {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return (uint8)(rng_state >> 16);
+}
+
+// Frame tham chiếu = cipher(key) của frame pt
+static void ref_crypt(uint8 key[SS_SIZE], ap_uint<64> nonce, ap_uint<64> ctr0, beat_t* pt, beat_t* ref, beat_t* tag_ref) {
+#if HW_SESSION_CIPHER == SESSION_CIPHER_DUPLEX
+    keccak_duplex_crypt(key, ((ap_uint<128>)ctr0 << 64) | (ap_uint<128>)nonce, 0, FRAME_BYTES, pt, ref, tag_ref);
+#else
+    (void)tag_ref; // AES-CTR không có tag
+    aes256_ctr(key, nonce, ctr0, FRAME_BYTES, pt, ref);
+#endif
+}
+
+static bool same_frame(const beat_t* a, const beat_t* b) {
+    for (int i = 0; i < FRAME_BEATS; i++) if (a[i] != b[i]) return false;
+    return true;
+}
+
+// argv[1]: file KAT (mặc định theo ML_KEM_LEVEL)
+int main(int argc, char** argv) {
+    std::cout << "--- STARTING SESSION (KEM -> " << (HW_SESSION_CIPHER == SESSION_CIPHER_DUPLEX ? "DUPLEX" : "AES")
+              << ") TEST (" << HW_SESSION_SLOTS << " slots) ---" << std::endl;
+
+    static uint8 pk_in[PK_SIZE], sk_in[SK_SIZE], ct[CT_SIZE];
+    static beat_t pt[FRAME_BEATS], enc[FRAME_BEATS], dec[FRAME_BEATS], ref[FRAME_BEATS];
+    beat_t tag[1], tag_ref[1];
+    memset(pk_in, 0, sizeof(pk_in));
+    memset(sk_in, 0, sizeof(sk_in));
+    for (int i = 0; i < FRAME_BEATS; i++) {
+        beat_t w = 0;
+        for (int b = 0; b < AES_BLOCK_BYTES; b++)
+            if (i * AES_BLOCK_BYTES + b < FRAME_BYTES) w |= (beat_t)rnd_byte() << (8 * b);
+        pt[i] = w;
+    }
+    // seed: entropy host ghi cho LIVE; seed_m: m của KAT cho REPLAY
+    ap_uint<64> seed[4], seed_m[4];
+    for (int i = 0; i < 4; i++) {
+        uint64_t w = 0;
+        for (int j = 0; j < 8; j++) w |= (uint64_t)rnd_byte() << (8 * j);
+        seed[i] = w;
+        seed_m[i] = 0;
+    }
+    ap_uint<64> nonce = 0x1234567890abcdefULL;
+    int fails = 0;
+
+    // Chưa có key / slot ngoài dải
+    if (ml_kem_session_encaps(SESSION_OP_CRYPT, 0, seed, DRBG_MODE_LIVE, pk_in, ct, nonce, 0, FRAME_BYTES, pt, enc, tag) != KEY_STATUS_NO_KEY ||
+        ml_kem_session_decaps(SESSION_OP_CRYPT, 0, sk_in, ct, nonce, 0, FRAME_BYTES, enc, dec, tag) != KEY_STATUS_NO_KEY) {
+        std::cout << "FAIL: CRYPT before KEM not rejected" << std::endl;
+        fails++;
+    }
+    if (ml_kem_session_encaps(SESSION_OP_KEM, HW_SESSION_SLOTS, seed, DRBG_MODE_LIVE, pk_in, ct, nonce, 0, 0, pt, enc, tag) != KEY_STATUS_BAD_SLOT ||
+        ml_kem_session_decaps(SESSION_OP_KEM, -1, sk_in, ct, nonce, 0, 0, enc, dec, tag) != KEY_STATUS_BAD_SLOT) {
+        std::cout << "FAIL: out-of-range slot accepted" << std::endl;
+        fails++;
+    }
+
+    const char* kat_file = (argc > 1) ? argv[1] : KYBER_KAT_FILE;
+    std::ifstream file(kat_file);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open " << kat_file << std::endl;
+        return 1;
+    }
+
+    std::string token, eq, hex_str;
+    std::vector<uint8_t> pk_vec, sk_vec, msg_vec, ct_vec, ss_vec;
+    std::vector<uint8_t> ss_ref[N_SESS];
+    bool has_pk = false, has_sk = false, has_msg = false, has_ct = false, has_ss = false;
+    int n = 0;
+
+    // 1. Mỗi case KAT = 1 phiên ở slot n: ct ra host khớp KAT, ss chỉ nằm trong slot
+    while (n < N_SESS && file >> token) {
+        if (token == "pk") { file >> eq >> hex_str; pk_vec = hex2bin(hex_str); has_pk = true; }
+        else if (token == "sk") { file >> eq >> hex_str; sk_vec = hex2bin(hex_str); has_sk = true; }
+        else if (token == "m") { file >> eq >> hex_str; msg_vec = hex2bin(hex_str); has_msg = true; }
+        else if (token == "ct") { file >> eq >> hex_str; ct_vec = hex2bin(hex_str); has_ct = true; }
+        else if (token == "ss") { file >> eq >> hex_str; ss_vec = hex2bin(hex_str); has_ss = true; }
+
+        if (has_pk && has_sk && has_msg && has_ct && has_ss) {
+            memcpy(pk_in, pk_vec.data(), PK_SIZE);
+            memcpy(sk_in, sk_vec.data(), SK_SIZE);
+            for (int i = 0; i < 4; i++) {
+                uint64_t w = 0;
+                for (int j = 0; j < 8; j++) w |= (uint64_t)msg_vec[i * 8 + j] << (8 * j);
+                seed_m[i] = w;
+            }
+            int st_c = ml_kem_session_encaps(SESSION_OP_KEM, n, seed_m, DRBG_MODE_REPLAY, pk_in, ct, 0, 0, 0, pt, enc, tag);
+            bool ok = (st_c == KEY_STATUS_OK) && memcmp(ct, ct_vec.data(), CT_SIZE) == 0;
+            int st_s = ml_kem_session_decaps(SESSION_OP_KEM, n, sk_in, ct, 0, 0, 0, enc, dec, tag);
+            ok = ok && (st_s == KEY_STATUS_OK);
+            std::cout << "Session #" << n << " KEM: " << (ok ? "PASS" : "FAIL") << std::endl;
+            if (!ok) fails++;
+            ss_ref[n] = ss_vec;
+            n++;
+            has_pk = has_sk = has_msg = has_ct = has_ss = false;
+        }
+    }
+    file.close();
+    if (n < N_SESS) {
+        std::cerr << "Error: KAT has only " << n << " cases" << std::endl;
+        return 1;
+    }
+
+    // 2. Frame: client mã hóa = cipher(ss KAT), server giải mã lại được, slot độc lập
+    ap_uint<64> ctr0 = 7;
+    for (int k = 0; k < N_SESS; k++) {
+        uint8 key[SS_SIZE];
+        for (int i = 0; i < SS_SIZE; i++) key[i] = ss_ref[k][i];
+        ref_crypt(key, nonce, ctr0, pt, ref, tag_ref);
+
+        int st_c = ml_kem_session_encaps(SESSION_OP_CRYPT, k, seed, DRBG_MODE_LIVE, pk_in, ct, nonce, ctr0, FRAME_BYTES, pt, enc, tag);
+        bool ok = same_frame(enc, ref);
+#if HW_SESSION_CIPHER == SESSION_CIPHER_DUPLEX
+        ok = ok && tag[0] == tag_ref[0];
+#endif
+        int st_s = ml_kem_session_decaps(SESSION_OP_DECRYPT, k, sk_in, ct, nonce, ctr0, FRAME_BYTES, enc, dec, tag);
+#if HW_SESSION_CIPHER == SESSION_CIPHER_DUPLEX
+        ok = ok && tag[0] == tag_ref[0]; // server tính lại đúng tag của client
+#endif
+        ok = ok && st_c == KEY_STATUS_OK && st_s == KEY_STATUS_OK && same_frame(dec, pt);
+        std::cout << "Session #" << k << " frame: " << (ok ? "PASS" : "FAIL") << std::endl;
+        if (!ok) fails++;
+    }
+
+    // 2b. RATCHET slot 0 ở 2 phía (2 epoch): key = SHAKE256(key || 0xFF), 2 phía vẫn khớp
+    {
+        uint8 key[SS_SIZE], prf_in[SS_SIZE + 1];
+        uint64_t prf_out[16];
+        for (int i = 0; i < SS_SIZE; i++) key[i] = ss_ref[0][i];
+        for (int e = 0; e < 2; e++) {
+            memcpy(prf_in, key, SS_SIZE);
+            prf_in[SS_SIZE] = SESSION_RATCHET_DS;
+            shake256_prf(prf_in, prf_out);
+            for (int i = 0; i < SS_SIZE; i++) key[i] = (uint8)(prf_out[i / 8] >> (8 * (i % 8)));
+        }
+        ref_crypt(key, nonce, ctr0, pt, ref, tag_ref);
+
+        int st = 0;
+        for (int e = 0; e < 2; e++) {
+            st |= ml_kem_session_encaps(SESSION_OP_RATCHET, 0, seed, DRBG_MODE_LIVE, pk_in, ct, 0, 0, 0, pt, enc, tag);
+            st |= ml_kem_session_decaps(SESSION_OP_RATCHET, 0, sk_in, ct, 0, 0, 0, enc, dec, tag);
+        }
+        st |= ml_kem_session_encaps(SESSION_OP_CRYPT, 0, seed, DRBG_MODE_LIVE, pk_in, ct, nonce, ctr0, FRAME_BYTES, pt, enc, tag);
+        bool ok = same_frame(enc, ref);
+        st |= ml_kem_session_decaps(SESSION_OP_DECRYPT, 0, sk_in, ct, nonce, ctr0, FRAME_BYTES, enc, dec, tag);
+        ok = ok && st == KEY_STATUS_OK && same_frame(dec, pt);
+#if HW_SESSION_CIPHER == SESSION_CIPHER_DUPLEX
+        ok = ok && tag[0] == tag_ref[0];
+#endif
+        // slot 1 không bị ratchet theo
+        for (int i = 0; i < SS_SIZE; i++) key[i] = ss_ref[1][i];
+        ref_crypt(key, nonce, ctr0, pt, ref, tag_ref);
+        ml_kem_session_encaps(SESSION_OP_CRYPT, 1, seed, DRBG_MODE_LIVE, pk_in, ct, nonce, ctr0, FRAME_BYTES, pt, enc, tag);
+        ok = ok && same_frame(enc, ref);
+        std::cout << "Session #0 ratchet x2: " << (ok ? "PASS" : "FAIL") << std::endl;
+        if (!ok) fails++;
+    }
+
+    // 3. CLEAR: slot 0 hết key, slot 1 không bị ảnh hưởng
+    ml_kem_session_encaps(SESSION_OP_CLEAR, 0, seed, DRBG_MODE_LIVE, pk_in, ct, 0, 0, 0, pt, enc, tag);
+    if (ml_kem_session_encaps(SESSION_OP_CRYPT, 0, seed, DRBG_MODE_LIVE, pk_in, ct, nonce, 0, FRAME_BYTES, pt, enc, tag) != KEY_STATUS_NO_KEY ||
+        ml_kem_session_encaps(SESSION_OP_RATCHET, 0, seed, DRBG_MODE_LIVE, pk_in, ct, 0, 0, 0, pt, enc, tag) != KEY_STATUS_NO_KEY ||
+        ml_kem_session_encaps(SESSION_OP_CRYPT, 1, seed, DRBG_MODE_LIVE, pk_in, ct, nonce, 0, FRAME_BYTES, pt, enc, tag) != KEY_STATUS_OK) {
+        std::cout << "FAIL: CLEAR" << std::endl;
+        fails++;
+    }
+
+    // 4. Rekey bằng ek / dk lỗi -> slot bị vô hiệu, không giữ key cũ
+    memset(pk_in, 0xFF, PK_SIZE); // ByteDecode_12 = 4095 >= q
+    memset(sk_in, 0, SK_SIZE);    // H(ek) != hash trong dk
+    if (ml_kem_session_encaps(SESSION_OP_KEM, 1, seed, DRBG_MODE_LIVE, pk_in, ct, 0, 0, 0, pt, enc, tag) != KEY_STATUS_BAD_EK ||
+        ml_kem_session_encaps(SESSION_OP_CRYPT, 1, seed, DRBG_MODE_LIVE, pk_in, ct, nonce, 0, FRAME_BYTES, pt, enc, tag) != KEY_STATUS_NO_KEY ||
+        ml_kem_session_decaps(SESSION_OP_KEM, 1, sk_in, ct, 0, 0, 0, enc, dec, tag) != KEY_STATUS_BAD_DK ||
+        ml_kem_session_decaps(SESSION_OP_CRYPT, 1, sk_in, ct, nonce, 0, FRAME_BYTES, enc, dec, tag) != KEY_STATUS_NO_KEY) {
+        std::cout << "FAIL: invalid ek / dk armed a slot" << std::endl;
+        fails++;
+    }
+
+    // 5. LIVE: m sinh on-chip, host không tính lại được key từ những gì nó ghi.
+    //    KEM đầu chỉ để DRBG state rời giá trị reset (state = 0 thì m chỉ còn
+    //    phụ thuộc drbg_seed). KEM thứ 2 cùng seed phải ra ct khác, không trùng
+    //    với m = seed hay m = DRBG(seed, ctr) host tự tính, và 2 phía vẫn khớp key.
+    memcpy(pk_in, pk_vec.data(), PK_SIZE);
+    memcpy(sk_in, sk_vec.data(), SK_SIZE);
+    {
+        static uint8 ct1[CT_SIZE], ct_g[CT_SIZE];
+        int st = ml_kem_session_encaps(SESSION_OP_KEM, 0, seed, DRBG_MODE_LIVE, pk_in, ct1, 0, 0, 0, pt, enc, tag);
+        st |= ml_kem_session_encaps(SESSION_OP_KEM, 0, seed, DRBG_MODE_LIVE, pk_in, ct, 0, 0, 0, pt, enc, tag);
+        st |= ml_kem_session_decaps(SESSION_OP_KEM, 0, sk_in, ct, 0, 0, 0, enc, dec, tag);
+        st |= ml_kem_session_encaps(SESSION_OP_CRYPT, 0, seed, DRBG_MODE_LIVE, pk_in, ct, nonce, ctr0, FRAME_BYTES, pt, enc, tag);
+        st |= ml_kem_session_decaps(SESSION_OP_DECRYPT, 0, sk_in, ct, nonce, ctr0, FRAME_BYTES, enc, dec, tag);
+        bool ok = st == KEY_STATUS_OK && same_frame(dec, pt) && memcmp(ct, ct1, CT_SIZE) != 0;
+
+        // Các m host dựng được: seed thô, DRBG(seed, ctr) với mọi ctr host có thể
+        // đếm được (số lần KEM từ reset < N_GUESS)
+        const int N_GUESS = 16;
+        uint8 m_guess[1 + N_GUESS][32];
+        for (int i = 0; i < 32; i++) m_guess[0][i] = (uint8)(seed[i / 8] >> (8 * (i % 8)));
+        for (int c = 0; c < N_GUESS; c++) {
+            uint8 out[DRBG_OUT_BYTES];
+            drbg_generate(seed, c, DRBG_DOMAIN_ENCAPS, out);
+            memcpy(m_guess[1 + c], out, 32);
+        }
+        for (int g = 0; g < 1 + N_GUESS; g++) {
+            uint8 ss_g[SS_SIZE];
+            perf_t perf[PERF_SLOTS];
+            ml_kem_encaps(pk_in, m_guess[g], ct_g, ss_g, perf);
+            ref_crypt(ss_g, nonce, ctr0, pt, ref, tag_ref);
+            if (memcmp(ct_g, ct, CT_SIZE) == 0 || same_frame(enc, ref)) ok = false;
+        }
+        std::cout << "Session #0 live DRBG m: " << (ok ? "PASS" : "FAIL") << std::endl;
+        if (!ok) fails++;
+    }
+
+    std::cout << "---------------------------------" << std::endl;
+    if (fails == 0) std::cout << "ALL SESSION TESTS PASSED!" << std::endl;
+    else std::cout << "SESSION TESTS FAILED: " << fails << " errors." << std::endl;
+    return fails;
+}
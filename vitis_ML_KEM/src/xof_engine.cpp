@@ -0,0 +1,274 @@
+#include "params.h"
+#include "hls_stream.h"
+#include "ap_int.h"
+
+// --- EXTERN DECLARATIONS ---
+extern void keccak_f1600(uint64_t state[25]);
+template <int ETA> void sample_poly_cbd(uint8 seed[32], uint8 nonce, int16 coeffs[KYBER_N]);
+extern void xof_absorb_squeeze(ap_uint<64> input_B[5], hls::stream<uint8>& out_stream);
+extern void parse_ntt_pairs(hls::stream<uint8>& in_bytes, hls::stream<coef_pair_t>& out_pairs);
+
+#define PK_SIZE  KYBER_PK_BYTES
+#define PK_BEATS (PK_SIZE / AXI_BEAT_BYTES) // 74 (768)
+
+#define ENCAPS_BATCH_MAX 64
+// depth m_axi của batch: đủ ENCAPS_BATCH_MAX op (co-sim)
+#define PK_BATCH_BYTES (PK_SIZE * ENCAPS_BATCH_MAX)
+#define M_BATCH_BYTES  (32 * ENCAPS_BATCH_MAX)
+#define SS_BATCH_BYTES (32 * ENCAPS_BATCH_MAX)
+
+// =========================================================
+// XOF ENGINE: toàn bộ Keccak của Encaps trong 1 kernel riêng
+// =========================================================
+// Kernel này giữ H(ek), G(m || H(ek)), SHAKE128 của SampleNTT cho A^T
+// (K hàng dùng chung HW_XOF_KECCAK Keccak) và 1 lane SHAKE256 (PRF + CBD cho
+// r, e1, e2), xuất đa thức đã sample qua AXIS sang ml_kem_encaps_arith (NTT, basemul, inv_ntt, compress, packing).
+// Không có Keccak nào trong kernel arith và không có NTT nào ở đây, nên
+// 2 phần scale độc lập: host có thể đặt HW_XOF_ENGINES kernel XOF / 1 arith.
+//
+// Thứ tự word trên poly_out của 1 op (XOF_LINK_* trong params.h):
+//   A^T: for j, for q < 64, for c < K: A_T[c][j][4q .. 4q+3]
+//        (K hàng expand song song, gom xen kẽ từng word)
+//   r[0..K-1], e1[0..K-1], e2: 64 word / đa thức, hệ số int16 có dấu
+
+// rho -> SampleNTT, beat ek -> sponge H(ek)
+static void xe_read_ek(
+    uint8 pk_in[PK_SIZE],
+    hls::stream<ap_uint<64> >& rho_strm,
+    hls::stream<beat_t>& hash_strm
+) {
+    #pragma HLS INLINE off
+    Rho_First_Loop: for(int w=0; w<4; w++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        uint64_t val = 0;
+        for(int b=0; b<8; b++) val |= ((uint64_t)pk_in[KYBER_POLYVECBYTES + w*8 + b] << (b*8));
+        rho_strm.write(val);
+    }
+
+    Read_EK_Loop: for(int i=0; i<PK_BEATS; i++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        beat_t beat = 0;
+        for(int b=0; b<AXI_BEAT_BYTES; b++) beat |= (beat_t)pk_in[i*AXI_BEAT_BYTES + b] << (b*8);
+        hash_strm.write(beat);
+    }
+}
+
+// H(ek) = SHA3-256(ek), (K, r) = G(m || H(ek)) = SHA3-512(m || H(ek))
+// K là shared secret -> ghi thẳng ss_out, r -> lane PRF
+static void xe_hash_g(
+    hls::stream<beat_t>& hash_strm,
+    uint8 m_in[32],
+    uint8 ss_out[32],
+    hls::stream<ap_uint<64> >& seed_strm
+) {
+    #pragma HLS INLINE off
+    uint64_t state[25];
+    #pragma HLS ARRAY_PARTITION variable=state type=complete
+    for(int i=0; i<25; i++) {
+        #pragma HLS UNROLL
+        state[i] = 0;
+    }
+
+    int pos = 0;
+    Absorb_EK_Loop: for(int i=0; i<PK_BEATS; i++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        beat_t beat = hash_strm.read();
+        for(int h=0; h<2; h++) {
+            state[pos] ^= (uint64_t)beat.range(64*h + 63, 64*h);
+            pos++;
+            if (pos == 17) {
+                keccak_f1600(state);
+                pos = 0;
+            }
+        }
+    }
+    state[pos] ^= 0x06;
+    state[16] ^= (1ULL << 63);
+    keccak_f1600(state);
+
+    // G: m (4 lane) || H(ek) (4 lane), rate SHA3-512 = 9 lane -> pad ở lane 8
+    uint64_t g[25];
+    #pragma HLS ARRAY_PARTITION variable=g type=complete
+    for(int i=0; i<25; i++) {
+        #pragma HLS UNROLL
+        g[i] = 0;
+    }
+    for(int i=0; i<4; i++) {
+        #pragma HLS PIPELINE II=1
+        uint64_t w = 0;
+        for(int j=0; j<8; j++) w |= ((uint64_t)m_in[i*8+j] << (j*8));
+        g[i] = w;
+        g[4+i] = state[i];
+    }
+    g[8] ^= 0x06;
+    g[8] ^= (1ULL << 63);
+    keccak_f1600(g);
+
+    for(int i=0; i<4; i++) {
+        #pragma HLS PIPELINE II=1
+        for(int j=0; j<8; j++) ss_out[i*8+j] = (uint8)(g[i] >> (j*8));
+        seed_strm.write(g[4+i]);
+    }
+}
+
+// 1 đa thức int16 -> 64 word link
+static void xe_emit_poly(int16 p[KYBER_N], hls::stream<xof_link_t>& out) {
+    #pragma HLS INLINE
+    Emit_Poly_Loop: for(int q=0; q<XOF_LINK_POLY_WORDS; q++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        xof_link_t w = 0;
+        for(int l=0; l<4; l++) w |= (xof_link_t)(ap_uint<16>)p[4*q + l] << (16*l);
+        out.write(w);
+    }
+}
+
+// A^T theo thứ tự link_out đọc: với mỗi j, K hàng c unroll, mỗi hàng 1 bản
+// SampleNTT(rho || c || j) = A_T[c][j] (giống gen_matrix). ALLOCATION chia
+// HW_XOF_KECCAK Keccak cho K hàng; khi < K các hàng cùng j chạy nối tiếp
+// nên a_row phải chứa đủ 1 đa thức (link_out đọc xen kẽ các hàng).
+static void xe_sample_matrix(
+    hls::stream<ap_uint<64> >& rho_strm,
+    hls::stream<coef_pair_t> a_row[KYBER_K]
+) {
+    #pragma HLS INLINE off
+    DO_PRAGMA(HLS ALLOCATION function instances=keccak_f1600 limit=HW_XOF_KECCAK)
+
+    ap_uint<64> rho_words[4];
+    #pragma HLS ARRAY_PARTITION variable=rho_words complete
+    for(int w=0; w<4; w++) {
+        #pragma HLS PIPELINE II=1
+        rho_words[w] = rho_strm.read();
+    }
+
+    Sample_Col_Loop: for(int j=0; j<KYBER_K; j++) {
+        Sample_Row_Loop: for(int c=0; c<KYBER_K; c++) {
+            #pragma HLS UNROLL
+            ap_uint<64> xof_in[5];
+            #pragma HLS ARRAY_PARTITION variable=xof_in complete
+            for(int w=0; w<4; w++) {
+                #pragma HLS UNROLL
+                xof_in[w] = rho_words[w];
+            }
+            xof_in[4] = (uint64_t)c | ((uint64_t)j << 8);
+
+            hls::stream<uint8> strm;
+            DO_PRAGMA(HLS STREAM variable=strm depth=HW_XOF_DEPTH)
+
+            xof_absorb_squeeze(xof_in, strm);
+            parse_ntt_pairs(strm, a_row[c]);
+        }
+    }
+}
+
+// Lane PRF: r (eta1, nonce 0..K-1), e1 (eta2, nonce K..2K-1), e2 (nonce 2K)
+static void xe_noise(
+    hls::stream<ap_uint<64> >& seed_strm,
+    hls::stream<xof_link_t>& noise_strm
+) {
+    #pragma HLS INLINE off
+    uint8 seed[32];
+    #pragma HLS ARRAY_PARTITION variable=seed complete
+    for(int i=0; i<4; i++) {
+        #pragma HLS PIPELINE II=1
+        uint64_t w = seed_strm.read();
+        for(int j=0; j<8; j++) seed[i*8+j] = (uint8)(w >> (j*8));
+    }
+
+    int16 poly[KYBER_N];
+    #pragma HLS ARRAY_PARTITION variable=poly cyclic factor=4
+    Noise_R_Loop: for(int i=0; i<KYBER_K; i++) {
+        sample_poly_cbd<KYBER_ETA1>(seed, (uint8)i, poly);
+        xe_emit_poly(poly, noise_strm);
+    }
+    Noise_E1_Loop: for(int i=0; i<KYBER_K; i++) {
+        sample_poly_cbd<KYBER_ETA2>(seed, (uint8)(KYBER_K + i), poly);
+        xe_emit_poly(poly, noise_strm);
+    }
+    sample_poly_cbd<KYBER_ETA2>(seed, (uint8)(2 * KYBER_K), poly);
+    xe_emit_poly(poly, noise_strm);
+}
+
+// Writer duy nhất của AXIS: A^T từ K hàng xen kẽ, rồi noise
+static void xe_link_out(
+    hls::stream<coef_pair_t> a_row[KYBER_K],
+    hls::stream<xof_link_t>& noise_strm,
+    hls::stream<xof_link_t>& poly_out
+) {
+    #pragma HLS INLINE off
+    Link_Matrix_Loop: for(int j=0; j<KYBER_K; j++) {
+        for(int q=0; q<XOF_LINK_POLY_WORDS; q++) {
+            for(int c=0; c<KYBER_K; c++) {
+                #pragma HLS PIPELINE II=1
+                PERF_TICK(1);
+                coef_pair_t lo = a_row[c].read();
+                coef_pair_t hi = a_row[c].read();
+                poly_out.write(((xof_link_t)hi << 32) | lo);
+            }
+        }
+    }
+    Link_Noise_Loop: for(int i=0; i<XOF_LINK_NOISE_WORDS; i++) {
+        #pragma HLS PIPELINE II=1
+        PERF_TICK(1);
+        poly_out.write(noise_strm.read());
+    }
+}
+
+// 1 op: H / G, SampleNTT của A^T và lane PRF chạy song song
+static void xe_op(
+    uint8 pk_in[PK_SIZE],
+    uint8 m_in[32],
+    uint8 ss_out[32],
+    hls::stream<xof_link_t>& poly_out
+) {
+    #pragma HLS INLINE off
+
+    hls::stream<ap_uint<64> > rho_strm;
+    #pragma HLS STREAM variable=rho_strm depth=4
+    hls::stream<beat_t> hash_strm;
+    #pragma HLS STREAM variable=hash_strm depth=PK_BEATS
+    hls::stream<ap_uint<64> > seed_strm;
+    #pragma HLS STREAM variable=seed_strm depth=4
+    hls::stream<coef_pair_t> a_row[KYBER_K];
+    #pragma HLS STREAM variable=a_row depth=128 // 1 đa thức = 128 cặp
+    // link_out gửi hết A^T trước -> noise phải chờ trọn vẹn
+    hls::stream<xof_link_t> noise_strm;
+    DO_PRAGMA(HLS STREAM variable=noise_strm depth=XOF_LINK_NOISE_WORDS)
+
+    #pragma HLS DATAFLOW
+    xe_read_ek(pk_in, rho_strm, hash_strm);
+    xe_hash_g(hash_strm, m_in, ss_out, seed_strm);
+    xe_sample_matrix(rho_strm, a_row);
+    xe_noise(seed_strm, noise_strm);
+    xe_link_out(a_row, noise_strm, poly_out);
+}
+
+// Kernel XOF: xử lý các op first, first + stride, ... < n_ops của batch
+// (stride = HW_XOF_ENGINES, first = chỉ số engine), ghi ss và đẩy đa thức
+// của từng op ra poly_out theo đúng thứ tự đó.
+void ml_kem_encaps_xof(
+    int first,
+    int stride,
+    int n_ops,
+    uint8 pk_in[PK_SIZE * ENCAPS_BATCH_MAX],
+    uint8 m_in[32 * ENCAPS_BATCH_MAX],
+    uint8 ss_out[32 * ENCAPS_BATCH_MAX],
+    hls::stream<xof_link_t>& poly_out
+) {
+    #pragma HLS INTERFACE s_axilite port=first
+    #pragma HLS INTERFACE s_axilite port=stride
+    #pragma HLS INTERFACE s_axilite port=n_ops
+    #pragma HLS INTERFACE m_axi port=pk_in bundle=gmem0 depth=PK_BATCH_BYTES max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=m_in bundle=gmem0 depth=M_BATCH_BYTES max_widen_bitwidth=128
+    #pragma HLS INTERFACE m_axi port=ss_out bundle=gmem1 depth=SS_BATCH_BYTES max_widen_bitwidth=128
+    #pragma HLS INTERFACE axis port=poly_out
+    #pragma HLS INTERFACE s_axilite port=return
+
+    XOF_Op_Loop: for(int op=first; op<n_ops; op+=stride) {
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=ENCAPS_BATCH_MAX
+        xe_op(&pk_in[op * PK_SIZE], &m_in[op * 32], &ss_out[op * 32], poly_out);
+    }
+}
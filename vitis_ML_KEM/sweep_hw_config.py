@@ -0,0 +1,236 @@
+# sweep_hw_config.py
+# Quét các knob trong src/hw_config.h qua Vitis HLS C-synthesis và gom
+# latency / II / tài nguyên của từng kernel vào 1 file CSV.
+#
+#   python3 sweep_hw_config.py                      # lưới mặc định, cả 3 kernel
+#   python3 sweep_hw_config.py --top ml_kem_encaps --level 1024
+#   python3 sweep_hw_config.py --dry-run            # chỉ sinh tcl, không chạy vitis_hls
+#   python3 sweep_hw_config.py --one-at-a-time      # mỗi knob đổi riêng quanh mặc định
+#
+# Mỗi cấu hình = 1 project HLS riêng trong --work, chạy tuần tự (-j để chạy song song).
+#
+# Trạng thái: script mới chỉ được chạy với --dry-run (sinh + kiểm tra tcl), chưa
+# có máy có vitis_hls nên chưa có dòng CSV csynth thật nào; parse_report theo
+# schema csynth.xml của Vitis HLS 2022.x, chưa đối chiếu với report thật.
+
+import argparse
+import csv
+import itertools
+import os
+import subprocess
+import sys
+import xml.etree.ElementTree as ET
+from concurrent.futures import ThreadPoolExecutor
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SRC_DIR = os.path.join(HERE, "src")
+
+PART = "xck26-sfvc784-2LV-c"   # Kria K26 (kr260_som)
+CLOCK_NS = 10                  # 100 MHz, giống bitstream/
+
+TOPS = ["ml_kem_keygen", "ml_kem_encaps", "ml_kem_decaps",
+        "ml_kem_encaps_xof", "ml_kem_encaps_arith", "aes256_ctr", "aes256_gcm",
+        "keccak_duplex_crypt", "ml_kem_session_encaps", "ml_kem_session_decaps"]
+
+# Lưới knob. Giá trị đầu tiên của mỗi knob = mặc định trong hw_config.h.
+# Knob không liên quan tới top nào thì vẫn quét nhưng bị bỏ qua bởi dedup bên dưới.
+GRID = {
+    "HW_KG_KECCAK":       [6, 3, 9],
+    "HW_KEM_KECCAK":      [3, 2, 4],
+    "HW_XOF_KECCAK":      [3, 1],
+    "HW_KG_NTT":          [6, 3],
+    "HW_KEM_NTT":         [3, 2],
+    "HW_NTT_BUTTERFLIES": [1, 2],
+    "HW_NTT_II":          [2, 1],
+    "HW_POLY_PART":       [4, 2, 8],
+    "HW_BYTES_PART":      [3, 1, 6],
+    "HW_SAMPLER_II":      [3, 6],      # < 3 không đạt được (stream 8-bit)
+    "HW_XOF_DEPTH":       [256, 64],
+    "HW_XOF_ENGINES":     [2, 1, 3],
+    "HW_SESSION_SLOTS":   [4, 1],
+    "HW_GHASH_WAYS":      [4, 8],
+    "HW_SESSION_CIPHER":  [0, 1],
+}
+
+# Knob nào ảnh hưởng tới top nào (tránh synth lại các điểm giống hệt nhau)
+KNOBS_OF = {
+    # HW_XOF_KECCAK chỉ giới hạn gen_matrix; matvec_keygen có K cột cố định
+    # nên keygen dùng HW_KG_KECCAK. HW_BYTES_PART chỉ có ở pk / sk local của keygen.
+    "ml_kem_keygen": ["HW_KG_KECCAK", "HW_KG_NTT", "HW_NTT_BUTTERFLIES", "HW_NTT_II",
+                      "HW_POLY_PART", "HW_BYTES_PART", "HW_SAMPLER_II", "HW_XOF_DEPTH"],
+    "ml_kem_encaps": ["HW_KEM_KECCAK", "HW_XOF_KECCAK", "HW_KEM_NTT", "HW_NTT_BUTTERFLIES",
+                      "HW_NTT_II", "HW_POLY_PART", "HW_SAMPLER_II", "HW_XOF_DEPTH"],
+    "ml_kem_decaps": ["HW_KEM_KECCAK", "HW_XOF_KECCAK", "HW_KEM_NTT", "HW_NTT_BUTTERFLIES",
+                      "HW_NTT_II", "HW_POLY_PART", "HW_SAMPLER_II", "HW_XOF_DEPTH"],
+    # Cặp split: XOF chỉ có Keccak / sampler, arith chỉ có NTT / basemul
+    "ml_kem_encaps_xof":   ["HW_XOF_KECCAK", "HW_SAMPLER_II", "HW_XOF_DEPTH"],
+    "ml_kem_encaps_arith": ["HW_KEM_NTT", "HW_NTT_BUTTERFLIES", "HW_NTT_II", "HW_POLY_PART",
+                            "HW_XOF_ENGINES"],
+    # AES datapath cố định (14 round unroll, II=1): 1 điểm duy nhất
+    "aes256_ctr": [],
+    "aes256_gcm": ["HW_GHASH_WAYS"],
+    "keccak_duplex_crypt": [],
+    # encaps / decaps core + AES-CTR + bảng slot
+    "ml_kem_session_encaps": ["HW_KEM_KECCAK", "HW_KEM_NTT", "HW_POLY_PART", "HW_SESSION_SLOTS", "HW_SESSION_CIPHER"],
+    "ml_kem_session_decaps": ["HW_KEM_KECCAK", "HW_KEM_NTT", "HW_POLY_PART", "HW_SESSION_SLOTS", "HW_SESSION_CIPHER"],
+}
+
+CSV_FIELDS = ["top", "level", "config", "status",
+              "latency_min", "latency_max", "interval_min", "interval_max",
+              "est_clock_ns", "LUT", "FF", "DSP", "BRAM_18K", "URAM", "pareto"]
+
+
+def kernel_sources():
+    # perf_model.cpp là model host-only (tb_perf_model), không phải kernel;
+    # perf_clock.cpp là C model của blackbox, vào project qua perf_clock.json
+    return sorted(f for f in os.listdir(SRC_DIR)
+                  if f.endswith(".cpp") and not f.startswith("tb_")
+                  and f not in ("perf_model.cpp", "perf_clock.cpp"))
+
+
+def valid(cfg):
+    # Cùng điều kiện với #error trong hw_config.h
+    return cfg.get("HW_POLY_PART", 2) >= 2 * cfg.get("HW_NTT_BUTTERFLIES", 1)
+
+
+def configs_for(top, one_at_a_time=False):
+    names = KNOBS_OF[top]
+    if one_at_a_time:
+        # mặc định + từng knob lấy lần lượt các giá trị khác, knob còn lại giữ mặc định
+        base = {n: GRID[n][0] for n in names}
+        cfgs = [base] + [dict(base, **{n: v}) for n in names for v in GRID[n][1:]]
+    else:
+        cfgs = (dict(zip(names, values))
+                for values in itertools.product(*(GRID[n] for n in names)))
+    for cfg in cfgs:
+        if valid(cfg):
+            yield cfg
+
+
+def config_name(cfg):
+    return "_".join(f"{k[3:].lower()}{v}" for k, v in cfg.items())
+
+
+def write_tcl(proj_dir, top, level, cfg):
+    cflags = " ".join([f"-DML_KEM_LEVEL={level}"] +
+                      [f"-D{k}={v}" for k, v in cfg.items()])
+    lines = [f"open_project -reset {os.path.basename(proj_dir)}",
+             f"set_top {top}"]
+    for f in kernel_sources():
+        lines.append(f'add_files {os.path.join(SRC_DIR, f)} -cflags "{cflags}"')
+    lines.append(f"add_files -blackbox {os.path.join(SRC_DIR, 'perf_clock.json')}")
+    lines += ["open_solution -reset sol -flow_target vivado",
+              f"set_part {{{PART}}}",
+              f"create_clock -period {CLOCK_NS} -name default",
+              "csynth_design",
+              "exit"]
+    os.makedirs(proj_dir, exist_ok=True)
+    tcl = os.path.join(proj_dir, "run.tcl")
+    with open(tcl, "w") as fh:
+        fh.write("\n".join(lines) + "\n")
+    return tcl
+
+
+def parse_report(proj_dir, top):
+    xml = os.path.join(proj_dir, os.path.basename(proj_dir), "sol", "syn", "report",
+                       f"{top}_csynth.xml")
+    if not os.path.exists(xml):
+        xml = os.path.join(proj_dir, os.path.basename(proj_dir), "sol", "syn", "report",
+                           "csynth.xml")
+    root = ET.parse(xml).getroot()
+
+    def txt(path):
+        node = root.find(path)
+        return node.text if node is not None else ""
+
+    perf = "PerformanceEstimates/SummaryOfOverallLatency/"
+    res = "AreaEstimates/Resources/"
+    return {
+        "latency_min":  txt(perf + "Best-caseLatency"),
+        "latency_max":  txt(perf + "Worst-caseLatency"),
+        "interval_min": txt(perf + "Interval-min"),
+        "interval_max": txt(perf + "Interval-max"),
+        "est_clock_ns": txt("PerformanceEstimates/SummaryOfTimingAnalysis/EstimatedClockPeriod"),
+        "LUT":      txt(res + "LUT"),
+        "FF":       txt(res + "FF"),
+        "DSP":      txt(res + "DSP") or txt(res + "DSP48E"),
+        "BRAM_18K": txt(res + "BRAM_18K"),
+        "URAM":     txt(res + "URAM"),
+    }
+
+
+def run_one(job, args):
+    top, cfg = job
+    name = f"{top}_{args.level}_{config_name(cfg)}"
+    proj_dir = os.path.join(args.work, name)
+    tcl = write_tcl(proj_dir, top, args.level, cfg)
+    row = {"top": top, "level": args.level, "config": config_name(cfg), "status": "dry-run"}
+    if args.dry_run:
+        return row
+    log = os.path.join(proj_dir, "vitis_hls.log")
+    with open(log, "w") as fh:
+        rc = subprocess.call([args.vitis_hls, "-f", tcl], cwd=proj_dir,
+                             stdout=fh, stderr=subprocess.STDOUT)
+    if rc != 0:
+        row["status"] = f"fail({rc})"
+        return row
+    try:
+        row.update(parse_report(proj_dir, top))
+        row["status"] = "ok"
+    except (OSError, ET.ParseError) as e:
+        row["status"] = f"no-report({e.__class__.__name__})"
+    return row
+
+
+def mark_pareto(rows):
+    # Pareto theo (latency_max, LUT, DSP) trên từng top: không điểm nào khác tốt hơn ở cả 3
+    def key(r):
+        return (int(r["latency_max"]), int(r["LUT"]), int(r["DSP"]))
+
+    ok = [r for r in rows if r["status"] == "ok" and r.get("latency_max", "").isdigit()]
+    for r in ok:
+        kr = key(r)
+        dominated = any(
+            o is not r and o["top"] == r["top"] and
+            all(a <= b for a, b in zip(key(o), kr)) and key(o) != kr
+            for o in ok)
+        r["pareto"] = "" if dominated else "*"
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Design-space sweep over hw_config.h knobs")
+    ap.add_argument("--top", choices=TOPS, action="append",
+                    help="kernel cần quét (lặp lại được), mặc định tất cả")
+    ap.add_argument("--level", type=int, default=768, choices=[512, 768, 1024])
+    ap.add_argument("--work", default=os.path.join(HERE, "sweep"))
+    ap.add_argument("--csv", default=None, help="mặc định <work>/sweep_<level>.csv")
+    ap.add_argument("--vitis-hls", default="vitis_hls")
+    ap.add_argument("-j", "--jobs", type=int, default=1)
+    ap.add_argument("--dry-run", action="store_true")
+    ap.add_argument("--one-at-a-time", action="store_true",
+                    help="thay cho tích đầy đủ của lưới (keygen / encaps / decaps: ~1000 điểm)")
+    args = ap.parse_args()
+
+    tops = args.top or TOPS
+    jobs = [(t, cfg) for t in tops for cfg in configs_for(t, args.one_at_a_time)]
+    print(f"{len(jobs)} cấu hình ({', '.join(tops)}) @ ML-KEM-{args.level}")
+
+    with ThreadPoolExecutor(max_workers=max(1, args.jobs)) as ex:
+        rows = []
+        for row in ex.map(lambda j: run_one(j, args), jobs):
+            print(f"  {row['top']:<14} {row['config']:<60} {row['status']}")
+            rows.append(row)
+
+    mark_pareto(rows)
+    out = args.csv or os.path.join(args.work, f"sweep_{args.level}.csv")
+    os.makedirs(os.path.dirname(os.path.abspath(out)), exist_ok=True)
+    with open(out, "w", newline="") as fh:
+        w = csv.DictWriter(fh, fieldnames=CSV_FIELDS, extrasaction="ignore")
+        w.writeheader()
+        w.writerows(rows)
+    print(f"-> {out}")
+    return 0 if all(r["status"] in ("ok", "dry-run") for r in rows) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())